@@ -0,0 +1,336 @@
+#!/usr/bin/env python3
+
+###############################################################################
+# Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+# and RAJA Performance Suite project contributors.
+# See the RAJAPerf/LICENSE file for details.
+#
+# SPDX-License-Identifier: (BSD-3-Clause)
+###############################################################################
+
+#
+# Summarize loop vectorization remarks for each kernel variant.
+#
+# Reads the optimization records written by a build configured with
+# -DRAJA_PERFSUITE_ENABLE_VECTORIZATION_REPORT=On, i.e., GCC's
+# '<source>.opt-record.json.gz' files or Clang's '<source>.opt.yaml' files,
+# and attributes each vectorizer remark to a kernel (from the kernel source
+# file name) and a variant (from the 'case <VariantID> :' label enclosing the
+# loop in that file). Loops that live in RAJA headers are attributed through
+# GCC's inlining chain when available, otherwise to the RAJA variant of the
+# backend whose run*Variant method contains them. When that backend's source
+# picks its variants with 'if ( vid == ... )' rather than case labels, the
+# loop could belong to any of them and is reported as 'ambiguous_<backend>'.
+#
+# Usage:
+#
+#   vectorization_report.py --build-dir <build> --src-dir <RAJAPerf/src>
+#                           [--timing RAJAPerf-timing-Average.csv]
+#                           [--output RAJAPerf-vectorization.csv]
+#
+# With --timing, the time of each tuning of a kernel variant from the Suite
+# timing report is added, one row per tuning, so e.g. a RAJA_Seq variant that
+# failed to vectorize a loop that Base_Seq vectorized can be read off next to
+# the cost. The loop counts of a variant are the same for all its tunings.
+#
+
+import argparse
+import gzip
+import json
+import os
+import re
+import sys
+
+KERNEL_GROUPS = {"algorithm": "Algorithm", "apps": "Apps", "basic": "Basic",
+                 "lcals": "Lcals", "polybench": "Polybench",
+                 "stream": "Stream", "comm": "Comm"}
+
+CASE_RE = re.compile(r"^\s*case\s+(\w+)\s*:")
+
+# run*Variant method name -> the variant its header loops come from, the
+# RAJA variant where there is one; ThreadPool and StdPar have no RAJA
+# variant and their header loops can belong to either of their variants, so
+# they are left unattributed
+RUN_METHOD_RE = re.compile(r"run(\w+?)Variant")
+RUN_METHOD_VARIANT = {"Seq": "RAJA_Seq", "OpenMP": "RAJA_OpenMP",
+                      "OpenMPTarget": "RAJA_OMPTarget", "Cuda": "RAJA_CUDA",
+                      "Hip": "RAJA_HIP", "Kokkos": "Kokkos_Lambda",
+                      "SIMD": "RAJA_SIMD"}
+
+# run*Variant method name -> the kernel source file suffix of its backend
+RUN_METHOD_SOURCE = {"Seq": "Seq", "OpenMP": "OMP",
+                     "OpenMPTarget": "OMPTarget", "Cuda": "Cuda", "Hip": "Hip",
+                     "Kokkos": "Kokkos", "SIMD": "SIMD"}
+
+VID_BRANCH_RE = re.compile(r"\bif\s*\(\s*vid\s*==")
+
+
+class Remark:
+  def __init__(self, path, line, vectorized, width, function, chain):
+    self.path = path
+    self.line = line
+    self.vectorized = vectorized
+    self.width = width
+    self.function = function
+    self.chain = chain    # [(path, line)] of inlining sites, innermost first
+
+
+def kernel_of(path):
+  """Return 'Group_KERNEL' for a kernel source path, or None."""
+  parts = os.path.normpath(path).split(os.sep)
+  if len(parts) < 2 or parts[-2] not in KERNEL_GROUPS:
+    return None
+  name = os.path.basename(path)
+  if not name.endswith(".cpp"):
+    return None
+  kernel = name[:-len(".cpp")].split("-")[0]
+  return KERNEL_GROUPS[parts[-2]] + "_" + kernel
+
+
+class SourceCases:
+  """Caches the 'case <VariantID> :' labels of each kernel source file."""
+
+  def __init__(self, src_dir):
+    self.src_dir = src_dir
+    self.cache = {}
+    self.branch_cache = {}
+
+  def resolve(self, path):
+    if os.path.isfile(path):
+      return path
+    # records may hold paths relative to the compiler's working directory
+    parts = os.path.normpath(path).split(os.sep)
+    candidate = os.path.join(self.src_dir, parts[-2], parts[-1])
+    return candidate if os.path.isfile(candidate) else None
+
+  def variant_at(self, path, line):
+    real = self.resolve(path)
+    if real is None:
+      return None
+    if real not in self.cache:
+      cases = []
+      with open(real) as f:
+        for lineno, text in enumerate(f, 1):
+          m = CASE_RE.match(text)
+          if m:
+            cases.append((lineno, m.group(1)))
+      self.cache[real] = cases
+    variant = None
+    for lineno, name in self.cache[real]:
+      if lineno > line:
+        break
+      variant = name
+    return variant
+
+  def branches_on_vid(self, path):
+    """Whether a kernel source picks variants with 'if ( vid == ... )'."""
+    real = self.resolve(path)
+    if real is None:
+      return False
+    if real not in self.branch_cache:
+      with open(real) as f:
+        self.branch_cache[real] = VID_BRANCH_RE.search(f.read()) is not None
+    return self.branch_cache[real]
+
+
+def read_gcc_records(filename):
+  with gzip.open(filename, "rt") as f:
+    _, passes, records = json.load(f)
+
+  pass_names = {}
+  def walk(nodes):
+    for node in nodes:
+      pass_names[node["id"]] = node["name"]
+      walk(node.get("children", []))
+  walk(passes)
+
+  remarks = []
+  for rec in records:
+    if pass_names.get(rec.get("pass")) != "vect" or "location" not in rec:
+      continue
+    text = "".join(m if isinstance(m, str) else "" for m in rec["message"])
+    if rec["kind"] == "success":
+      m = re.search(r"loop vectorized using (\d+) byte vectors", text)
+      if m is None:
+        continue
+      vectorized, width = True, m.group(1) + "B"
+    elif rec["kind"] == "failure" and "couldn't vectorize loop" in text:
+      vectorized, width = False, ""
+    else:
+      continue
+    chain = [(site["site"]["file"], site["site"]["line"])
+             for site in rec.get("inlining_chain", []) if "site" in site]
+    loc = rec["location"]
+    remarks.append(Remark(loc["file"], loc["line"], vectorized, width,
+                          rec.get("function", ""), chain))
+  return remarks
+
+
+def read_clang_records(filename):
+  remarks = []
+
+  def flush(doc):
+    if doc.get("Pass") != "loop-vectorize" or "File" not in doc:
+      return
+    if doc["kind"] == "Passed" and doc.get("Name") == "Vectorized":
+      width = "VF=" + doc.get("VectorizationFactor", "?")
+      remarks.append(Remark(doc["File"], int(doc["Line"]), True, width,
+                            doc.get("Function", ""), []))
+    elif doc["kind"] == "Missed" and doc.get("Name") == "MissedDetails":
+      remarks.append(Remark(doc["File"], int(doc["Line"]), False, "",
+                            doc.get("Function", ""), []))
+
+  doc = {}
+  with open(filename) as f:
+    for text in f:
+      if text.startswith("--- !"):
+        flush(doc)
+        doc = {"kind": text[5:].strip()}
+        continue
+      m = re.match(r"^(\w+):\s+(.*)$", text)
+      if m and m.group(1) == "DebugLoc":
+        loc = dict(re.findall(r"(\w+):\s*'?([^',}]+)'?", m.group(2)))
+        if "DebugLoc" not in doc:
+          doc["DebugLoc"] = True
+          doc.update(loc)
+      elif m:
+        doc.setdefault(m.group(1), m.group(2).strip("'"))
+      else:
+        m = re.match(r"^\s+- (\w+):\s+'?([^']*)'?$", text)
+        if m:
+          doc.setdefault(m.group(1), m.group(2))
+  flush(doc)
+  return remarks
+
+
+def attribute(remark, cases):
+  """Return (kernel, variant) for a remark, or None if not in a kernel."""
+  for path, line in [(remark.path, remark.line)] + remark.chain:
+    kernel = kernel_of(path)
+    if kernel is not None:
+      variant = cases.variant_at(path, line)
+      if variant is not None:
+        return kernel, variant
+  return None
+
+
+def attribute_by_function(remark, kernel_sources, cases):
+  """Attribute a loop in a header to the RAJA variant of its run method."""
+  m = RUN_METHOD_RE.search(remark.function)
+  if m is None or m.group(1) not in RUN_METHOD_VARIANT:
+    return None
+  backend = m.group(1)
+  for kernel, mangled, source in kernel_sources:
+    if mangled not in remark.function:
+      continue
+    if not source.endswith("-" + RUN_METHOD_SOURCE[backend] + ".cpp"):
+      continue
+    if cases.branches_on_vid(source):
+      return kernel, "ambiguous_" + backend
+    return kernel, RUN_METHOD_VARIANT[backend]
+  return None
+
+
+def read_timing(filename):
+  """Return {(kernel, variant, tuning): time} from a Suite timing csv report.
+
+  The report has a row of variant names and then a row of tuning names, both
+  headed 'Kernel', with a column for each tuning of each variant.
+  """
+  times = {}
+  with open(filename) as f:
+    rows = [[c.strip() for c in line.split(",")] for line in f]
+  header_rows = [i for i, r in enumerate(rows) if r and r[0] == "Kernel"]
+  if len(header_rows) < 2:
+    return times
+  variant_row, tuning_row = rows[header_rows[0]], rows[header_rows[1]]
+  for row in rows[header_rows[1] + 1:]:
+    if not row or "_" not in row[0]:
+      continue
+    for variant, tuning, value in zip(variant_row[1:], tuning_row[1:],
+                                      row[1:]):
+      try:
+        times[(row[0], variant, tuning)] = float(value)
+      except ValueError:
+        pass
+  return times
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__)
+  parser.add_argument("--build-dir", required=True)
+  parser.add_argument("--src-dir", required=True)
+  parser.add_argument("--timing", help="Suite timing csv report")
+  parser.add_argument("--output", help="output csv file (default stdout)")
+  args = parser.parse_args()
+
+  remarks = []
+  kernel_sources = set()
+  for root, _, files in os.walk(args.build_dir):
+    for name in files:
+      path = os.path.join(root, name)
+      if name.endswith(".opt-record.json.gz"):
+        remarks += read_gcc_records(path)
+      elif name.endswith(".opt.yaml"):
+        remarks += read_clang_records(path)
+      else:
+        continue
+      # records sit next to the object files, e.g. in
+      # src/basic/CMakeFiles/basic.dir/DAXPY-Seq.cpp.opt.yaml
+      group = os.path.basename(root)
+      if group.endswith(".dir"):
+        group = group[:-len(".dir")]
+      src = name.split(".")[0]
+      source = os.path.join(group, src + ".cpp")
+      kernel = kernel_of(source)
+      if kernel is not None:
+        # mangled class name fragment, e.g. '5DAXPY'
+        src = src.split("-")[0]
+        kernel_sources.add((kernel, str(len(src)) + src, source))
+
+  if not remarks:
+    sys.exit("No optimization records found in " + args.build_dir +
+             ", configure with -DRAJA_PERFSUITE_ENABLE_VECTORIZATION_REPORT=On")
+
+  cases = SourceCases(args.src_dir)
+  loops = {}
+  for remark in remarks:
+    key = attribute(remark, cases) or \
+          attribute_by_function(remark, sorted(kernel_sources), cases)
+    if key is None:
+      continue
+    # the vectorizer may report the same loop more than once, e.g. for
+    # versioned or epilogue copies; a loop counts as vectorized if any
+    # copy of it is
+    loop = loops.setdefault(key, {}).setdefault(
+        (remark.path, remark.line), set())
+    if remark.vectorized:
+      loop.add(remark.width)
+
+  times = read_timing(args.timing) if args.timing else {}
+
+  out = open(args.output, "w") if args.output else sys.stdout
+  header = ["Kernel", "Variant", "Loops", "Vectorized", "Missed", "Widths"]
+  if args.timing:
+    header += ["Tuning", "Time"]
+  out.write(",".join(header) + "\n")
+  for (kernel, variant) in sorted(loops):
+    widths = loops[(kernel, variant)].values()
+    n_vec = sum(1 for w in widths if w)
+    row = [kernel, variant, str(len(widths)), str(n_vec),
+           str(len(widths) - n_vec),
+           " ".join(sorted(set().union(*widths)))]
+    if not args.timing:
+      out.write(",".join(row) + "\n")
+      continue
+    tunings = [(tuning, t) for (k, v, tuning), t in times.items()
+               if k == kernel and v == variant]
+    for tuning, t in tunings or [("", None)]:
+      out.write(",".join(row + [tuning, "" if t is None else repr(t)]) +
+                "\n")
+  if out is not sys.stdout:
+    out.close()
+
+
+if __name__ == "__main__":
+  main()
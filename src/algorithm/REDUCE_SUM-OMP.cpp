@@ -18,7 +18,8 @@ namespace algorithm
 {
 
 
-void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type, typename Compute_type >
+void REDUCE_SUM::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -26,7 +27,7 @@ void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  REDUCE_SUM_DATA_SETUP;
+  REDUCE_SUM_PRECISION_DATA_SETUP(Data_type, Compute_type);
 
   switch ( vid ) {
 
@@ -35,11 +36,11 @@ void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type sum = m_sum_init;
+        Compute_type sum = m_sum_init;
 
         #pragma omp parallel for reduction(+:sum)
         for (Index_type i = ibegin; i < iend; ++i ) {
-          REDUCE_SUM_BODY;
+          REDUCE_SUM_PRECISION_BODY(Compute_type);
         }
 
         m_sum = sum;
@@ -52,14 +53,14 @@ void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 
     case Lambda_OpenMP : {
 
-      auto sumreduce_base_lam = [=](Index_type i) {
-                                 return x[i];
+      auto sumreduce_base_lam = [=](Index_type i) -> Compute_type {
+                                 return Compute_type(x[i]);
                                };
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type sum = m_sum_init;
+        Compute_type sum = m_sum_init;
 
         #pragma omp parallel for reduction(+:sum)
         for (Index_type i = ibegin; i < iend; ++i ) {
@@ -79,15 +80,15 @@ void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::ReduceSum<RAJA::omp_reduce, Real_type> sum(m_sum_init);
+        RAJA::ReduceSum<RAJA::omp_reduce, Compute_type> sum(m_sum_init);
 
         RAJA::forall<RAJA::omp_parallel_for_exec>(
           RAJA::RangeSegment(ibegin, iend),
           [=](Index_type i) {
-            REDUCE_SUM_BODY;
+            REDUCE_SUM_PRECISION_BODY(Compute_type);
         });
 
-        m_sum = sum.get();
+        m_sum = static_cast<Real_type>(sum.get());
 
       }
       stopTimer();
@@ -106,5 +107,7 @@ void REDUCE_SUM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune
 #endif
 }
 
+RAJAPERF_OPENMP_PRECISION_TUNING_DEFINE_BOILERPLATE(REDUCE_SUM)
+
 } // end namespace algorithm
 } // end namespace rajaperf
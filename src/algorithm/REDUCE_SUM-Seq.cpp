@@ -18,13 +18,14 @@ namespace algorithm
 {
 
 
-void REDUCE_SUM::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type, typename Compute_type >
+void REDUCE_SUM::runSeqVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  REDUCE_SUM_DATA_SETUP;
+  REDUCE_SUM_PRECISION_DATA_SETUP(Data_type, Compute_type);
 
   switch ( vid ) {
 
@@ -33,10 +34,10 @@ void REDUCE_SUM::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_id
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type sum = m_sum_init;
+        Compute_type sum = m_sum_init;
 
         for (Index_type i = ibegin; i < iend; ++i ) {
-          REDUCE_SUM_BODY;
+          REDUCE_SUM_PRECISION_BODY(Compute_type);
         }
 
         m_sum = sum;
@@ -50,14 +51,14 @@ void REDUCE_SUM::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_id
 #if defined(RUN_RAJA_SEQ)
     case Lambda_Seq : {
 
-      auto reduce_sum_base_lam = [=](Index_type i) {
-                                 return x[i];
+      auto reduce_sum_base_lam = [=](Index_type i) -> Compute_type {
+                                 return Compute_type(x[i]);
                                };
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type sum = m_sum_init;
+        Compute_type sum = m_sum_init;
 
         for (Index_type i = ibegin; i < iend; ++i ) {
           sum += reduce_sum_base_lam(i);
@@ -76,14 +77,14 @@ void REDUCE_SUM::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_id
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::ReduceSum<RAJA::seq_reduce, Real_type> sum(m_sum_init);
+        RAJA::ReduceSum<RAJA::seq_reduce, Compute_type> sum(m_sum_init);
 
         RAJA::forall<RAJA::loop_exec>( RAJA::RangeSegment(ibegin, iend),
           [=](Index_type i) {
-            REDUCE_SUM_BODY;
+            REDUCE_SUM_PRECISION_BODY(Compute_type);
         });
 
-        m_sum = sum.get();
+        m_sum = static_cast<Real_type>(sum.get());
 
       }
       stopTimer();
@@ -100,5 +101,7 @@ void REDUCE_SUM::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_id
 
 }
 
+RAJAPERF_SEQ_PRECISION_TUNING_DEFINE_BOILERPLATE(REDUCE_SUM)
+
 } // end namespace algorithm
 } // end namespace rajaperf
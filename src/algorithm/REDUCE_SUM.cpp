@@ -51,17 +51,26 @@ REDUCE_SUM::REDUCE_SUM(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  setVariantDefined( Base_StdPar );
+  setVariantDefined( Lambda_StdPar );
 }
 
 REDUCE_SUM::~REDUCE_SUM()
 {
 }
 
-void REDUCE_SUM::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void REDUCE_SUM::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitData(m_x, getActualProblemSize(), vid);
   m_sum_init = 0.0;
   m_sum = 0.0;
+
+  if ( precision::isTuning(getVariantTuningName(vid, tune_idx)) ) {
+    precision::allocAndCopyData(m_x_fp32, m_x, getActualProblemSize());
+    recordBytesSaved(vid, tune_idx, precision::getBytesSaved(
+      1*sizeof(Real_type) * getActualProblemSize()));
+  }
 }
 
 void REDUCE_SUM::updateChecksum(VariantID vid, size_t tune_idx)
@@ -69,10 +78,13 @@ void REDUCE_SUM::updateChecksum(VariantID vid, size_t tune_idx)
   checksum[vid].at(tune_idx) += calcChecksum(&m_sum, 1);
 }
 
-void REDUCE_SUM::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void REDUCE_SUM::tearDown(VariantID vid, size_t tune_idx)
 {
-  (void) vid;
   deallocData(m_x);
+
+  if ( precision::isTuning(getVariantTuningName(vid, tune_idx)) ) {
+    precision::deallocData(m_x_fp32);
+  }
 }
 
 } // end namespace algorithm
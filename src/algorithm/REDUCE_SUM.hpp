@@ -25,14 +25,24 @@
 #define REDUCE_SUM_DATA_SETUP \
   Real_ptr x = m_x;
 
+// the data in the types of a precision tuning (see common/PrecisionUtils.hpp)
+#define REDUCE_SUM_PRECISION_DATA_SETUP(Data_type, Compute_type) \
+  Data_type* x = precision::getData<Data_type>(m_x, m_x_fp32);
+
 #define REDUCE_SUM_STD_ARGS  \
   x + ibegin, x + iend
 
 #define REDUCE_SUM_BODY \
   sum += x[i];
 
+// the precision tunings load Data_type and accumulate in Compute_type
+// (see common/PrecisionUtils.hpp)
+#define REDUCE_SUM_PRECISION_BODY(Compute_type) \
+  sum += Compute_type(x[i]);
+
 
 #include "common/KernelBase.hpp"
+#include "common/PrecisionUtils.hpp"
 
 namespace rajaperf
 {
@@ -58,7 +68,14 @@ public:
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
-
+  void runStdParVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  template < typename Data_type, typename Compute_type >
+  void runSeqVariantImpl(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  template < typename Data_type, typename Compute_type >
+  void runOpenMPVariantImpl(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   void runCudaVariantCub(VariantID vid);
@@ -73,6 +90,7 @@ private:
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
   Real_ptr m_x;
+  precision::Float_ptr m_x_fp32;
   Real_type m_sum_init;
   Real_type m_sum;
 };
@@ -0,0 +1,88 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SCAN.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/StdParUtils.hpp"
+
+#include <functional>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void SCAN::runStdParVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+#if defined(RUN_STDPAR)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SCAN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_StdPar : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        SCAN_PROLOGUE;
+        std::exclusive_scan( std::execution::par_unseq,
+                             x + ibegin, x + iend, y + ibegin,
+                             scan_var );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_StdPar : {
+
+      auto scan_lam = [=](Index_type i) -> Real_type {
+                        return x[i];
+                      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        SCAN_PROLOGUE;
+        std::transform_exclusive_scan( std::execution::par_unseq,
+                                       stdpar::counting_iterator(ibegin),
+                                       stdpar::counting_iterator(iend),
+                                       y + ibegin,
+                                       scan_var,
+                                       std::plus<Real_type>(),
+                                       scan_lam );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SCAN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -0,0 +1,88 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SORTPAIRS.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/StdParUtils.hpp"
+
+#include <iostream>
+#include <utility>
+#include <vector>
+
+namespace rajaperf
+{
+namespace algorithm
+{
+
+
+void SORTPAIRS::runStdParVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+#if defined(RUN_STDPAR)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SORTPAIRS_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_StdPar : {
+
+      using pair_type = std::pair<Real_type, Real_type>;
+
+      std::vector<pair_type> vector_of_pairs(iend-ibegin);
+      pair_type* pairs = vector_of_pairs.data();
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        const Index_type offset = iend*irep;
+
+        std::for_each( std::execution::par_unseq,
+                       stdpar::counting_iterator(ibegin),
+                       stdpar::counting_iterator(iend),
+                       [=](Index_type iemp) {
+          pairs[iemp - ibegin] = pair_type(x[offset + iemp], i[offset + iemp]);
+        });
+
+        std::sort( std::execution::par_unseq,
+                   pairs, pairs + (iend-ibegin),
+                   [](pair_type const& lhs, pair_type const& rhs) {
+                     return lhs.first < rhs.first;
+                   });
+
+        std::for_each( std::execution::par_unseq,
+                       stdpar::counting_iterator(ibegin),
+                       stdpar::counting_iterator(iend),
+                       [=](Index_type iemp) {
+          x[offset + iemp] = pairs[iemp - ibegin].first;
+          i[offset + iemp] = pairs[iemp - ibegin].second;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SORTPAIRS : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace algorithm
+} // end namespace rajaperf
@@ -53,6 +53,7 @@ public:
   {
     getCout() << "\n  SORTPAIRS : Unknown OMP Target variant id = " << vid << std::endl;
   }
+  void runStdParVariant(VariantID vid, size_t tune_idx);
 
 private:
   static const size_t default_gpu_block_size = 0;
@@ -0,0 +1,277 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "COUPLE_REAL.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+#include <cmath>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void COUPLE_REAL::runOpenMPVariantDefault(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  COUPLE_REAL_DATA_SETUP;
+
+  auto couple_real_lam = [=](Index_type i) {
+                           COUPLE_REAL_BODY;
+                         };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          COUPLE_REAL_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          couple_real_lam(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), couple_real_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  COUPLE_REAL : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+#if defined(RAJAPERF_USE_LIBMVEC)
+void COUPLE_REAL::runOpenMPVariantSIMDLibm(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  COUPLE_REAL_DATA_SETUP;
+
+  auto couple_real_lam = [=](Index_type i) {
+                           COUPLE_REAL_SIMD_LIBM_BODY;
+                         };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for simd
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          COUPLE_REAL_SIMD_LIBM_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for simd
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          couple_real_lam(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      const Index_type nchunks =
+          (iend - ibegin + simd_chunk_size - 1) / simd_chunk_size;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nchunks), [=](Index_type c) {
+            const Index_type cbegin = ibegin + c * simd_chunk_size;
+            const Index_type cend = RAJA_MIN(cbegin + simd_chunk_size, iend);
+            RAJA::forall<RAJA::simd_exec>(
+              RAJA::RangeSegment(cbegin, cend), couple_real_lam);
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  COUPLE_REAL : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+#endif // RAJAPERF_USE_LIBMVEC
+
+template < size_t ulps >
+void COUPLE_REAL::runOpenMPVariantPoly(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  COUPLE_REAL_DATA_SETUP;
+
+  auto couple_real_lam = [=](Index_type i) {
+                           COUPLE_REAL_POLY_BODY(ulps);
+                         };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          COUPLE_REAL_POLY_BODY(ulps);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          couple_real_lam(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), couple_real_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  COUPLE_REAL : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void COUPLE_REAL::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if ( tune_idx == t ) {
+    runOpenMPVariantDefault(vid);
+  }
+  t += 1;
+
+#if defined(RAJAPERF_USE_LIBMVEC)
+  if ( tune_idx == t ) {
+    runOpenMPVariantSIMDLibm(vid);
+  }
+  t += 1;
+#endif
+
+  seq_for(fastmath::ulps_type{}, [&](auto ulps) {
+    if ( tune_idx == t ) {
+      runOpenMPVariantPoly<ulps>(vid);
+    }
+    t += 1;
+  });
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,256 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "COUPLE_REAL.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+#include <cmath>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void COUPLE_REAL::runSeqVariantDefault(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  COUPLE_REAL_DATA_SETUP;
+
+  auto couple_real_lam = [=](Index_type i) {
+                           COUPLE_REAL_BODY;
+                         };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          COUPLE_REAL_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          couple_real_lam(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), couple_real_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  COUPLE_REAL : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+#if defined(RAJAPERF_USE_LIBMVEC)
+void COUPLE_REAL::runSeqVariantSIMDLibm(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  COUPLE_REAL_DATA_SETUP;
+
+  auto couple_real_lam = [=](Index_type i) {
+                           COUPLE_REAL_SIMD_LIBM_BODY;
+                         };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp simd
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          COUPLE_REAL_SIMD_LIBM_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp simd
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          couple_real_lam(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), couple_real_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  COUPLE_REAL : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+#endif // RAJAPERF_USE_LIBMVEC
+
+template < size_t ulps >
+void COUPLE_REAL::runSeqVariantPoly(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  COUPLE_REAL_DATA_SETUP;
+
+  auto couple_real_lam = [=](Index_type i) {
+                           COUPLE_REAL_POLY_BODY(ulps);
+                         };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          COUPLE_REAL_POLY_BODY(ulps);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          couple_real_lam(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), couple_real_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  COUPLE_REAL : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void COUPLE_REAL::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if ( tune_idx == t ) {
+    runSeqVariantDefault(vid);
+  }
+  t += 1;
+
+#if defined(RAJAPERF_USE_LIBMVEC)
+  if ( tune_idx == t ) {
+    runSeqVariantSIMDLibm(vid);
+  }
+  t += 1;
+#endif
+
+  seq_for(fastmath::ulps_type{}, [&](auto ulps) {
+    if ( tune_idx == t ) {
+      runSeqVariantPoly<ulps>(vid);
+    }
+    t += 1;
+  });
+}
+
+} // end namespace apps
+} // end namespace rajaperf
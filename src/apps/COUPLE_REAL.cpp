@@ -0,0 +1,127 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "COUPLE_REAL.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+COUPLE_REAL::COUPLE_REAL(const RunParams& params)
+  : KernelBase(rajaperf::Apps_COUPLE_REAL, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(50);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (2*sizeof(Real_type) + 4*sizeof(Real_type)) * getActualProblemSize() );
+  setFLOPsPerRep(17 * getActualProblemSize()); // 1 sqrt, 1 sin, 1 cos
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+COUPLE_REAL::~COUPLE_REAL()
+{
+}
+
+void COUPLE_REAL::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+#if defined(RAJAPERF_USE_LIBMVEC)
+  addVariantTuningName(vid, "simd_libm");
+#endif
+  seq_for(fastmath::ulps_type{}, [&](auto ulps) {
+    addVariantTuningName(vid, fastmath::getPolyTuningName(ulps));
+  });
+}
+
+void COUPLE_REAL::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+#if defined(RAJAPERF_USE_LIBMVEC)
+  addVariantTuningName(vid, "simd_libm");
+#endif
+  seq_for(fastmath::ulps_type{}, [&](auto ulps) {
+    addVariantTuningName(vid, fastmath::getPolyTuningName(ulps));
+  });
+}
+
+void COUPLE_REAL::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  allocAndInitData(m_c1, getActualProblemSize(), vid);
+  allocAndInitData(m_c2, getActualProblemSize(), vid);
+  allocAndInitData(m_x0, getActualProblemSize(), vid);
+  allocAndInitData(m_x1, getActualProblemSize(), vid);
+  allocAndInitDataConst(m_y0, getActualProblemSize(), 0.0, vid);
+  allocAndInitDataConst(m_y1, getActualProblemSize(), 0.0, vid);
+
+  // rotation angles over several periods, to exercise argument reduction
+  m_half_dt = 10.0;
+}
+
+void COUPLE_REAL::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  const Index_type len = getActualProblemSize();
+
+  checksum[vid][tune_idx] += calcChecksum(m_y0, len);
+  checksum[vid][tune_idx] += calcChecksum(m_y1, len);
+
+  std::vector<Real_type> y0_ref(len);
+  std::vector<Real_type> y1_ref(len);
+  {
+    Real_ptr c1 = m_c1;
+    Real_ptr c2 = m_c2;
+    Real_ptr x0 = m_x0;
+    Real_ptr x1 = m_x1;
+    Real_ptr y0 = y0_ref.data();
+    Real_ptr y1 = y1_ref.data();
+    const Real_type half_dt = m_half_dt;
+    for (Index_type i = 0; i < len; ++i) {
+      COUPLE_REAL_BODY_IMPL(std::sqrt, std::sin, std::cos);
+    }
+  }
+  recordULPError(vid, tune_idx,
+                 std::max(fastmath::calcMaxULPError(m_y0, y0_ref.data(), len),
+                          fastmath::calcMaxULPError(m_y1, y1_ref.data(), len)));
+}
+
+void COUPLE_REAL::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_c1);
+  deallocData(m_c2);
+  deallocData(m_x0);
+  deallocData(m_x1);
+  deallocData(m_y0);
+  deallocData(m_y1);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,139 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// COUPLE_REAL kernel reference implementation:
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   Real_type zlam = sqrt( c1[i]*c1[i] + c2[i]*c2[i] + 1.0e-34 );
+///   Real_type snlamt = sin( zlam * half_dt );
+///   Real_type cslamt = cos( zlam * half_dt );
+///   Real_type r_zlam = 1.0 / zlam;
+///   y0[i] = cslamt * x0[i] - snlamt * ( c1[i] * r_zlam ) * x1[i];
+///   y1[i] = snlamt * ( c2[i] * r_zlam ) * x0[i] + cslamt * x1[i];
+/// }
+///
+/// The real valued rotation at the core of the COUPLE kernel, which is not
+/// run, for its per element sqrt, sin and cos.
+///
+/// Seq and OpenMP tunings (see common/FastMath.hpp):
+///   default      -- the loop above, with std:: math
+///   simd_libm    -- the loop above in an omp simd loop, calling the
+///                   libmvec vector sin and cos; only with
+///                   RAJA_PERFSUITE_ENABLE_LIBMVEC. std::sqrt may set errno,
+///                   which keeps the loop from vectorizing, so this uses
+///                   fastmath::sqrt
+///   poly_<U>ulp  -- fastmath::sqrt, sin<U> and cos<U>, inlined and
+///                   vectorized
+///
+/// The largest error of y0 and y1 against std:: math, in ULPs, is written
+/// to the ULP error report.
+///
+
+#ifndef RAJAPerf_Apps_COUPLE_REAL_HPP
+#define RAJAPerf_Apps_COUPLE_REAL_HPP
+
+#define COUPLE_REAL_DATA_SETUP \
+  Real_ptr c1 = m_c1; \
+  Real_ptr c2 = m_c2; \
+  Real_ptr x0 = m_x0; \
+  Real_ptr x1 = m_x1; \
+  Real_ptr y0 = m_y0; \
+  Real_ptr y1 = m_y1; \
+  const Real_type half_dt = m_half_dt;
+
+#define COUPLE_REAL_BODY_IMPL(sqrt_fn, sin_fn, cos_fn) \
+  const Real_type c1i = c1[i]; \
+  const Real_type c2i = c2[i]; \
+  const Real_type x0i = x0[i]; \
+  const Real_type x1i = x1[i]; \
+  const Real_type zlam = sqrt_fn( c1i*c1i + c2i*c2i + 1.0e-34 ); \
+  const Real_type snlamt = sin_fn( zlam * half_dt ); \
+  const Real_type cslamt = cos_fn( zlam * half_dt ); \
+  const Real_type r_zlam = 1.0 / zlam; \
+  y0[i] = cslamt * x0i - snlamt * ( c1i * r_zlam ) * x1i; \
+  y1[i] = snlamt * ( c2i * r_zlam ) * x0i + cslamt * x1i;
+
+#define COUPLE_REAL_BODY \
+  COUPLE_REAL_BODY_IMPL(sqrt, sin, cos)
+
+#define COUPLE_REAL_SIMD_LIBM_BODY \
+  COUPLE_REAL_BODY_IMPL(fastmath::sqrt, rajaperf_libmvec_sin, rajaperf_libmvec_cos)
+
+#define COUPLE_REAL_POLY_BODY(ulps) \
+  COUPLE_REAL_BODY_IMPL(fastmath::sqrt, fastmath::sin<ulps>, fastmath::cos<ulps>)
+
+
+#include "common/KernelBase.hpp"
+#include "common/FastMath.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+class COUPLE_REAL : public KernelBase
+{
+public:
+
+  COUPLE_REAL(const RunParams& params);
+
+  ~COUPLE_REAL();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  COUPLE_REAL : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  COUPLE_REAL : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  COUPLE_REAL : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantSIMDLibm(VariantID vid);
+  template < size_t ulps >
+  void runSeqVariantPoly(VariantID vid);
+
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantSIMDLibm(VariantID vid);
+  template < size_t ulps >
+  void runOpenMPVariantPoly(VariantID vid);
+
+private:
+  // iterations per omp simd loop in the RAJA OpenMP simd_libm variant
+  static const Index_type simd_chunk_size = 1024;
+
+  Real_ptr m_c1;
+  Real_ptr m_c2;
+  Real_ptr m_x0;
+  Real_ptr m_x1;
+  Real_ptr m_y0;
+  Real_ptr m_y1;
+
+  Real_type m_half_dt;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/IndexTypeUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +20,8 @@ namespace apps
 {
 
 
-void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Loop_index_type >
+void HALOEXCHANGE::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -36,11 +39,11 @@ void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
           Int_ptr list = pack_index_lists[l];
-          Index_type  len  = pack_index_list_lengths[l];
+          Loop_index_type len = static_cast<Loop_index_type>(pack_index_list_lengths[l]);
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
             #pragma omp parallel for
-            for (Index_type i = 0; i < len; i++) {
+            for (Loop_index_type i = 0; i < len; i++) {
               HALOEXCHANGE_PACK_BODY;
             }
             buffer += len;
@@ -50,11 +53,11 @@ void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
           Int_ptr list = unpack_index_lists[l];
-          Index_type  len  = unpack_index_list_lengths[l];
+          Loop_index_type len = static_cast<Loop_index_type>(unpack_index_list_lengths[l]);
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
             #pragma omp parallel for
-            for (Index_type i = 0; i < len; i++) {
+            for (Loop_index_type i = 0; i < len; i++) {
               HALOEXCHANGE_UNPACK_BODY;
             }
             buffer += len;
@@ -75,14 +78,14 @@ void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
           Int_ptr list = pack_index_lists[l];
-          Index_type  len  = pack_index_list_lengths[l];
+          Loop_index_type len = static_cast<Loop_index_type>(pack_index_list_lengths[l]);
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
-            auto haloexchange_pack_base_lam = [=](Index_type i) {
+            auto haloexchange_pack_base_lam = [=](Loop_index_type i) {
                   HALOEXCHANGE_PACK_BODY;
                 };
             #pragma omp parallel for
-            for (Index_type i = 0; i < len; i++) {
+            for (Loop_index_type i = 0; i < len; i++) {
               haloexchange_pack_base_lam(i);
             }
             buffer += len;
@@ -92,14 +95,14 @@ void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
           Int_ptr list = unpack_index_lists[l];
-          Index_type  len  = unpack_index_list_lengths[l];
+          Loop_index_type len = static_cast<Loop_index_type>(unpack_index_list_lengths[l]);
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
-            auto haloexchange_unpack_base_lam = [=](Index_type i) {
+            auto haloexchange_unpack_base_lam = [=](Loop_index_type i) {
                   HALOEXCHANGE_UNPACK_BODY;
                 };
             #pragma omp parallel for
-            for (Index_type i = 0; i < len; i++) {
+            for (Loop_index_type i = 0; i < len; i++) {
               haloexchange_unpack_base_lam(i);
             }
             buffer += len;
@@ -122,14 +125,14 @@ void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
           Int_ptr list = pack_index_lists[l];
-          Index_type  len  = pack_index_list_lengths[l];
+          Loop_index_type len = static_cast<Loop_index_type>(pack_index_list_lengths[l]);
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
-            auto haloexchange_pack_base_lam = [=](Index_type i) {
+            auto haloexchange_pack_base_lam = [=](Loop_index_type i) {
                   HALOEXCHANGE_PACK_BODY;
                 };
             RAJA::forall<EXEC_POL>(
-                RAJA::TypedRangeSegment<Index_type>(0, len),
+                RAJA::TypedRangeSegment<Loop_index_type>(0, len),
                 haloexchange_pack_base_lam );
             buffer += len;
           }
@@ -138,14 +141,14 @@ void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
           Int_ptr list = unpack_index_lists[l];
-          Index_type  len  = unpack_index_list_lengths[l];
+          Loop_index_type len = static_cast<Loop_index_type>(unpack_index_list_lengths[l]);
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
-            auto haloexchange_unpack_base_lam = [=](Index_type i) {
+            auto haloexchange_unpack_base_lam = [=](Loop_index_type i) {
                   HALOEXCHANGE_UNPACK_BODY;
                 };
             RAJA::forall<EXEC_POL>(
-                RAJA::TypedRangeSegment<Index_type>(0, len),
+                RAJA::TypedRangeSegment<Loop_index_type>(0, len),
                 haloexchange_unpack_base_lam );
             buffer += len;
           }
@@ -168,5 +171,7 @@ void HALOEXCHANGE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
 #endif
 }
 
+RAJAPERF_OPENMP_INDEX_TYPE_TUNING_DEFINE_BOILERPLATE(HALOEXCHANGE)
+
 } // end namespace apps
 } // end namespace rajaperf
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/IndexTypeUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +20,8 @@ namespace apps
 {
 
 
-void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Loop_index_type >
+void HALOEXCHANGE::runSeqVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
 
@@ -34,10 +37,10 @@ void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
           Int_ptr list = pack_index_lists[l];
-          Index_type  len  = pack_index_list_lengths[l];
+          Loop_index_type len = static_cast<Loop_index_type>(pack_index_list_lengths[l]);
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
-            for (Index_type i = 0; i < len; i++) {
+            for (Loop_index_type i = 0; i < len; i++) {
               HALOEXCHANGE_PACK_BODY;
             }
             buffer += len;
@@ -47,10 +50,10 @@ void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
           Int_ptr list = unpack_index_lists[l];
-          Index_type  len  = unpack_index_list_lengths[l];
+          Loop_index_type len = static_cast<Loop_index_type>(unpack_index_list_lengths[l]);
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
-            for (Index_type i = 0; i < len; i++) {
+            for (Loop_index_type i = 0; i < len; i++) {
               HALOEXCHANGE_UNPACK_BODY;
             }
             buffer += len;
@@ -72,13 +75,13 @@ void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
           Int_ptr list = pack_index_lists[l];
-          Index_type  len  = pack_index_list_lengths[l];
+          Loop_index_type len = static_cast<Loop_index_type>(pack_index_list_lengths[l]);
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
-            auto haloexchange_pack_base_lam = [=](Index_type i) {
+            auto haloexchange_pack_base_lam = [=](Loop_index_type i) {
                   HALOEXCHANGE_PACK_BODY;
                 };
-            for (Index_type i = 0; i < len; i++) {
+            for (Loop_index_type i = 0; i < len; i++) {
               haloexchange_pack_base_lam(i);
             }
             buffer += len;
@@ -88,13 +91,13 @@ void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
           Int_ptr list = unpack_index_lists[l];
-          Index_type  len  = unpack_index_list_lengths[l];
+          Loop_index_type len = static_cast<Loop_index_type>(unpack_index_list_lengths[l]);
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
-            auto haloexchange_unpack_base_lam = [=](Index_type i) {
+            auto haloexchange_unpack_base_lam = [=](Loop_index_type i) {
                   HALOEXCHANGE_UNPACK_BODY;
                 };
-            for (Index_type i = 0; i < len; i++) {
+            for (Loop_index_type i = 0; i < len; i++) {
               haloexchange_unpack_base_lam(i);
             }
             buffer += len;
@@ -117,14 +120,14 @@ void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
           Int_ptr list = pack_index_lists[l];
-          Index_type  len  = pack_index_list_lengths[l];
+          Loop_index_type len = static_cast<Loop_index_type>(pack_index_list_lengths[l]);
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
-            auto haloexchange_pack_base_lam = [=](Index_type i) {
+            auto haloexchange_pack_base_lam = [=](Loop_index_type i) {
                   HALOEXCHANGE_PACK_BODY;
                 };
             RAJA::forall<EXEC_POL>(
-                RAJA::TypedRangeSegment<Index_type>(0, len),
+                RAJA::TypedRangeSegment<Loop_index_type>(0, len),
                 haloexchange_pack_base_lam );
             buffer += len;
           }
@@ -133,14 +136,14 @@ void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
         for (Index_type l = 0; l < num_neighbors; ++l) {
           Real_ptr buffer = buffers[l];
           Int_ptr list = unpack_index_lists[l];
-          Index_type  len  = unpack_index_list_lengths[l];
+          Loop_index_type len = static_cast<Loop_index_type>(unpack_index_list_lengths[l]);
           for (Index_type v = 0; v < num_vars; ++v) {
             Real_ptr var = vars[v];
-            auto haloexchange_unpack_base_lam = [=](Index_type i) {
+            auto haloexchange_unpack_base_lam = [=](Loop_index_type i) {
                   HALOEXCHANGE_UNPACK_BODY;
                 };
             RAJA::forall<EXEC_POL>(
-                RAJA::TypedRangeSegment<Index_type>(0, len),
+                RAJA::TypedRangeSegment<Loop_index_type>(0, len),
                 haloexchange_unpack_base_lam );
             buffer += len;
           }
@@ -161,5 +164,7 @@ void HALOEXCHANGE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
 }
 
+RAJAPERF_SEQ_INDEX_TYPE_TUNING_DEFINE_BOILERPLATE(HALOEXCHANGE)
+
 } // end namespace apps
 } // end namespace rajaperf
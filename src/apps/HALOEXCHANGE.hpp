@@ -41,6 +41,9 @@
 ///   }
 /// }
 ///
+/// The Seq and OpenMP variants have an 'int32' tuning (--index_type) that
+/// runs the loops over i with Int_type indices and trip counts.
+///
 
 #ifndef RAJAPerf_Apps_HALOEXCHANGE_HPP
 #define RAJAPerf_Apps_HALOEXCHANGE_HPP
@@ -94,6 +97,12 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  template < typename Loop_index_type >
+  void runSeqVariantImpl(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  template < typename Loop_index_type >
+  void runOpenMPVariantImpl(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/OpenMPUtils.hpp"
+
 #include "AppsData.hpp"
 
 #include <iostream>
@@ -20,15 +22,16 @@ namespace apps
 {
 
 
-void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Loop_index_type, bool runtime_schedule >
+void NODAL_ACCUMULATION_3D::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
   const Index_type run_reps = getRunReps();
-  const Index_type ibegin = 0;
-  const Index_type iend = m_domain->n_real_zones;
+  const Loop_index_type ibegin = 0;
+  const Loop_index_type iend = static_cast<Loop_index_type>(m_domain->n_real_zones);
 
-  NODAL_ACCUMULATION_3D_DATA_SETUP;
+  NODAL_ACCUMULATION_3D_INDEX_TYPE_DATA_SETUP(Loop_index_type);
 
   NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ;
 
@@ -40,28 +43,54 @@ void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUS
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
-          NODAL_ACCUMULATION_3D_BODY_INDEX;
-
-          Real_type val = 0.125 * vol[i];
-
-          #pragma omp atomic
-          x0[i] += val;
-          #pragma omp atomic
-          x1[i] += val;
-          #pragma omp atomic
-          x2[i] += val;
-          #pragma omp atomic
-          x3[i] += val;
-          #pragma omp atomic
-          x4[i] += val;
-          #pragma omp atomic
-          x5[i] += val;
-          #pragma omp atomic
-          x6[i] += val;
-          #pragma omp atomic
-          x7[i] += val;
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime)
+          for (Loop_index_type ii = ibegin ; ii < iend ; ++ii ) {
+            NODAL_ACCUMULATION_3D_INDEX_TYPE_BODY_INDEX(Loop_index_type);
+
+            Real_type val = 0.125 * vol[i];
+
+            #pragma omp atomic
+            x0[i] += val;
+            #pragma omp atomic
+            x1[i] += val;
+            #pragma omp atomic
+            x2[i] += val;
+            #pragma omp atomic
+            x3[i] += val;
+            #pragma omp atomic
+            x4[i] += val;
+            #pragma omp atomic
+            x5[i] += val;
+            #pragma omp atomic
+            x6[i] += val;
+            #pragma omp atomic
+            x7[i] += val;
+          }
+        } else {
+          #pragma omp parallel for
+          for (Loop_index_type ii = ibegin ; ii < iend ; ++ii ) {
+            NODAL_ACCUMULATION_3D_INDEX_TYPE_BODY_INDEX(Loop_index_type);
+
+            Real_type val = 0.125 * vol[i];
+
+            #pragma omp atomic
+            x0[i] += val;
+            #pragma omp atomic
+            x1[i] += val;
+            #pragma omp atomic
+            x2[i] += val;
+            #pragma omp atomic
+            x3[i] += val;
+            #pragma omp atomic
+            x4[i] += val;
+            #pragma omp atomic
+            x5[i] += val;
+            #pragma omp atomic
+            x6[i] += val;
+            #pragma omp atomic
+            x7[i] += val;
+          }
         }
 
       }
@@ -72,8 +101,8 @@ void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUS
 
     case Lambda_OpenMP : {
 
-      auto nodal_accumulation_3d_lam = [=](Index_type ii) {
-            NODAL_ACCUMULATION_3D_BODY_INDEX;
+      auto nodal_accumulation_3d_lam = [=](Loop_index_type ii) {
+            NODAL_ACCUMULATION_3D_INDEX_TYPE_BODY_INDEX(Loop_index_type);
 
             Real_type val = 0.125 * vol[i];
 
@@ -98,9 +127,16 @@ void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUS
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
-          nodal_accumulation_3d_lam(ii);
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime)
+          for (Loop_index_type ii = ibegin ; ii < iend ; ++ii ) {
+            nodal_accumulation_3d_lam(ii);
+          }
+        } else {
+          #pragma omp parallel for
+          for (Loop_index_type ii = ibegin ; ii < iend ; ++ii ) {
+            nodal_accumulation_3d_lam(ii);
+          }
         }
 
       }
@@ -112,18 +148,18 @@ void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUS
     case RAJA_OpenMP : {
 
       camp::resources::Resource working_res{camp::resources::Host()};
-      RAJA::TypedListSegment<Index_type> zones(m_domain->real_zones,
-                                               m_domain->n_real_zones,
-                                               working_res);
+      RAJA::TypedListSegment<Loop_index_type> zones(real_zones,
+                                                    m_domain->n_real_zones,
+                                                    working_res);
 
-      auto nodal_accumulation_3d_lam = [=](Index_type i) {
+      auto nodal_accumulation_3d_lam = [=](Loop_index_type i) {
                                          NODAL_ACCUMULATION_3D_RAJA_ATOMIC_BODY(RAJA::omp_atomic);
                                        };
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::forall<omp_schedule::parallel_for_exec<runtime_schedule>>(
           zones, nodal_accumulation_3d_lam);
 
       }
@@ -143,5 +179,7 @@ void NODAL_ACCUMULATION_3D::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUS
 #endif
 }
 
+RAJAPERF_OPENMP_SCHEDULE_INDEX_TYPE_TUNING_DEFINE_BOILERPLATE(NODAL_ACCUMULATION_3D)
+
 } // end namespace apps
 } // end namespace rajaperf
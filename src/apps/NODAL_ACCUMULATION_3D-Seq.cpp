@@ -20,13 +20,14 @@ namespace apps
 {
 
 
-void NODAL_ACCUMULATION_3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Loop_index_type >
+void NODAL_ACCUMULATION_3D::runSeqVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
-  const Index_type ibegin = 0;
-  const Index_type iend = m_domain->n_real_zones;
+  const Loop_index_type ibegin = 0;
+  const Loop_index_type iend = static_cast<Loop_index_type>(m_domain->n_real_zones);
 
-  NODAL_ACCUMULATION_3D_DATA_SETUP;
+  NODAL_ACCUMULATION_3D_INDEX_TYPE_DATA_SETUP(Loop_index_type);
 
   NDPTRSET(m_domain->jp, m_domain->kp, x,x0,x1,x2,x3,x4,x5,x6,x7) ;
 
@@ -37,8 +38,8 @@ void NODAL_ACCUMULATION_3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
-          NODAL_ACCUMULATION_3D_BODY_INDEX;
+        for (Loop_index_type ii = ibegin ; ii < iend ; ++ii ) {
+          NODAL_ACCUMULATION_3D_INDEX_TYPE_BODY_INDEX(Loop_index_type);
           NODAL_ACCUMULATION_3D_BODY;
         }
 
@@ -51,15 +52,15 @@ void NODAL_ACCUMULATION_3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_
 #if defined(RUN_RAJA_SEQ)
     case Lambda_Seq : {
 
-      auto nodal_accumulation_3d_lam = [=](Index_type ii) {
-                         NODAL_ACCUMULATION_3D_BODY_INDEX;
+      auto nodal_accumulation_3d_lam = [=](Loop_index_type ii) {
+                         NODAL_ACCUMULATION_3D_INDEX_TYPE_BODY_INDEX(Loop_index_type);
                          NODAL_ACCUMULATION_3D_BODY;
                        };
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        for (Index_type ii = ibegin ; ii < iend ; ++ii ) {
+        for (Loop_index_type ii = ibegin ; ii < iend ; ++ii ) {
           nodal_accumulation_3d_lam(ii);
         }
 
@@ -72,11 +73,11 @@ void NODAL_ACCUMULATION_3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_
     case RAJA_Seq : {
 
       camp::resources::Resource working_res{camp::resources::Host()};
-      RAJA::TypedListSegment<Index_type> zones(m_domain->real_zones,
-                                               m_domain->n_real_zones,
-                                               working_res);
+      RAJA::TypedListSegment<Loop_index_type> zones(real_zones,
+                                                    m_domain->n_real_zones,
+                                                    working_res);
 
-      auto nodal_accumulation_3d_lam = [=](Index_type i) {
+      auto nodal_accumulation_3d_lam = [=](Loop_index_type i) {
                          NODAL_ACCUMULATION_3D_RAJA_ATOMIC_BODY(RAJA::seq_atomic);
                        };
 
@@ -100,5 +101,7 @@ void NODAL_ACCUMULATION_3D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_
 
 }
 
+RAJAPERF_SEQ_INDEX_TYPE_TUNING_DEFINE_BOILERPLATE(NODAL_ACCUMULATION_3D)
+
 } // end namespace apps
 } // end namespace rajaperf
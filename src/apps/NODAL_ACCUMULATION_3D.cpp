@@ -74,10 +74,19 @@ NODAL_ACCUMULATION_3D::~NODAL_ACCUMULATION_3D()
   delete m_domain;
 }
 
-void NODAL_ACCUMULATION_3D::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void NODAL_ACCUMULATION_3D::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitDataConst(m_x, m_nodal_array_length, 0.0, vid);
   allocAndInitDataConst(m_vol, m_zonal_array_length, 1.0, vid);
+
+  if ( index_type::isTuning(getVariantTuningName(vid, tune_idx)) ) {
+    allocData(m_real_zones_int, m_domain->n_real_zones);
+    for (Index_type ii = 0; ii < m_domain->n_real_zones; ++ii) {
+      m_real_zones_int[ii] = static_cast<Int_type>(m_domain->real_zones[ii]);
+    }
+    recordBytesSaved(vid, tune_idx,
+                     (sizeof(Index_type) - sizeof(Int_type)) * getItsPerRep());
+  }
 }
 
 void NODAL_ACCUMULATION_3D::updateChecksum(VariantID vid, size_t tune_idx)
@@ -85,12 +94,14 @@ void NODAL_ACCUMULATION_3D::updateChecksum(VariantID vid, size_t tune_idx)
   checksum[vid].at(tune_idx) += calcChecksum(m_x, m_nodal_array_length, checksum_scale_factor );
 }
 
-void NODAL_ACCUMULATION_3D::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void NODAL_ACCUMULATION_3D::tearDown(VariantID vid, size_t tune_idx)
 {
-  (void) vid;
-
   deallocData(m_x);
   deallocData(m_vol);
+
+  if ( index_type::isTuning(getVariantTuningName(vid, tune_idx)) ) {
+    deallocData(m_real_zones_int);
+  }
 }
 
 } // end namespace apps
@@ -27,6 +27,9 @@
 ///
 /// }
 ///
+/// The Seq and OpenMP variants have an 'int32' tuning (--index_type) that
+/// runs the loop and gathers through a copy of real_zones in Int_type.
+///
 
 #ifndef RAJAPerf_Apps_NODAL_ACCUMULATION_3D_HPP
 #define RAJAPerf_Apps_NODAL_ACCUMULATION_3D_HPP
@@ -42,6 +45,20 @@
 #define NODAL_ACCUMULATION_3D_BODY_INDEX \
   Index_type i = real_zones[ii];
 
+// the zone list and zone index in the type of an index type tuning
+// (see common/IndexTypeUtils.hpp)
+#define NODAL_ACCUMULATION_3D_INDEX_TYPE_DATA_SETUP(Loop_index_type) \
+  Real_ptr x = m_x; \
+  Real_ptr vol = m_vol; \
+  \
+  Real_ptr x0,x1,x2,x3,x4,x5,x6,x7; \
+  \
+  Loop_index_type* real_zones = \
+    index_type::getIndexList<Loop_index_type>(m_domain->real_zones, m_real_zones_int);
+
+#define NODAL_ACCUMULATION_3D_INDEX_TYPE_BODY_INDEX(Loop_index_type) \
+  Loop_index_type i = real_zones[ii];
+
 #define NODAL_ACCUMULATION_3D_BODY \
   Real_type val = 0.125 * vol[i]; \
   \
@@ -69,6 +86,7 @@
 
 
 #include "common/KernelBase.hpp"
+#include "common/IndexTypeUtils.hpp"
 
 namespace rajaperf
 {
@@ -96,6 +114,12 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  template < typename Loop_index_type >
+  void runSeqVariantImpl(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  template < typename Loop_index_type, bool runtime_schedule >
+  void runOpenMPVariantImpl(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
@@ -111,6 +135,7 @@ private:
   Real_ptr m_vol;
 
   ADomain* m_domain;
+  Int_ptr m_real_zones_int;
   Index_type m_nodal_array_length;
   Index_type m_zonal_array_length;
 };
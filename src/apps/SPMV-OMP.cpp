@@ -0,0 +1,332 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SPMV.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/OpenMPUtils.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+template < bool runtime_schedule >
+void SPMV::runOpenMPVariantCSR(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  SPMV_DATA_SETUP;
+  SPMV_CSR_DATA_SETUP;
+
+  auto spmv_csr_lam = [=](Index_type i) {
+                        SPMV_CSR_BODY;
+                      };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime)
+          for (Index_type i = 0; i < nrows; ++i ) {
+            SPMV_CSR_BODY;
+          }
+        } else {
+          #pragma omp parallel for
+          for (Index_type i = 0; i < nrows; ++i ) {
+            SPMV_CSR_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime)
+          for (Index_type i = 0; i < nrows; ++i ) {
+            spmv_csr_lam(i);
+          }
+        } else {
+          #pragma omp parallel for
+          for (Index_type i = 0; i < nrows; ++i ) {
+            spmv_csr_lam(i);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<omp_schedule::parallel_for_exec<runtime_schedule>>(
+          RAJA::RangeSegment(0, nrows), spmv_csr_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SPMV : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+template < bool runtime_schedule >
+void SPMV::runOpenMPVariantELL(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  SPMV_DATA_SETUP;
+  SPMV_ELL_DATA_SETUP;
+
+  auto spmv_ell_lam = [=](Index_type i) {
+                        SPMV_ELL_BODY;
+                      };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime)
+          for (Index_type i = 0; i < nrows; ++i ) {
+            SPMV_ELL_BODY;
+          }
+        } else {
+          #pragma omp parallel for
+          for (Index_type i = 0; i < nrows; ++i ) {
+            SPMV_ELL_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime)
+          for (Index_type i = 0; i < nrows; ++i ) {
+            spmv_ell_lam(i);
+          }
+        } else {
+          #pragma omp parallel for
+          for (Index_type i = 0; i < nrows; ++i ) {
+            spmv_ell_lam(i);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<omp_schedule::parallel_for_exec<runtime_schedule>>(
+          RAJA::RangeSegment(0, nrows), spmv_ell_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SPMV : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+template < size_t sell_chunk, bool runtime_schedule >
+void SPMV::runOpenMPVariantSELL(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  SPMV_DATA_SETUP;
+  SPMV_SELL_DATA_SETUP;
+
+  auto spmv_sell_lam = [=](Index_type s) {
+                         SPMV_SELL_BODY(sell_chunk);
+                       };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime)
+          for (Index_type s = 0; s < nslices; ++s ) {
+            SPMV_SELL_BODY(sell_chunk);
+          }
+        } else {
+          #pragma omp parallel for
+          for (Index_type s = 0; s < nslices; ++s ) {
+            SPMV_SELL_BODY(sell_chunk);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime)
+          for (Index_type s = 0; s < nslices; ++s ) {
+            spmv_sell_lam(s);
+          }
+        } else {
+          #pragma omp parallel for
+          for (Index_type s = 0; s < nslices; ++s ) {
+            spmv_sell_lam(s);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<omp_schedule::parallel_for_exec<runtime_schedule>>(
+          RAJA::RangeSegment(0, nslices), spmv_sell_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  SPMV : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+template < bool runtime_schedule >
+void SPMV::runOpenMPVariantFormat(VariantID vid, size_t tune_idx)
+{
+  Tuning const& tuning = m_tunings[tune_idx];
+
+  switch ( tuning.format ) {
+
+    case Format::csr : {
+      runOpenMPVariantCSR<runtime_schedule>(vid);
+      break;
+    }
+
+    case Format::ell : {
+      runOpenMPVariantELL<runtime_schedule>(vid);
+      break;
+    }
+
+    case Format::sell : {
+      seq_for(sell_chunks_type{}, [&](auto sell_chunk) {
+        if ( tuning.sell_chunk == Index_type(sell_chunk) ) {
+          runOpenMPVariantSELL<sell_chunk, runtime_schedule>(vid);
+        }
+      });
+      break;
+    }
+
+  }
+}
+
+void SPMV::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  Tuning const& tuning = m_tunings[tune_idx];
+
+  // the row chunk tunings hand out rows dynamically, the others run the
+  // loops with no schedule clause
+  if ( tuning.omp_row_chunk > 0 ) {
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    omp_schedule::RuntimeScheduleScope schedule(
+        omp_sched_dynamic, static_cast<int>(tuning.omp_row_chunk));
+#endif
+    runOpenMPVariantFormat<true>(vid, tune_idx);
+  } else {
+    runOpenMPVariantFormat<false>(vid, tune_idx);
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
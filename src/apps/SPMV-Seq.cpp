@@ -0,0 +1,253 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SPMV.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void SPMV::runSeqVariantCSR(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  SPMV_DATA_SETUP;
+  SPMV_CSR_DATA_SETUP;
+
+  auto spmv_csr_lam = [=](Index_type i) {
+                        SPMV_CSR_BODY;
+                      };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < nrows; ++i ) {
+          SPMV_CSR_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < nrows; ++i ) {
+          spmv_csr_lam(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nrows), spmv_csr_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  SPMV : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void SPMV::runSeqVariantELL(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  SPMV_DATA_SETUP;
+  SPMV_ELL_DATA_SETUP;
+
+  auto spmv_ell_lam = [=](Index_type i) {
+                        SPMV_ELL_BODY;
+                      };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < nrows; ++i ) {
+          SPMV_ELL_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = 0; i < nrows; ++i ) {
+          spmv_ell_lam(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nrows), spmv_ell_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  SPMV : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+template < size_t sell_chunk >
+void SPMV::runSeqVariantSELL(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  SPMV_DATA_SETUP;
+  SPMV_SELL_DATA_SETUP;
+
+  auto spmv_sell_lam = [=](Index_type s) {
+                         SPMV_SELL_BODY(sell_chunk);
+                       };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type s = 0; s < nslices; ++s ) {
+          SPMV_SELL_BODY(sell_chunk);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type s = 0; s < nslices; ++s ) {
+          spmv_sell_lam(s);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nslices), spmv_sell_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  SPMV : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void SPMV::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  Tuning const& tuning = m_tunings[tune_idx];
+
+  switch ( tuning.format ) {
+
+    case Format::csr : {
+      runSeqVariantCSR(vid);
+      break;
+    }
+
+    case Format::ell : {
+      runSeqVariantELL(vid);
+      break;
+    }
+
+    case Format::sell : {
+      seq_for(sell_chunks_type{}, [&](auto sell_chunk) {
+        if ( tuning.sell_chunk == Index_type(sell_chunk) ) {
+          runSeqVariantSELL<sell_chunk>(vid);
+        }
+      });
+      break;
+    }
+
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,303 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SPMV.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <utility>
+
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+SPMV::SPMV(const RunParams& params)
+  : KernelBase(rajaperf::Apps_SPMV, params)
+{
+  setDefaultProblemSize(100*100*100);
+  setDefaultReps(50);
+
+  m_n = std::max(Index_type(std::cbrt(getTargetProblemSize()) + 0.5),
+                 Index_type(1));
+  m_nrows = m_n * m_n * m_n;
+
+  m_stencil = params.getSpMVStencil();
+  m_random_ordering = params.getSpMVRandomOrdering();
+
+  // each stencil offset connects (n - |di|)*(n - |dj|)*(n - |dk|) points
+  m_nnz = 0;
+  for (Index_type dk = -1; dk <= 1; ++dk) {
+    for (Index_type dj = -1; dj <= 1; ++dj) {
+      for (Index_type di = -1; di <= 1; ++di) {
+        if ( m_stencil == 27 || std::abs(di) + std::abs(dj) + std::abs(dk) <= 1 ) {
+          m_nnz += (m_n - std::abs(di)) * (m_n - std::abs(dj)) *
+                   (m_n - std::abs(dk));
+        }
+      }
+    }
+  }
+
+  setActualProblemSize( m_nrows );
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  // CSR matrix data, the same for each format to give effective bandwidth
+  setBytesPerRep( (1*sizeof(Real_type) + 0*sizeof(Real_type)) * m_nrows +
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nrows +
+                  (0*sizeof(Int_type) + 1*sizeof(Int_type)) * (m_nrows+1) +
+                  (0*sizeof(Int_type) + 1*sizeof(Int_type)) * m_nnz +
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * m_nnz );
+  setFLOPsPerRep(2 * m_nnz);
+
+  m_tunings.push_back({Format::csr, 0, 0, "csr"});
+  m_tunings.push_back({Format::ell, 0, 0, "ell"});
+  seq_for(sell_chunks_type{}, [&](auto sell_chunk) {
+    m_tunings.push_back({Format::sell, Index_type(sell_chunk), 0,
+                         "sell_" + std::to_string(sell_chunk) +
+                         "_" + std::to_string(sell_sigma)});
+  });
+  m_num_seq_tunings = m_tunings.size();
+  for (Format format : {Format::csr, Format::ell}) {
+    for (Index_type omp_row_chunk : {64, 1024}) {
+      m_tunings.push_back({format, 0, omp_row_chunk,
+                           std::string(format == Format::csr ? "csr" : "ell") +
+                           "_chunk_" + std::to_string(omp_row_chunk)});
+    }
+  }
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+SPMV::~SPMV()
+{
+}
+
+void SPMV::setSeqTuningDefinitions(VariantID vid)
+{
+  for (Index_type t = 0; t < m_num_seq_tunings; ++t) {
+    addVariantTuningName(vid, m_tunings[t].name);
+  }
+}
+
+void SPMV::setOpenMPTuningDefinitions(VariantID vid)
+{
+  for (Tuning const& tuning : m_tunings) {
+    addVariantTuningName(vid, tuning.name);
+  }
+}
+
+//
+// Build the Laplacian in CSR format. Rows are grid points, row
+// i + n*(j + n*k) for point (i, j, k) in the natural ordering; the random
+// ordering renumbers rows and columns with the same random permutation.
+// Columns of each row are in increasing order.
+//
+void SPMV::buildCSR()
+{
+  const Index_type n = m_n;
+  const Index_type nrows = m_nrows;
+
+  Int_ptr perm = nullptr;
+  Int_ptr inv_perm = nullptr;
+  if ( m_random_ordering ) {
+    allocAndInitDataIndexPattern(perm, nrows, "random");
+    allocData(inv_perm, nrows);
+    for (Index_type r = 0; r < nrows; ++r) {
+      inv_perm[perm[r]] = r;
+    }
+  }
+
+  allocData(m_row_ptr, nrows+1);
+  allocData(m_col, m_nnz);
+  allocData(m_val, m_nnz);
+
+  std::vector<std::pair<Int_type, Real_type>> row;
+  m_row_ptr[0] = 0;
+  for (Index_type q = 0; q < nrows; ++q) {
+    const Index_type r = m_random_ordering ? inv_perm[q] : q;
+    const Index_type i = r % n;
+    const Index_type j = (r / n) % n;
+    const Index_type k = r / (n*n);
+
+    row.clear();
+    for (Index_type dk = -1; dk <= 1; ++dk) {
+      for (Index_type dj = -1; dj <= 1; ++dj) {
+        for (Index_type di = -1; di <= 1; ++di) {
+          if ( m_stencil != 27 && std::abs(di) + std::abs(dj) + std::abs(dk) > 1 ) {
+            continue;
+          }
+          if ( i+di < 0 || i+di >= n || j+dj < 0 || j+dj >= n ||
+               k+dk < 0 || k+dk >= n ) {
+            continue;
+          }
+          const Index_type c = (i+di) + n*((j+dj) + n*(k+dk));
+          row.emplace_back( m_random_ordering ? perm[c] : c,
+                            c == r ? Real_type(m_stencil - 1) : -1.0 );
+        }
+      }
+    }
+    std::sort(row.begin(), row.end());
+
+    Index_type e = m_row_ptr[q];
+    for (auto const& entry : row) {
+      m_col[e] = entry.first;
+      m_val[e] = entry.second;
+      ++e;
+    }
+    m_row_ptr[q+1] = e;
+  }
+
+  deallocData(perm);
+  deallocData(inv_perm);
+}
+
+//
+// Copy the CSR matrix to ELLPACK format, padding each row with zeros in the
+// column of its diagonal entry.
+//
+void SPMV::buildELL()
+{
+  const Index_type nrows = m_nrows;
+
+  m_ell_width = 0;
+  for (Index_type r = 0; r < nrows; ++r) {
+    m_ell_width = std::max(m_ell_width, Index_type(m_row_ptr[r+1] - m_row_ptr[r]));
+  }
+
+  allocData(m_ell_col, nrows * m_ell_width);
+  allocData(m_ell_val, nrows * m_ell_width);
+
+  for (Index_type r = 0; r < nrows; ++r) {
+    const Index_type len = m_row_ptr[r+1] - m_row_ptr[r];
+    for (Index_type k = 0; k < m_ell_width; ++k) {
+      m_ell_col[r + k*nrows] = (k < len) ? m_col[m_row_ptr[r] + k] : r;
+      m_ell_val[r + k*nrows] = (k < len) ? m_val[m_row_ptr[r] + k] : 0.0;
+    }
+  }
+}
+
+//
+// Copy the CSR matrix to SELL-C-sigma format with C = sell_chunk: rows are
+// sorted by decreasing length within each window of sell_sigma rows, and each
+// slice of sell_chunk sorted rows is stored column-major, padded to its
+// longest row.
+//
+void SPMV::buildSELL(Index_type sell_chunk)
+{
+  const Index_type nrows = m_nrows;
+
+  m_sell_nslices = (nrows + sell_chunk - 1) / sell_chunk;
+
+  auto row_len = [&](Index_type r) { return m_row_ptr[r+1] - m_row_ptr[r]; };
+
+  allocData(m_sell_perm, m_sell_nslices * sell_chunk);
+  for (Index_type q = 0; q < m_sell_nslices * sell_chunk; ++q) {
+    m_sell_perm[q] = (q < nrows) ? q : 0;
+  }
+  for (Index_type w = 0; w < nrows; w += sell_sigma) {
+    std::stable_sort(m_sell_perm + w, m_sell_perm + std::min(w + sell_sigma, nrows),
+                     [&](Int_type a, Int_type b) { return row_len(a) > row_len(b); });
+  }
+
+  allocData(m_sell_slice_ptr, m_sell_nslices + 1);
+  m_sell_slice_ptr[0] = 0;
+  for (Index_type s = 0; s < m_sell_nslices; ++s) {
+    Index_type width = 0;
+    for (Index_type q = s*sell_chunk; q < std::min((s+1)*sell_chunk, nrows); ++q) {
+      width = std::max(width, Index_type(row_len(m_sell_perm[q])));
+    }
+    m_sell_slice_ptr[s+1] = m_sell_slice_ptr[s] + width * sell_chunk;
+  }
+
+  allocData(m_sell_col, m_sell_slice_ptr[m_sell_nslices]);
+  allocData(m_sell_val, m_sell_slice_ptr[m_sell_nslices]);
+
+  for (Index_type s = 0; s < m_sell_nslices; ++s) {
+    const Index_type offset = m_sell_slice_ptr[s];
+    const Index_type width = (m_sell_slice_ptr[s+1] - offset) / sell_chunk;
+    for (Index_type r = 0; r < sell_chunk; ++r) {
+      const Index_type q = s*sell_chunk + r;
+      const Index_type row = m_sell_perm[q];
+      const Index_type len = (q < nrows) ? row_len(row) : 0;
+      for (Index_type k = 0; k < width; ++k) {
+        const Index_type e = offset + k*sell_chunk + r;
+        m_sell_col[e] = (k < len) ? m_col[m_row_ptr[row] + k] : row;
+        m_sell_val[e] = (k < len) ? m_val[m_row_ptr[row] + k] : 0.0;
+      }
+    }
+  }
+}
+
+void SPMV::setUp(VariantID vid, size_t tune_idx)
+{
+  buildCSR();
+
+  m_ell_width = 0;
+  m_ell_col = nullptr;
+  m_ell_val = nullptr;
+
+  m_sell_nslices = 0;
+  m_sell_slice_ptr = nullptr;
+  m_sell_perm = nullptr;
+  m_sell_col = nullptr;
+  m_sell_val = nullptr;
+
+  Tuning const& tuning = m_tunings[tune_idx];
+  if ( tuning.format == Format::ell ) {
+    buildELL();
+  } else if ( tuning.format == Format::sell ) {
+    buildSELL(tuning.sell_chunk);
+  }
+
+  allocAndInitData(m_x, m_nrows, vid);
+  allocAndInitDataConst(m_y, m_nrows, 0.0, vid);
+}
+
+void SPMV::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid].at(tune_idx) += calcChecksum(m_y, m_nrows);
+}
+
+void SPMV::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+
+  deallocData(m_x);
+  deallocData(m_y);
+
+  deallocData(m_row_ptr);
+  deallocData(m_col);
+  deallocData(m_val);
+
+  deallocData(m_ell_col);
+  deallocData(m_ell_val);
+
+  deallocData(m_sell_slice_ptr);
+  deallocData(m_sell_perm);
+  deallocData(m_sell_col);
+  deallocData(m_sell_val);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,204 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// SPMV kernel reference implementation (CSR format):
+///
+/// for (Index_type i = 0; i < nrows; ++i ) {
+///   Real_type dot = 0.0;
+///   for (Index_type k = row_ptr[i]; k < row_ptr[i+1]; ++k ) {
+///     dot += val[k] * x[col[k]];
+///   }
+///   y[i] = dot;
+/// }
+///
+/// The matrix is a 3D 7 or 27 point Laplacian on an n x n x n grid in the
+/// natural grid ordering or a random symmetric permutation of it (see the
+/// --spmv_stencil and --spmv_ordering command line options).
+///
+/// Tunings run the product with the matrix stored in different formats:
+///   csr -- compressed sparse row
+///   ell -- ELLPACK, every row padded to the longest row and stored
+///          column-major so consecutive rows are adjacent
+///   sell_<C>_<sigma> -- SELL-C-sigma, rows sorted by length within windows
+///                       of sigma rows, then stored as ELLPACK in slices of
+///                       C rows
+/// OpenMP variants also have 'csr_chunk_<R>' and 'ell_chunk_<R>' tunings
+/// that hand out rows to threads dynamically in chunks of R rows.
+///
+/// Each format stores the entries of a row in the same order and pads with
+/// zeros, so every format computes the same y. Bytes per rep are those of
+/// the CSR format, so the bandwidth report gives the effective bandwidth of
+/// each format.
+///
+
+#ifndef RAJAPerf_Apps_SPMV_HPP
+#define RAJAPerf_Apps_SPMV_HPP
+
+#define SPMV_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y; \
+  const Index_type nrows = m_nrows;
+
+#define SPMV_CSR_DATA_SETUP \
+  Int_ptr row_ptr = m_row_ptr; \
+  Int_ptr col = m_col; \
+  Real_ptr val = m_val;
+
+#define SPMV_ELL_DATA_SETUP \
+  Int_ptr ell_col = m_ell_col; \
+  Real_ptr ell_val = m_ell_val; \
+  const Index_type ell_width = m_ell_width;
+
+#define SPMV_SELL_DATA_SETUP \
+  Int_ptr sell_slice_ptr = m_sell_slice_ptr; \
+  Int_ptr sell_perm = m_sell_perm; \
+  Int_ptr sell_col = m_sell_col; \
+  Real_ptr sell_val = m_sell_val; \
+  const Index_type nslices = m_sell_nslices;
+
+#define SPMV_CSR_BODY \
+  Real_type dot = 0.0; \
+  for (Index_type k = row_ptr[i]; k < row_ptr[i+1]; ++k ) { \
+    dot += val[k] * x[col[k]]; \
+  } \
+  y[i] = dot;
+
+#define SPMV_ELL_BODY \
+  Real_type dot = 0.0; \
+  for (Index_type k = 0; k < ell_width; ++k ) { \
+    dot += ell_val[i + k*nrows] * x[ell_col[i + k*nrows]]; \
+  } \
+  y[i] = dot;
+
+// slice s of sell_chunk rows, the last slice is padded with zero rows
+#define SPMV_SELL_BODY(sell_chunk) \
+  Real_type dot[sell_chunk]; \
+  for (Index_type r = 0; r < Index_type(sell_chunk); ++r ) { \
+    dot[r] = 0.0; \
+  } \
+  const Index_type offset = sell_slice_ptr[s]; \
+  const Index_type width = (sell_slice_ptr[s+1] - offset) / sell_chunk; \
+  for (Index_type k = 0; k < width; ++k ) { \
+    for (Index_type r = 0; r < Index_type(sell_chunk); ++r ) { \
+      const Index_type e = offset + k*sell_chunk + r; \
+      dot[r] += sell_val[e] * x[sell_col[e]]; \
+    } \
+  } \
+  const Index_type rend = std::min(Index_type(sell_chunk), \
+                                   nrows - s*Index_type(sell_chunk)); \
+  for (Index_type r = 0; r < rend; ++r ) { \
+    y[sell_perm[s*sell_chunk + r]] = dot[r]; \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+class SPMV : public KernelBase
+{
+public:
+
+  enum struct Format { csr, ell, sell };
+
+  SPMV(const RunParams& params);
+
+  ~SPMV();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  SPMV : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+
+  void runSeqVariantCSR(VariantID vid);
+  void runSeqVariantELL(VariantID vid);
+  template < size_t sell_chunk >
+  void runSeqVariantSELL(VariantID vid);
+
+  template < bool runtime_schedule >
+  void runOpenMPVariantCSR(VariantID vid);
+  template < bool runtime_schedule >
+  void runOpenMPVariantELL(VariantID vid);
+  template < size_t sell_chunk, bool runtime_schedule >
+  void runOpenMPVariantSELL(VariantID vid);
+  template < bool runtime_schedule >
+  void runOpenMPVariantFormat(VariantID vid, size_t tune_idx);
+
+private:
+  struct Tuning
+  {
+    Format format;
+    Index_type sell_chunk;     // rows per SELL slice
+    Index_type omp_row_chunk;  // 0 -> no schedule clause, OpenMP only otherwise
+    std::string name;
+  };
+
+  using sell_chunks_type = camp::int_seq<size_t, 8, 32>;
+  static const Index_type sell_sigma = 256;
+
+  void buildCSR();
+  void buildELL();
+  void buildSELL(Index_type sell_chunk);
+
+  std::vector<Tuning> m_tunings;
+  Index_type m_num_seq_tunings;
+
+  Index_type m_n;
+  Index_type m_nrows;
+  Index_type m_nnz;
+  int m_stencil;
+  bool m_random_ordering;
+
+  Real_ptr m_x;
+  Real_ptr m_y;
+
+  Int_ptr m_row_ptr;
+  Int_ptr m_col;
+  Real_ptr m_val;
+
+  Index_type m_ell_width;
+  Int_ptr m_ell_col;
+  Real_ptr m_ell_val;
+
+  Index_type m_sell_nslices;
+  Int_ptr m_sell_slice_ptr;
+  Int_ptr m_sell_perm;
+  Int_ptr m_sell_col;
+  Real_ptr m_sell_val;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,233 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TRIDIAG_BATCH.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void TRIDIAG_BATCH::runOpenMPVariantThomas(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  TRIDIAG_BATCH_DATA_SETUP;
+  TRIDIAG_BATCH_THOMAS_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type s = 0; s < nsys; ++s ) {
+          TRIDIAG_BATCH_THOMAS_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      auto tridiag_thomas_lam = [=](Index_type s) {
+        TRIDIAG_BATCH_THOMAS_BODY;
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nsys), tridiag_thomas_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  TRIDIAG_BATCH : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void TRIDIAG_BATCH::runOpenMPVariantCyclicReduction(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  TRIDIAG_BATCH_DATA_SETUP;
+  TRIDIAG_BATCH_PCR_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type s = 0; s < nsys; ++s ) {
+          TRIDIAG_BATCH_PCR_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      auto tridiag_pcr_lam = [=](Index_type s) {
+        TRIDIAG_BATCH_PCR_BODY;
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nsys), tridiag_pcr_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  TRIDIAG_BATCH : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void TRIDIAG_BATCH::runOpenMPVariantInterleaved(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  TRIDIAG_BATCH_DATA_SETUP;
+  TRIDIAG_BATCH_INTERLEAVED_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type blk = 0; blk < nblocks; ++blk ) {
+          TRIDIAG_BATCH_INTERLEAVED_RANGE;
+          #pragma omp simd
+          for (Index_type s = sbegin; s < send; ++s ) {
+            TRIDIAG_BATCH_FIRST_BODY(TRIDIAG_BATCH_INTERLEAVED_IDX);
+          }
+          for (Index_type i = 1; i < n; ++i ) {
+            #pragma omp simd
+            for (Index_type s = sbegin; s < send; ++s ) {
+              TRIDIAG_BATCH_FORWARD_BODY(TRIDIAG_BATCH_INTERLEAVED_IDX);
+            }
+          }
+          for (Index_type i = n-2; i >= 0; --i ) {
+            #pragma omp simd
+            for (Index_type s = sbegin; s < send; ++s ) {
+              TRIDIAG_BATCH_BACKWARD_BODY(TRIDIAG_BATCH_INTERLEAVED_IDX);
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      auto tridiag_interleaved_lam = [=](Index_type blk) {
+        TRIDIAG_BATCH_INTERLEAVED_RANGE;
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(sbegin, send), [=](Index_type s) {
+          TRIDIAG_BATCH_FIRST_BODY(TRIDIAG_BATCH_INTERLEAVED_IDX);
+        });
+        for (Index_type i = 1; i < n; ++i ) {
+          RAJA::forall<RAJA::simd_exec>(
+            RAJA::RangeSegment(sbegin, send), [=](Index_type s) {
+            TRIDIAG_BATCH_FORWARD_BODY(TRIDIAG_BATCH_INTERLEAVED_IDX);
+          });
+        }
+        for (Index_type i = n-2; i >= 0; --i ) {
+          RAJA::forall<RAJA::simd_exec>(
+            RAJA::RangeSegment(sbegin, send), [=](Index_type s) {
+            TRIDIAG_BATCH_BACKWARD_BODY(TRIDIAG_BATCH_INTERLEAVED_IDX);
+          });
+        }
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nblocks), tridiag_interleaved_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  TRIDIAG_BATCH : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void TRIDIAG_BATCH::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  if ( tune_idx == 0 ) {
+    runOpenMPVariantThomas(vid);
+  } else if ( tune_idx == 1 ) {
+    runOpenMPVariantCyclicReduction(vid);
+  } else {
+    runOpenMPVariantInterleaved(vid);
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
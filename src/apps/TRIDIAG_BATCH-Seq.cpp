@@ -0,0 +1,218 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TRIDIAG_BATCH.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+void TRIDIAG_BATCH::runSeqVariantThomas(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  TRIDIAG_BATCH_DATA_SETUP;
+  TRIDIAG_BATCH_THOMAS_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type s = 0; s < nsys; ++s ) {
+          TRIDIAG_BATCH_THOMAS_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      auto tridiag_thomas_lam = [=](Index_type s) {
+        TRIDIAG_BATCH_THOMAS_BODY;
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nsys), tridiag_thomas_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  TRIDIAG_BATCH : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void TRIDIAG_BATCH::runSeqVariantCyclicReduction(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  TRIDIAG_BATCH_DATA_SETUP;
+  TRIDIAG_BATCH_PCR_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type s = 0; s < nsys; ++s ) {
+          TRIDIAG_BATCH_PCR_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      auto tridiag_pcr_lam = [=](Index_type s) {
+        TRIDIAG_BATCH_PCR_BODY;
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nsys), tridiag_pcr_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  TRIDIAG_BATCH : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void TRIDIAG_BATCH::runSeqVariantInterleaved(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  TRIDIAG_BATCH_DATA_SETUP;
+  TRIDIAG_BATCH_INTERLEAVED_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type blk = 0; blk < nblocks; ++blk ) {
+          TRIDIAG_BATCH_INTERLEAVED_RANGE;
+          for (Index_type s = sbegin; s < send; ++s ) {
+            TRIDIAG_BATCH_FIRST_BODY(TRIDIAG_BATCH_INTERLEAVED_IDX);
+          }
+          for (Index_type i = 1; i < n; ++i ) {
+            for (Index_type s = sbegin; s < send; ++s ) {
+              TRIDIAG_BATCH_FORWARD_BODY(TRIDIAG_BATCH_INTERLEAVED_IDX);
+            }
+          }
+          for (Index_type i = n-2; i >= 0; --i ) {
+            for (Index_type s = sbegin; s < send; ++s ) {
+              TRIDIAG_BATCH_BACKWARD_BODY(TRIDIAG_BATCH_INTERLEAVED_IDX);
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      auto tridiag_interleaved_lam = [=](Index_type blk) {
+        TRIDIAG_BATCH_INTERLEAVED_RANGE;
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(sbegin, send), [=](Index_type s) {
+          TRIDIAG_BATCH_FIRST_BODY(TRIDIAG_BATCH_INTERLEAVED_IDX);
+        });
+        for (Index_type i = 1; i < n; ++i ) {
+          RAJA::forall<RAJA::simd_exec>(
+            RAJA::RangeSegment(sbegin, send), [=](Index_type s) {
+            TRIDIAG_BATCH_FORWARD_BODY(TRIDIAG_BATCH_INTERLEAVED_IDX);
+          });
+        }
+        for (Index_type i = n-2; i >= 0; --i ) {
+          RAJA::forall<RAJA::simd_exec>(
+            RAJA::RangeSegment(sbegin, send), [=](Index_type s) {
+            TRIDIAG_BATCH_BACKWARD_BODY(TRIDIAG_BATCH_INTERLEAVED_IDX);
+          });
+        }
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nblocks), tridiag_interleaved_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  TRIDIAG_BATCH : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void TRIDIAG_BATCH::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  if ( tune_idx == 0 ) {
+    runSeqVariantThomas(vid);
+  } else if ( tune_idx == 1 ) {
+    runSeqVariantCyclicReduction(vid);
+  } else {
+    runSeqVariantInterleaved(vid);
+  }
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,150 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TRIDIAG_BATCH.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <vector>
+
+
+namespace rajaperf
+{
+namespace apps
+{
+
+
+TRIDIAG_BATCH::TRIDIAG_BATCH(const RunParams& params)
+  : KernelBase(rajaperf::Apps_TRIDIAG_BATCH, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(50);
+
+  m_system_size = params.getTridiagSystemSize();
+  m_num_systems = std::max(getTargetProblemSize() / m_system_size,
+                           Index_type(1));
+
+  setActualProblemSize( m_num_systems * m_system_size );
+
+  setItsPerRep( m_num_systems );
+  setKernelsPerRep(1);
+  // cyclic reduction: read a, b, c, d, write x, and write and read the
+  // 8*len scratch; the Thomas tunings move less, see setUp
+  setBytesPerRep( (1*sizeof(Real_type) + 4*sizeof(Real_type)) * getActualProblemSize() +
+                  (8*sizeof(Real_type) + 8*sizeof(Real_type)) * getActualProblemSize() );
+  setFLOPsPerRep(9 * getActualProblemSize());
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+TRIDIAG_BATCH::~TRIDIAG_BATCH()
+{
+}
+
+void TRIDIAG_BATCH::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "thomas");
+  addVariantTuningName(vid, "cyclic_reduction");
+  addVariantTuningName(vid, "interleaved");
+}
+
+void TRIDIAG_BATCH::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "thomas");
+  addVariantTuningName(vid, "cyclic_reduction");
+  addVariantTuningName(vid, "interleaved");
+}
+
+void TRIDIAG_BATCH::setUp(VariantID vid, size_t tune_idx)
+{
+  const Index_type n = m_system_size;
+  const Index_type nsys = m_num_systems;
+  const Index_type len = getActualProblemSize();
+
+  //
+  // |a| + |c| <= 0.4 < b, so the systems are diagonally dominant and
+  // need no pivoting. Equations are generated for the contiguous layout.
+  //
+  allocAndInitData(m_a, len, vid);
+  allocAndInitDataConst(m_b, len, 1.0, vid);
+  allocAndInitData(m_c, len, vid);
+  allocAndInitData(m_d, len, vid);
+  allocAndInitDataConst(m_x, len, 0.0, vid);
+  for (Index_type s = 0; s < nsys; ++s) {
+    m_a[s*n] = 0.0;
+    m_c[s*n + n-1] = 0.0;
+  }
+
+  if ( isInterleaved(vid, tune_idx) ) {
+    std::vector<Real_type> tmp(len);
+    for (Real_ptr v : {m_a, m_b, m_c, m_d}) {
+      for (Index_type s = 0; s < nsys; ++s) {
+        for (Index_type i = 0; i < n; ++i) {
+          tmp[i*nsys + s] = v[s*n + i];
+        }
+      }
+      std::copy(tmp.begin(), tmp.end(), v);
+    }
+  }
+
+  m_cp = nullptr;
+  m_pcr = nullptr;
+  if ( getVariantTuningName(vid, tune_idx) == "cyclic_reduction" ) {
+    allocAndInitDataConst(m_pcr, 8*len, 0.0, vid);
+  } else {
+    allocAndInitDataConst(m_cp, len, 0.0, vid);
+    // Thomas algorithm: read a, b, c, d, write cp, x, then read cp, x
+    const Index_type thomas_bytes =
+      (2*sizeof(Real_type) + 4*sizeof(Real_type)) * len +
+      (0*sizeof(Real_type) + 2*sizeof(Real_type)) * len;
+    recordBytesSaved(vid, tune_idx, getBytesPerRep() - thomas_bytes);
+  }
+}
+
+void TRIDIAG_BATCH::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  const Index_type n = m_system_size;
+  const Index_type nsys = m_num_systems;
+  const Index_type len = getActualProblemSize();
+
+  if ( isInterleaved(vid, tune_idx) ) {
+    std::vector<Real_type> x(len);
+    for (Index_type s = 0; s < nsys; ++s) {
+      for (Index_type i = 0; i < n; ++i) {
+        x[s*n + i] = m_x[i*nsys + s];
+      }
+    }
+    checksum[vid][tune_idx] += calcChecksum(x.data(), len);
+  } else {
+    checksum[vid][tune_idx] += calcChecksum(m_x, len);
+  }
+}
+
+void TRIDIAG_BATCH::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_a);
+  deallocData(m_b);
+  deallocData(m_c);
+  deallocData(m_d);
+  deallocData(m_x);
+  deallocData(m_cp);
+  deallocData(m_pcr);
+}
+
+} // end namespace apps
+} // end namespace rajaperf
@@ -0,0 +1,211 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// TRIDIAG_BATCH kernel reference implementation (Thomas algorithm):
+///
+/// for (Index_type s = 0; s < nsys; ++s ) {
+///   cp[s][0] = c[s][0] / b[s][0];
+///   x[s][0] = d[s][0] / b[s][0];
+///   for (Index_type i = 1; i < n; ++i ) {
+///     Real_type m = 1.0 / ( b[s][i] - a[s][i] * cp[s][i-1] );
+///     cp[s][i] = c[s][i] * m;
+///     x[s][i] = ( d[s][i] - a[s][i] * x[s][i-1] ) * m;
+///   }
+///   for (Index_type i = n-2; i >= 0; --i ) {
+///     x[s][i] -= cp[s][i] * x[s][i+1];
+///   }
+/// }
+///
+/// Solves nsys independent, diagonally dominant tridiagonal systems of n
+/// equations, a[s][i] x[s][i-1] + b[s][i] x[s][i] + c[s][i] x[s][i+1] = d[s][i].
+/// n is set by the --tridiag_system_size command line option and nsys is the
+/// problem size divided by n.
+///
+/// Tunings:
+///   thomas           -- the loops above, one system per iteration of the
+///                       parallel loop, each system stored contiguously
+///   cyclic_reduction -- parallel cyclic reduction of each system, log2(n)
+///                       steps that each update all n equations of a system
+///                       independently
+///   interleaved      -- Thomas with equation i of every system stored
+///                       together, x[i][s], so consecutive systems are in
+///                       consecutive SIMD lanes and each step of the solve
+///                       is vectorized across systems
+///
+/// The thomas and interleaved tunings give the same result; cyclic
+/// reduction matches them to rounding.
+///
+
+#ifndef RAJAPerf_Apps_TRIDIAG_BATCH_HPP
+#define RAJAPerf_Apps_TRIDIAG_BATCH_HPP
+
+#define TRIDIAG_BATCH_DATA_SETUP \
+  Real_ptr a = m_a; \
+  Real_ptr b = m_b; \
+  Real_ptr c = m_c; \
+  Real_ptr d = m_d; \
+  Real_ptr x = m_x; \
+  const Index_type n = m_system_size; \
+  const Index_type nsys = m_num_systems;
+
+#define TRIDIAG_BATCH_THOMAS_DATA_SETUP \
+  Real_ptr cp = m_cp;
+
+#define TRIDIAG_BATCH_PCR_DATA_SETUP \
+  Real_ptr pcr = m_pcr;
+
+#define TRIDIAG_BATCH_INTERLEAVED_DATA_SETUP \
+  TRIDIAG_BATCH_THOMAS_DATA_SETUP; \
+  const Index_type lanes = interleaved_lanes; \
+  const Index_type nblocks = (nsys + lanes - 1) / lanes;
+
+// index of equation i of system s in each layout
+#define TRIDIAG_BATCH_IDX(s, i)  ((s)*n + (i))
+#define TRIDIAG_BATCH_INTERLEAVED_IDX(s, i)  ((i)*nsys + (s))
+
+#define TRIDIAG_BATCH_FIRST_BODY(idx) \
+  cp[idx(s,0)] = c[idx(s,0)] / b[idx(s,0)]; \
+  x[idx(s,0)] = d[idx(s,0)] / b[idx(s,0)];
+
+#define TRIDIAG_BATCH_FORWARD_BODY(idx) \
+  const Real_type m = 1.0 / ( b[idx(s,i)] - a[idx(s,i)] * cp[idx(s,i-1)] ); \
+  cp[idx(s,i)] = c[idx(s,i)] * m; \
+  x[idx(s,i)] = ( d[idx(s,i)] - a[idx(s,i)] * x[idx(s,i-1)] ) * m;
+
+#define TRIDIAG_BATCH_BACKWARD_BODY(idx) \
+  x[idx(s,i)] -= cp[idx(s,i)] * x[idx(s,i+1)];
+
+#define TRIDIAG_BATCH_THOMAS_BODY \
+  TRIDIAG_BATCH_FIRST_BODY(TRIDIAG_BATCH_IDX); \
+  for (Index_type i = 1; i < n; ++i ) { \
+    TRIDIAG_BATCH_FORWARD_BODY(TRIDIAG_BATCH_IDX); \
+  } \
+  for (Index_type i = n-2; i >= 0; --i ) { \
+    TRIDIAG_BATCH_BACKWARD_BODY(TRIDIAG_BATCH_IDX); \
+  }
+
+// systems [sbegin, send) of block blk in the interleaved layout
+#define TRIDIAG_BATCH_INTERLEAVED_RANGE \
+  const Index_type sbegin = blk * lanes; \
+  const Index_type send = std::min(sbegin + lanes, nsys);
+
+//
+// One step of parallel cyclic reduction with stride h: equation i is
+// combined with equations i-h and i+h to eliminate x[i-h] and x[i+h].
+// Equations outside the system are x = 0 and drop out.
+//
+#define TRIDIAG_BATCH_PCR_STEP_BODY \
+  const Index_type il = (i >= h) ? i - h : i; \
+  const Index_type ir = (i + h < n) ? i + h : i; \
+  const Real_type alpha = (i >= h) ? -ar[i] / br[il] : 0.0; \
+  const Real_type gamma = (i + h < n) ? -cr[i] / br[ir] : 0.0; \
+  aw[i] = alpha * ar[il]; \
+  bw[i] = br[i] + alpha * cr[il] + gamma * ar[ir]; \
+  cw[i] = gamma * cr[ir]; \
+  dw[i] = dr[i] + alpha * dr[il] + gamma * dr[ir];
+
+// system s, each step reads one half of its 8*n scratch and writes the other
+#define TRIDIAG_BATCH_PCR_BODY \
+  const Index_type o = s*n; \
+  Real_ptr ar = a + o; \
+  Real_ptr br = b + o; \
+  Real_ptr cr = c + o; \
+  Real_ptr dr = d + o; \
+  Real_ptr w = pcr + 8*o; \
+  for (Index_type h = 1; h < n; h *= 2) { \
+    Real_ptr aw = w; \
+    Real_ptr bw = w + n; \
+    Real_ptr cw = w + 2*n; \
+    Real_ptr dw = w + 3*n; \
+    for (Index_type i = 0; i < n; ++i ) { \
+      TRIDIAG_BATCH_PCR_STEP_BODY; \
+    } \
+    ar = aw; \
+    br = bw; \
+    cr = cw; \
+    dr = dw; \
+    w = ( w == pcr + 8*o ) ? w + 4*n : pcr + 8*o; \
+  } \
+  for (Index_type i = 0; i < n; ++i ) { \
+    x[o+i] = dr[i] / br[i]; \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+#include <algorithm>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace apps
+{
+
+class TRIDIAG_BATCH : public KernelBase
+{
+public:
+
+  TRIDIAG_BATCH(const RunParams& params);
+
+  ~TRIDIAG_BATCH();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  TRIDIAG_BATCH : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  TRIDIAG_BATCH : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  TRIDIAG_BATCH : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+
+  void runSeqVariantThomas(VariantID vid);
+  void runSeqVariantCyclicReduction(VariantID vid);
+  void runSeqVariantInterleaved(VariantID vid);
+
+  void runOpenMPVariantThomas(VariantID vid);
+  void runOpenMPVariantCyclicReduction(VariantID vid);
+  void runOpenMPVariantInterleaved(VariantID vid);
+
+private:
+  static const Index_type interleaved_lanes = 64;
+
+  bool isInterleaved(VariantID vid, size_t tune_idx) const
+  { return getVariantTuningName(vid, tune_idx) == "interleaved"; }
+
+  Index_type m_system_size;
+  Index_type m_num_systems;
+
+  Real_ptr m_a;
+  Real_ptr m_b;
+  Real_ptr m_c;
+  Real_ptr m_d;
+  Real_ptr m_x;
+
+  Real_ptr m_cp;
+  Real_ptr m_pcr;
+};
+
+} // end namespace apps
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
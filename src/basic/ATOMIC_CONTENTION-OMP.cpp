@@ -0,0 +1,214 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "ATOMIC_CONTENTION.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+void ATOMIC_CONTENTION::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  ATOMIC_CONTENTION_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        switch ( op ) {
+
+          case AtomicOp::add : {
+            #pragma omp parallel for
+            for (Index_type i = ibegin; i < iend; ++i ) {
+              ATOMIC_CONTENTION_ADDRESS;
+              #pragma omp atomic
+              ATOMIC_CONTENTION_ADD_BODY;
+            }
+            break;
+          }
+
+          case AtomicOp::min : {
+            #pragma omp parallel for
+            for (Index_type i = ibegin; i < iend; ++i ) {
+              ATOMIC_CONTENTION_ADDRESS;
+              ATOMIC_CONTENTION_BUILTIN_CAS_LOOP(vals[i] < old, vals[i]);
+            }
+            break;
+          }
+
+          case AtomicOp::max : {
+            #pragma omp parallel for
+            for (Index_type i = ibegin; i < iend; ++i ) {
+              ATOMIC_CONTENTION_ADDRESS;
+              ATOMIC_CONTENTION_BUILTIN_CAS_LOOP(vals[i] > old, vals[i]);
+            }
+            break;
+          }
+
+          case AtomicOp::cas : {
+            #pragma omp parallel for
+            for (Index_type i = ibegin; i < iend; ++i ) {
+              ATOMIC_CONTENTION_ADDRESS;
+              ATOMIC_CONTENTION_BUILTIN_CAS_LOOP(true, old + vals[i]);
+            }
+            break;
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto atomic_add_lam = [=](Index_type i) {
+        ATOMIC_CONTENTION_ADDRESS;
+        #pragma omp atomic
+        ATOMIC_CONTENTION_ADD_BODY;
+      };
+      auto atomic_min_lam = [=](Index_type i) {
+        ATOMIC_CONTENTION_ADDRESS;
+        ATOMIC_CONTENTION_BUILTIN_CAS_LOOP(vals[i] < old, vals[i]);
+      };
+      auto atomic_max_lam = [=](Index_type i) {
+        ATOMIC_CONTENTION_ADDRESS;
+        ATOMIC_CONTENTION_BUILTIN_CAS_LOOP(vals[i] > old, vals[i]);
+      };
+      auto atomic_cas_lam = [=](Index_type i) {
+        ATOMIC_CONTENTION_ADDRESS;
+        ATOMIC_CONTENTION_BUILTIN_CAS_LOOP(true, old + vals[i]);
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        switch ( op ) {
+
+          case AtomicOp::add : {
+            #pragma omp parallel for
+            for (Index_type i = ibegin; i < iend; ++i ) {
+              atomic_add_lam(i);
+            }
+            break;
+          }
+
+          case AtomicOp::min : {
+            #pragma omp parallel for
+            for (Index_type i = ibegin; i < iend; ++i ) {
+              atomic_min_lam(i);
+            }
+            break;
+          }
+
+          case AtomicOp::max : {
+            #pragma omp parallel for
+            for (Index_type i = ibegin; i < iend; ++i ) {
+              atomic_max_lam(i);
+            }
+            break;
+          }
+
+          case AtomicOp::cas : {
+            #pragma omp parallel for
+            for (Index_type i = ibegin; i < iend; ++i ) {
+              atomic_cas_lam(i);
+            }
+            break;
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        switch ( op ) {
+
+          case AtomicOp::add : {
+            RAJA::forall<RAJA::omp_parallel_for_exec>(
+              RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+              ATOMIC_CONTENTION_ADDRESS;
+              ATOMIC_CONTENTION_RAJA_ADD_BODY(RAJA::omp_atomic);
+            });
+            break;
+          }
+
+          case AtomicOp::min : {
+            RAJA::forall<RAJA::omp_parallel_for_exec>(
+              RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+              ATOMIC_CONTENTION_ADDRESS;
+              ATOMIC_CONTENTION_RAJA_MIN_BODY(RAJA::omp_atomic);
+            });
+            break;
+          }
+
+          case AtomicOp::max : {
+            RAJA::forall<RAJA::omp_parallel_for_exec>(
+              RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+              ATOMIC_CONTENTION_ADDRESS;
+              ATOMIC_CONTENTION_RAJA_MAX_BODY(RAJA::omp_atomic);
+            });
+            break;
+          }
+
+          case AtomicOp::cas : {
+            RAJA::forall<RAJA::omp_parallel_for_exec>(
+              RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+              ATOMIC_CONTENTION_ADDRESS;
+              ATOMIC_CONTENTION_RAJA_CAS_BODY(RAJA::omp_atomic);
+            });
+            break;
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  ATOMIC_CONTENTION : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -0,0 +1,197 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "ATOMIC_CONTENTION.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+void ATOMIC_CONTENTION::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  ATOMIC_CONTENTION_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        switch ( op ) {
+
+          case AtomicOp::add : {
+            for (Index_type i = ibegin; i < iend; ++i ) {
+              ATOMIC_CONTENTION_ADDRESS;
+              ATOMIC_CONTENTION_ADD_BODY;
+            }
+            break;
+          }
+
+          case AtomicOp::min : {
+            for (Index_type i = ibegin; i < iend; ++i ) {
+              ATOMIC_CONTENTION_ADDRESS;
+              ATOMIC_CONTENTION_MIN_BODY;
+            }
+            break;
+          }
+
+          case AtomicOp::max : {
+            for (Index_type i = ibegin; i < iend; ++i ) {
+              ATOMIC_CONTENTION_ADDRESS;
+              ATOMIC_CONTENTION_MAX_BODY;
+            }
+            break;
+          }
+
+          case AtomicOp::cas : {
+            for (Index_type i = ibegin; i < iend; ++i ) {
+              ATOMIC_CONTENTION_ADDRESS;
+              ATOMIC_CONTENTION_ADD_BODY;
+            }
+            break;
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto atomic_add_lam = [=](Index_type i) {
+        ATOMIC_CONTENTION_ADDRESS;
+        ATOMIC_CONTENTION_ADD_BODY;
+      };
+      auto atomic_min_lam = [=](Index_type i) {
+        ATOMIC_CONTENTION_ADDRESS;
+        ATOMIC_CONTENTION_MIN_BODY;
+      };
+      auto atomic_max_lam = [=](Index_type i) {
+        ATOMIC_CONTENTION_ADDRESS;
+        ATOMIC_CONTENTION_MAX_BODY;
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        switch ( op ) {
+
+          case AtomicOp::add : {
+            for (Index_type i = ibegin; i < iend; ++i ) {
+              atomic_add_lam(i);
+            }
+            break;
+          }
+
+          case AtomicOp::min : {
+            for (Index_type i = ibegin; i < iend; ++i ) {
+              atomic_min_lam(i);
+            }
+            break;
+          }
+
+          case AtomicOp::max : {
+            for (Index_type i = ibegin; i < iend; ++i ) {
+              atomic_max_lam(i);
+            }
+            break;
+          }
+
+          case AtomicOp::cas : {
+            for (Index_type i = ibegin; i < iend; ++i ) {
+              atomic_add_lam(i);
+            }
+            break;
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        switch ( op ) {
+
+          case AtomicOp::add : {
+            RAJA::forall<RAJA::loop_exec>(
+              RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+              ATOMIC_CONTENTION_ADDRESS;
+              ATOMIC_CONTENTION_RAJA_ADD_BODY(RAJA::seq_atomic);
+            });
+            break;
+          }
+
+          case AtomicOp::min : {
+            RAJA::forall<RAJA::loop_exec>(
+              RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+              ATOMIC_CONTENTION_ADDRESS;
+              ATOMIC_CONTENTION_RAJA_MIN_BODY(RAJA::seq_atomic);
+            });
+            break;
+          }
+
+          case AtomicOp::max : {
+            RAJA::forall<RAJA::loop_exec>(
+              RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+              ATOMIC_CONTENTION_ADDRESS;
+              ATOMIC_CONTENTION_RAJA_MAX_BODY(RAJA::seq_atomic);
+            });
+            break;
+          }
+
+          case AtomicOp::cas : {
+            RAJA::forall<RAJA::loop_exec>(
+              RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+              ATOMIC_CONTENTION_ADDRESS;
+              ATOMIC_CONTENTION_RAJA_CAS_BODY(RAJA::seq_atomic);
+            });
+            break;
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  ATOMIC_CONTENTION : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -0,0 +1,167 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "ATOMIC_CONTENTION.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/ThreadPool.hpp"
+
+#include <atomic>
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+void ATOMIC_CONTENTION::runThreadPoolVariant(VariantID vid, size_t tune_idx)
+{
+#if defined(RUN_THREADPOOL)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  ATOMIC_CONTENTION_DATA_SETUP;
+
+  std::vector<std::atomic<Real_type>> std_atomics_vec(m_atomics_length);
+  for (Index_type k = 0; k < m_atomics_length; ++k) {
+    std_atomics_vec[k].store(atomics[k]);
+  }
+  std::atomic<Real_type>* std_atomics = std_atomics_vec.data();
+
+  switch ( vid ) {
+
+    case Base_ThreadPool : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        switch ( op ) {
+
+          case AtomicOp::add : {
+            threadpool::parallel_for(ibegin, iend,
+              [=](Index_type cbegin, Index_type cend) {
+              for (Index_type i = cbegin; i < cend; ++i ) {
+                ATOMIC_CONTENTION_ADDRESS;
+                ATOMIC_CONTENTION_STD_CAS_LOOP(true, old + vals[i]);
+              }
+            });
+            break;
+          }
+
+          case AtomicOp::min : {
+            threadpool::parallel_for(ibegin, iend,
+              [=](Index_type cbegin, Index_type cend) {
+              for (Index_type i = cbegin; i < cend; ++i ) {
+                ATOMIC_CONTENTION_ADDRESS;
+                ATOMIC_CONTENTION_STD_CAS_LOOP(vals[i] < old, vals[i]);
+              }
+            });
+            break;
+          }
+
+          case AtomicOp::max : {
+            threadpool::parallel_for(ibegin, iend,
+              [=](Index_type cbegin, Index_type cend) {
+              for (Index_type i = cbegin; i < cend; ++i ) {
+                ATOMIC_CONTENTION_ADDRESS;
+                ATOMIC_CONTENTION_STD_CAS_LOOP(vals[i] > old, vals[i]);
+              }
+            });
+            break;
+          }
+
+          case AtomicOp::cas : {
+            threadpool::parallel_for(ibegin, iend,
+              [=](Index_type cbegin, Index_type cend) {
+              for (Index_type i = cbegin; i < cend; ++i ) {
+                ATOMIC_CONTENTION_ADDRESS;
+                ATOMIC_CONTENTION_STD_CAS_LOOP(true, old + vals[i]);
+              }
+            });
+            break;
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_ThreadPool : {
+
+      auto atomic_add_lam = [=](Index_type i) {
+        ATOMIC_CONTENTION_ADDRESS;
+        ATOMIC_CONTENTION_STD_CAS_LOOP(true, old + vals[i]);
+      };
+      auto atomic_min_lam = [=](Index_type i) {
+        ATOMIC_CONTENTION_ADDRESS;
+        ATOMIC_CONTENTION_STD_CAS_LOOP(vals[i] < old, vals[i]);
+      };
+      auto atomic_max_lam = [=](Index_type i) {
+        ATOMIC_CONTENTION_ADDRESS;
+        ATOMIC_CONTENTION_STD_CAS_LOOP(vals[i] > old, vals[i]);
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        switch ( op ) {
+
+          case AtomicOp::add : {
+            threadpool::forall(ibegin, iend, atomic_add_lam);
+            break;
+          }
+
+          case AtomicOp::min : {
+            threadpool::forall(ibegin, iend, atomic_min_lam);
+            break;
+          }
+
+          case AtomicOp::max : {
+            threadpool::forall(ibegin, iend, atomic_max_lam);
+            break;
+          }
+
+          case AtomicOp::cas : {
+            threadpool::forall(ibegin, iend, atomic_add_lam);
+            break;
+          }
+
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  ATOMIC_CONTENTION : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  for (Index_type k = 0; k < m_atomics_length; ++k) {
+    atomics[k] = std_atomics_vec[k].load();
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+  RAJA_UNUSED_VAR(tune_idx);
+#endif
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -0,0 +1,154 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "ATOMIC_CONTENTION.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <limits>
+#include <utility>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+ATOMIC_CONTENTION::ATOMIC_CONTENTION(const RunParams& params)
+  : KernelBase(rajaperf::Basic_ATOMIC_CONTENTION, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(10);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  //
+  // Tunings sweep the operation, the number of target addresses, and
+  // whether addresses share cache lines (packed) or not (padded).
+  //
+  const Index_type padded_stride = 64 / sizeof(Real_type);
+  const std::vector<std::pair<AtomicOp, std::string>> ops{
+      {AtomicOp::add, "add"}, {AtomicOp::min, "min"},
+      {AtomicOp::max, "max"}, {AtomicOp::cas, "cas"} };
+  const std::vector<Index_type> address_counts{1, 16, 256, 4096};
+
+  for (auto const& op : ops) {
+    for (Index_type num_addresses : address_counts) {
+      std::string name = op.second + "_" + std::to_string(num_addresses);
+      m_tunings.push_back({op.first, num_addresses, 1, name});
+      if (num_addresses > 1) {
+        m_tunings.push_back({op.first, num_addresses, padded_stride,
+                             name + "_padded"});
+      }
+    }
+  }
+  m_max_num_addresses = address_counts.back();
+  m_atomics_length = m_max_num_addresses * padded_stride;
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  // counts the most target addresses of any tuning, see setUp
+  setBytesPerRep( (1*sizeof(Real_type) + 1*sizeof(Real_type)) * m_max_num_addresses +
+                  (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() );
+  setFLOPsPerRep(1 * getActualProblemSize());
+
+  setUsesFeature(Forall);
+  setUsesFeature(Atomic);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+
+  setVariantDefined( Base_ThreadPool );
+  setVariantDefined( Lambda_ThreadPool );
+}
+
+ATOMIC_CONTENTION::~ATOMIC_CONTENTION()
+{
+}
+
+void ATOMIC_CONTENTION::addTuningDefinitions(VariantID vid)
+{
+  for (Tuning const& tuning : m_tunings) {
+    addVariantTuningName(vid, tuning.name);
+  }
+}
+
+void ATOMIC_CONTENTION::setSeqTuningDefinitions(VariantID vid)
+{
+  addTuningDefinitions(vid);
+}
+
+void ATOMIC_CONTENTION::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addTuningDefinitions(vid);
+}
+
+void ATOMIC_CONTENTION::setThreadPoolTuningDefinitions(VariantID vid)
+{
+  addTuningDefinitions(vid);
+}
+
+void ATOMIC_CONTENTION::setUp(VariantID vid, size_t tune_idx)
+{
+  // integer values keep every ordering of the atomic updates exact
+  allocData(m_vals, getActualProblemSize());
+  for (Index_type i = 0; i < getActualProblemSize(); ++i) {
+    m_vals[i] = Real_type(1 + (i * 37) % 97);
+  }
+
+  switch (m_tunings[tune_idx].op) {
+    case AtomicOp::min :
+      m_atomic_init = std::numeric_limits<Real_type>::max();
+      break;
+    case AtomicOp::max :
+      m_atomic_init = std::numeric_limits<Real_type>::lowest();
+      break;
+    default :
+      m_atomic_init = 0.0;
+  }
+  allocAndInitDataConst(m_atomics, m_atomics_length, m_atomic_init, vid);
+
+  // tunings with fewer target addresses read and write fewer of them
+  recordBytesSaved(vid, tune_idx,
+                   (1*sizeof(Real_type) + 1*sizeof(Real_type)) *
+                   (m_max_num_addresses - m_tunings[tune_idx].num_addresses));
+}
+
+void ATOMIC_CONTENTION::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  //
+  // Checksum the target addresses, without the padding between them.
+  // Tunings target different addresses, so compare variants of a tuning.
+  //
+  Tuning const& tuning = m_tunings[tune_idx];
+
+  std::vector<Real_type> targets(tuning.num_addresses);
+  for (Index_type k = 0; k < tuning.num_addresses; ++k) {
+    targets[k] = m_atomics[k * tuning.address_stride];
+  }
+
+  checksum[vid][tune_idx] += calcChecksum(targets.data(), tuning.num_addresses,
+                                          checksum_scale_factor );
+}
+
+void ATOMIC_CONTENTION::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_vals);
+  deallocData(m_atomics);
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -0,0 +1,159 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// ATOMIC_CONTENTION kernel reference implementation:
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   Index_type a = (i % num_addresses) * address_stride;
+///   atomics[a] = op(atomics[a], vals[i]);    // done atomically
+/// }
+///
+/// Each tuning fixes the operation (add, min, max, or an add done with a
+/// compare-and-swap loop), the number of distinct target addresses, and
+/// their spacing: 'packed' addresses are adjacent so several share a cache
+/// line, 'padded' addresses are one cache line apart. Basic_PI_ATOMIC
+/// (one address) and Basic_DAXPY_ATOMIC (one address per iteration) are the
+/// two ends of this range.
+///
+
+#ifndef RAJAPerf_Basic_ATOMIC_CONTENTION_HPP
+#define RAJAPerf_Basic_ATOMIC_CONTENTION_HPP
+
+#define ATOMIC_CONTENTION_DATA_SETUP \
+  Real_ptr vals = m_vals; \
+  Real_ptr atomics = m_atomics; \
+  const Index_type num_addresses = m_tunings[tune_idx].num_addresses; \
+  const Index_type address_stride = m_tunings[tune_idx].address_stride; \
+  const AtomicOp op = m_tunings[tune_idx].op;
+
+#define ATOMIC_CONTENTION_ADDRESS \
+  const Index_type a = (i % num_addresses) * address_stride;
+
+#define ATOMIC_CONTENTION_ADD_BODY \
+  atomics[a] += vals[i];
+
+#define ATOMIC_CONTENTION_MIN_BODY \
+  if (vals[i] < atomics[a]) atomics[a] = vals[i];
+
+#define ATOMIC_CONTENTION_MAX_BODY \
+  if (vals[i] > atomics[a]) atomics[a] = vals[i];
+
+#define ATOMIC_CONTENTION_RAJA_ADD_BODY(policy) \
+  RAJA::atomicAdd<policy>(&atomics[a], vals[i]);
+
+#define ATOMIC_CONTENTION_RAJA_MIN_BODY(policy) \
+  RAJA::atomicMin<policy>(&atomics[a], vals[i]);
+
+#define ATOMIC_CONTENTION_RAJA_MAX_BODY(policy) \
+  RAJA::atomicMax<policy>(&atomics[a], vals[i]);
+
+#define ATOMIC_CONTENTION_RAJA_CAS_BODY(policy) \
+  Real_type old = atomics[a]; \
+  Real_type assumed; \
+  do { \
+    assumed = old; \
+    old = RAJA::atomicCAS<policy>(&atomics[a], assumed, assumed + vals[i]); \
+  } while (old != assumed);
+
+//
+// OpenMP before 5.1 has no atomic min, max or compare-and-swap, so Base
+// OpenMP variants build them from the GCC/Clang __atomic builtins. The loop
+// stores 'desired' if 'update' holds for the current value 'old'.
+//
+#define ATOMIC_CONTENTION_BUILTIN_CAS_LOOP(update, desired_val) \
+  Real_type old; \
+  Real_type desired; \
+  __atomic_load(&atomics[a], &old, __ATOMIC_RELAXED); \
+  do { \
+    if ( !(update) ) break; \
+    desired = (desired_val); \
+  } while ( !__atomic_compare_exchange(&atomics[a], &old, &desired, true, \
+                                       __ATOMIC_RELAXED, __ATOMIC_RELAXED) );
+
+//
+// std::atomic_ref is C++20; ThreadPool variants operate on an array of
+// std::atomic holding the same values, using the same loop.
+//
+#define ATOMIC_CONTENTION_STD_CAS_LOOP(update, desired_val) \
+  Real_type old = std_atomics[a].load(std::memory_order_relaxed); \
+  while ( (update) && \
+          !std_atomics[a].compare_exchange_weak(old, (desired_val), \
+                                                std::memory_order_relaxed) ) { }
+
+
+#include "common/KernelBase.hpp"
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace basic
+{
+
+class ATOMIC_CONTENTION : public KernelBase
+{
+public:
+
+  enum struct AtomicOp { add, min, max, cas };
+
+  ATOMIC_CONTENTION(const RunParams& params);
+
+  ~ATOMIC_CONTENTION();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  ATOMIC_CONTENTION : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  ATOMIC_CONTENTION : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  ATOMIC_CONTENTION : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+  void runThreadPoolVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void setThreadPoolTuningDefinitions(VariantID vid);
+
+private:
+  struct Tuning
+  {
+    AtomicOp op;
+    Index_type num_addresses;
+    Index_type address_stride;
+    std::string name;
+  };
+
+  void addTuningDefinitions(VariantID vid);
+
+  std::vector<Tuning> m_tunings;
+  Index_type m_max_num_addresses;
+  Index_type m_atomics_length;
+
+  Real_ptr m_vals;
+  Real_ptr m_atomics;
+  Real_type m_atomic_init;
+};
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -18,15 +18,16 @@ namespace basic
 {
 
 
-void DAXPY::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Loop_index_type >
+void DAXPY::runSeqVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
-  const Index_type ibegin = 0;
-  const Index_type iend = getActualProblemSize();
+  const Loop_index_type ibegin = 0;
+  const Loop_index_type iend = static_cast<Loop_index_type>(getActualProblemSize());
 
   DAXPY_DATA_SETUP;
 
-  auto daxpy_lam = [=](Index_type i) {
+  auto daxpy_lam = [=](Loop_index_type i) {
                      DAXPY_BODY;
                    };
 
@@ -37,7 +38,7 @@ void DAXPY::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        for (Index_type i = ibegin; i < iend; ++i ) {
+        for (Loop_index_type i = ibegin; i < iend; ++i ) {
           DAXPY_BODY;
         }
 
@@ -53,7 +54,7 @@ void DAXPY::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        for (Index_type i = ibegin; i < iend; ++i ) {
+        for (Loop_index_type i = ibegin; i < iend; ++i ) {
           daxpy_lam(i);
         }
 
@@ -69,7 +70,7 @@ void DAXPY::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         RAJA::forall<RAJA::simd_exec>(
-          RAJA::RangeSegment(ibegin, iend), daxpy_lam);
+          RAJA::TypedRangeSegment<Loop_index_type>(ibegin, iend), daxpy_lam);
 
       }
       stopTimer();
@@ -86,5 +87,7 @@ void DAXPY::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+RAJAPERF_SEQ_INDEX_TYPE_TUNING_DEFINE_BOILERPLATE(DAXPY)
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -53,6 +53,15 @@ DAXPY::DAXPY(const RunParams& params)
   setVariantDefined( RAJA_HIP );
 
   setVariantDefined( Kokkos_Lambda );
+
+  setVariantDefined( Base_ThreadPool );
+  setVariantDefined( Lambda_ThreadPool );
+
+  setVariantDefined( Base_StdPar );
+  setVariantDefined( Lambda_StdPar );
+
+  setVariantDefined( Base_SIMD );
+  setVariantDefined( RAJA_SIMD );
 }
 
 DAXPY::~DAXPY()
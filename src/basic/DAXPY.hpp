@@ -27,6 +27,7 @@
 
 
 #include "common/KernelBase.hpp"
+#include "common/IndexTypeUtils.hpp"
 
 namespace rajaperf
 {
@@ -53,7 +54,16 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
-
+  void runThreadPoolVariant(VariantID vid, size_t tune_idx);
+  void runStdParVariant(VariantID vid, size_t tune_idx);
+  void runSIMDVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  template < typename Loop_index_type >
+  void runSeqVariantImpl(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  template < typename Loop_index_type, bool runtime_schedule >
+  void runOpenMPVariantImpl(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
@@ -42,6 +42,18 @@ __global__ void daxpy_atomic(Real_ptr y, Real_ptr x,
    }
 }
 
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void daxpy_no_atomic(Real_ptr y, Real_ptr x,
+                                Real_type a,
+                                Index_type iend)
+{
+   Index_type i = blockIdx.x * blockDim.x + threadIdx.x;
+   if (i < iend) {
+     DAXPY_ATOMIC_BODY;
+   }
+}
+
 
 template < size_t block_size >
 void DAXPY_ATOMIC::runCudaVariantImpl(VariantID vid)
@@ -110,7 +122,125 @@ void DAXPY_ATOMIC::runCudaVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BIOLERPLATE(DAXPY_ATOMIC, Cuda)
+template < size_t block_size >
+void DAXPY_ATOMIC::runCudaVariantNoAtomic(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  DAXPY_ATOMIC_DATA_SETUP;
+
+  if ( vid == Base_CUDA ) {
+
+    DAXPY_ATOMIC_DATA_SETUP_CUDA;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      daxpy_no_atomic<block_size><<<grid_size, block_size>>>( y, x, a,
+                                                                 iend );
+      cudaErrchk( cudaGetLastError() );
+
+    }
+    stopTimer();
+
+    DAXPY_ATOMIC_DATA_TEARDOWN_CUDA;
+
+  } else if ( vid == RAJA_CUDA ) {
+
+    DAXPY_ATOMIC_DATA_SETUP_CUDA;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall< RAJA::cuda_exec<block_size, true /*async*/> >(
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+        DAXPY_ATOMIC_BODY;
+      });
+
+    }
+    stopTimer();
+
+    DAXPY_ATOMIC_DATA_TEARDOWN_CUDA;
+
+  } else {
+     getCout() << "\n  DAXPY_ATOMIC : Unknown Cuda variant id = " << vid << std::endl;
+  }
+}
+
+void DAXPY_ATOMIC::runCudaVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+
+        runCudaVariantImpl<block_size>(vid);
+
+      }
+
+      t += 1;
+
+    }
+
+  });
+
+  if ( vid == Base_CUDA || vid == RAJA_CUDA ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        if (tune_idx == t) {
+
+          runCudaVariantNoAtomic<block_size>(vid);
+
+        }
+
+        t += 1;
+
+      }
+
+    });
+
+  }
+}
+
+void DAXPY_ATOMIC::setCudaTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+
+    }
+
+  });
+
+  if ( vid == Base_CUDA || vid == RAJA_CUDA ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        addVariantTuningName(vid, "no_atomic_block_"+std::to_string(block_size));
+
+      }
+
+    });
+
+  }
+}
 
 } // end namespace basic
 } // end namespace rajaperf
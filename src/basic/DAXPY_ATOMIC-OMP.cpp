@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/OpenMPUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +20,8 @@ namespace basic
 {
 
 
-void DAXPY_ATOMIC::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < bool runtime_schedule >
+void DAXPY_ATOMIC::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -35,10 +38,18 @@ void DAXPY_ATOMIC::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          #pragma omp atomic
-          y[i] += a * x[i] ;
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            #pragma omp atomic
+            y[i] += a * x[i] ;
+          }
+        } else {
+          #pragma omp parallel for
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            #pragma omp atomic
+            y[i] += a * x[i] ;
+          }
         }
 
       }
@@ -54,12 +65,94 @@ void DAXPY_ATOMIC::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
                          y[i] += a * x[i] ;
                        };
 
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            daxpy_atomic_lam(i);
+          }
+        } else {
+          #pragma omp parallel for
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            daxpy_atomic_lam(i);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<omp_schedule::parallel_for_exec<runtime_schedule>>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          DAXPY_ATOMIC_RAJA_BODY(RAJA::omp_atomic);
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  DAXPY_ATOMIC : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void DAXPY_ATOMIC::runOpenMPVariantNoAtomic(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  DAXPY_ATOMIC_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         #pragma omp parallel for
         for (Index_type i = ibegin; i < iend; ++i ) {
-          daxpy_atomic_lam(i);
+          DAXPY_ATOMIC_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto daxpy_no_atomic_lam = [=](Index_type i) {
+                                   DAXPY_ATOMIC_BODY;
+                                 };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          daxpy_no_atomic_lam(i);
         }
 
       }
@@ -75,7 +168,7 @@ void DAXPY_ATOMIC::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
 
         RAJA::forall<RAJA::omp_parallel_for_exec>(
           RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
-          DAXPY_ATOMIC_RAJA_BODY(RAJA::omp_atomic);
+          DAXPY_ATOMIC_BODY;
         });
 
       }
@@ -95,5 +188,28 @@ void DAXPY_ATOMIC::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tu
 #endif
 }
 
+void DAXPY_ATOMIC::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  const size_t num_schedule_tunings =
+      omp_schedule::getTuningNames(run_params).size();
+
+  if ( tune_idx == 0 ) {
+    runOpenMPVariantImpl<false>(vid);
+  } else if ( tune_idx < num_schedule_tunings ) {
+    omp_schedule::RuntimeScheduleScope schedule(run_params, tune_idx);
+    runOpenMPVariantImpl<true>(vid);
+  } else {
+    runOpenMPVariantNoAtomic(vid);
+  }
+}
+
+void DAXPY_ATOMIC::setOpenMPTuningDefinitions(VariantID vid)
+{
+  for (std::string const& name : omp_schedule::getTuningNames(run_params)) {
+    addVariantTuningName(vid, name);
+  }
+  addVariantTuningName(vid, "no_atomic");
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -53,6 +53,9 @@ DAXPY_ATOMIC::DAXPY_ATOMIC(const RunParams& params)
   setVariantDefined( RAJA_HIP );
 
   setVariantDefined( Kokkos_Lambda );
+
+  setVariantDefined( Base_ThreadPool );
+  setVariantDefined( Lambda_ThreadPool );
 }
 
 DAXPY_ATOMIC::~DAXPY_ATOMIC()
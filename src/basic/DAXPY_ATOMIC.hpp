@@ -13,6 +13,11 @@
 ///   y[i] += a * x[i] ;
 /// }
 ///
+/// Every iteration updates its own element of y, so besides the atomic
+/// update per iteration the OpenMP and GPU variants have 'no_atomic'
+/// tunings that run the same loop with a plain update, i.e., DAXPY. The
+/// difference is the cost of the atomics without any contention.
+///
 
 #ifndef RAJAPerf_Basic_DAXPY_ATOMIC_HPP
 #define RAJAPerf_Basic_DAXPY_ATOMIC_HPP
@@ -56,13 +61,22 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
+  void runThreadPoolVariant(VariantID vid, size_t tune_idx);
 
+  void setOpenMPTuningDefinitions(VariantID vid);
+  template < bool runtime_schedule >
+  void runOpenMPVariantImpl(VariantID vid);
+  void runOpenMPVariantNoAtomic(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantNoAtomic(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantNoAtomic(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
@@ -0,0 +1,122 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "GATHER.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include "common/HipDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+#define GATHER_DATA_SETUP_HIP \
+  allocAndInitHipDeviceData(x, m_x, iend); \
+  allocAndInitHipDeviceData(y, m_y, iend); \
+  allocAndInitHipDeviceData(idx, m_idx, iend);
+
+#define GATHER_DATA_TEARDOWN_HIP \
+  getHipDeviceData(m_y, y, iend); \
+  deallocHipDeviceData(x); \
+  deallocHipDeviceData(y); \
+  deallocHipDeviceData(idx);
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void gather(Real_ptr y, Real_ptr x,
+                       Int_ptr idx,
+                       Index_type iend)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < iend) {
+     GATHER_BODY;
+   }
+}
+
+
+template < size_t block_size >
+void GATHER::runHipVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  GATHER_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    GATHER_DATA_SETUP_HIP;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      hipLaunchKernelGGL((gather<block_size>), dim3(grid_size), dim3(block_size), 0, 0,
+                         y, x, idx, iend );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+    GATHER_DATA_TEARDOWN_HIP;
+
+  } else if ( vid == Lambda_HIP ) {
+
+    GATHER_DATA_SETUP_HIP;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      auto gather_lambda = [=] __device__ (Index_type i) {
+        GATHER_BODY;
+      };
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      hipLaunchKernelGGL((lambda_hip_forall<block_size, decltype(gather_lambda)>),
+        grid_size, block_size, 0, 0, ibegin, iend, gather_lambda);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+    GATHER_DATA_TEARDOWN_HIP;
+
+  } else if ( vid == RAJA_HIP ) {
+
+    GATHER_DATA_SETUP_HIP;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >(
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+        GATHER_BODY;
+      });
+
+    }
+    stopTimer();
+
+    GATHER_DATA_TEARDOWN_HIP;
+
+  } else {
+     getCout() << "\n  GATHER : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BIOLERPLATE(GATHER, Hip)
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
@@ -0,0 +1,114 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "GATHER.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/OpenMPUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+template < bool runtime_schedule >
+void GATHER::runOpenMPVariantImpl(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  GATHER_DATA_SETUP;
+
+  auto gather_lam = [=](Index_type i) {
+                      GATHER_BODY;
+                    };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            GATHER_BODY;
+          }
+        } else {
+          #pragma omp parallel for
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            GATHER_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            gather_lam(i);
+          }
+        } else {
+          #pragma omp parallel for
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            gather_lam(i);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<omp_schedule::parallel_for_exec<runtime_schedule>>(
+          RAJA::RangeSegment(ibegin, iend), gather_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  GATHER : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+RAJAPERF_OPENMP_SCHEDULE_TUNING_DEFINE_BOILERPLATE(GATHER)
+
+} // end namespace basic
+} // end namespace rajaperf
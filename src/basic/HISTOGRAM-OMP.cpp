@@ -0,0 +1,367 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HISTOGRAM.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+void HISTOGRAM::runOpenMPVariantAtomic(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  HISTOGRAM_DATA_SETUP;
+
+  auto histogram_lam = [=](Index_type i) {
+                         #pragma omp atomic
+                         HISTOGRAM_BODY;
+                       };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          #pragma omp atomic
+          HISTOGRAM_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          histogram_lam(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          HISTOGRAM_RAJA_BODY(RAJA::omp_atomic);
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  HISTOGRAM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void HISTOGRAM::runOpenMPVariantSort(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  HISTOGRAM_DATA_SETUP;
+  HISTOGRAM_SORT_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      // each thread sorts and counts its own contiguous part of the bins
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          const Index_type p = omp_get_num_threads();
+          const Index_type t = omp_get_thread_num();
+          const Index_type rbegin = ibegin + (iend - ibegin) * t / p;
+          const Index_type rend = ibegin + (iend - ibegin) * (t+1) / p;
+
+          for (Index_type i = rbegin; i < rend; ++i ) {
+            HISTOGRAM_COPY_BODY;
+          }
+          std::sort(sorted + rbegin, sorted + rend);
+          for (Index_type i = rbegin; i < rend; ++i ) {
+            if HISTOGRAM_SORT_RUN_BEGIN {
+              #pragma omp atomic
+              counts[sorted[i]] -= i;
+            }
+            if HISTOGRAM_SORT_RUN_END {
+              #pragma omp atomic
+              counts[sorted[i]] += i+1;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto histogram_copy_lam = [=](Index_type i) {
+                                  HISTOGRAM_COPY_BODY;
+                                };
+      auto histogram_sort_lam = [=](Index_type i,
+                                    Index_type rbegin, Index_type rend) {
+                                  if HISTOGRAM_SORT_RUN_BEGIN {
+                                    #pragma omp atomic
+                                    counts[sorted[i]] -= i;
+                                  }
+                                  if HISTOGRAM_SORT_RUN_END {
+                                    #pragma omp atomic
+                                    counts[sorted[i]] += i+1;
+                                  }
+                                };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          const Index_type p = omp_get_num_threads();
+          const Index_type t = omp_get_thread_num();
+          const Index_type rbegin = ibegin + (iend - ibegin) * t / p;
+          const Index_type rend = ibegin + (iend - ibegin) * (t+1) / p;
+
+          for (Index_type i = rbegin; i < rend; ++i ) {
+            histogram_copy_lam(i);
+          }
+          std::sort(sorted + rbegin, sorted + rend);
+          for (Index_type i = rbegin; i < rend; ++i ) {
+            histogram_sort_lam(i, rbegin, rend);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      // one parallel sort of all the bins, each run is then counted once
+      const Index_type rbegin = ibegin;
+      const Index_type rend = iend;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          HISTOGRAM_COPY_BODY;
+        });
+        RAJA::sort<RAJA::omp_parallel_for_exec>(
+          RAJA::make_span(sorted + ibegin, iend - ibegin));
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          HISTOGRAM_SORT_RAJA_BODY(RAJA::omp_atomic);
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  HISTOGRAM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void HISTOGRAM::runOpenMPVariantPrivate(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  HISTOGRAM_DATA_SETUP;
+  HISTOGRAM_PRIVATE_DATA_SETUP;
+
+  const int num_threads = omp_get_max_threads();
+  std::vector<Int_type> private_counts_vec(num_threads * num_bins);
+  Int_ptr private_counts = private_counts_vec.data();
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          const Index_type p = omp_get_num_threads();
+          Int_ptr my_counts = private_counts + omp_get_thread_num() * num_bins;
+
+          for (Index_type b = 0; b < num_bins; ++b ) {
+            my_counts[b] = 0;
+          }
+          #pragma omp for
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            HISTOGRAM_PRIVATE_BODY;
+          }
+          #pragma omp for
+          for (Index_type b = 0; b < num_bins; ++b ) {
+            for (Index_type t = 0; t < p; ++t ) {
+              counts[b] += private_counts[t * num_bins + b];
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto histogram_private_lam = [=](Index_type i, Int_ptr my_counts) {
+                                     HISTOGRAM_PRIVATE_BODY;
+                                   };
+      auto histogram_merge_lam = [=](Index_type b, Index_type p) {
+                                   for (Index_type t = 0; t < p; ++t ) {
+                                     counts[b] += private_counts[t * num_bins + b];
+                                   }
+                                 };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          const Index_type p = omp_get_num_threads();
+          Int_ptr my_counts = private_counts + omp_get_thread_num() * num_bins;
+
+          for (Index_type b = 0; b < num_bins; ++b ) {
+            my_counts[b] = 0;
+          }
+          #pragma omp for
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            histogram_private_lam(i, my_counts);
+          }
+          #pragma omp for
+          for (Index_type b = 0; b < num_bins; ++b ) {
+            histogram_merge_lam(b, p);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      //
+      // RAJA loops do not share a parallel region, so every private
+      // histogram is cleared and merged whether or not its thread ran.
+      //
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, num_threads * num_bins), [=](Index_type b) {
+          private_counts[b] = 0;
+        });
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          Int_ptr my_counts = private_counts + omp_get_thread_num() * num_bins;
+          HISTOGRAM_PRIVATE_BODY;
+        });
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, num_bins), [=](Index_type b) {
+          for (Index_type t = 0; t < num_threads; ++t ) {
+            counts[b] += private_counts[t * num_bins + b];
+          }
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  HISTOGRAM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void HISTOGRAM::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  if ( tune_idx == 0 ) {
+    runOpenMPVariantAtomic(vid);
+  } else if ( tune_idx == 1 ) {
+    runOpenMPVariantSort(vid);
+  } else {
+    runOpenMPVariantPrivate(vid);
+  }
+}
+
+} // end namespace basic
+} // end namespace rajaperf
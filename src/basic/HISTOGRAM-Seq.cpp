@@ -0,0 +1,189 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HISTOGRAM.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+void HISTOGRAM::runSeqVariantAtomic(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  HISTOGRAM_DATA_SETUP;
+
+  auto histogram_lam = [=](Index_type i) {
+                         HISTOGRAM_BODY;
+                       };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          HISTOGRAM_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          histogram_lam(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          HISTOGRAM_RAJA_BODY(RAJA::seq_atomic);
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  HISTOGRAM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void HISTOGRAM::runSeqVariantSort(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  HISTOGRAM_DATA_SETUP;
+  HISTOGRAM_SORT_DATA_SETUP;
+
+  const Index_type rbegin = ibegin;
+  const Index_type rend = iend;
+
+  auto histogram_copy_lam = [=](Index_type i) {
+                              HISTOGRAM_COPY_BODY;
+                            };
+  auto histogram_sort_lam = [=](Index_type i) {
+                              HISTOGRAM_SORT_BODY;
+                            };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          HISTOGRAM_COPY_BODY;
+        }
+        std::sort(sorted + ibegin, sorted + iend);
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          HISTOGRAM_SORT_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          histogram_copy_lam(i);
+        }
+        std::sort(sorted + ibegin, sorted + iend);
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          histogram_sort_lam(i);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), histogram_copy_lam);
+        RAJA::sort<RAJA::loop_exec>(
+          RAJA::make_span(sorted + ibegin, iend - ibegin));
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(ibegin, iend), histogram_sort_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  HISTOGRAM : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void HISTOGRAM::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  if ( tune_idx == 0 ) {
+    runSeqVariantAtomic(vid);
+  } else {
+    runSeqVariantSort(vid);
+  }
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -0,0 +1,127 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HISTOGRAM.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+HISTOGRAM::HISTOGRAM(const RunParams& params)
+  : KernelBase(rajaperf::Basic_HISTOGRAM, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(50);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_num_bins = params.getHistogramBins();
+  m_distribution = params.getHistogramDistribution();
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  setBytesPerRep( (1*sizeof(Int_type) + 1*sizeof(Int_type)) * m_num_bins +
+                  (0*sizeof(Int_type) + 1*sizeof(Int_type)) * getActualProblemSize() );
+  setFLOPsPerRep(0);
+
+  setUsesFeature(Forall);
+  setUsesFeature(Atomic);
+  setUsesFeature(Sort);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( Lambda_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( Lambda_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+HISTOGRAM::~HISTOGRAM()
+{
+}
+
+void HISTOGRAM::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "atomic");
+  addVariantTuningName(vid, "sort");
+}
+
+void HISTOGRAM::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "atomic");
+  addVariantTuningName(vid, "sort");
+  addVariantTuningName(vid, "private");
+}
+
+void HISTOGRAM::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  const Index_type len = getActualProblemSize();
+  const Index_type num_bins = m_num_bins;
+
+  //
+  // mt19937 output is the same everywhere, unlike the std distributions,
+  // so the bins are computed from it directly:
+  //   uniform -- every bin equally likely
+  //   normal  -- mean of four uniform bins, a bell curve around the middle bin
+  //   zipf    -- log-uniform, bin b has probability about 1/(b+1)
+  //
+  std::mt19937 gen(5167);
+  allocData(m_bins, len);
+  for (Index_type i = 0; i < len; ++i) {
+    Index_type b;
+    if ( m_distribution == "normal" ) {
+      b = 0;
+      for (int k = 0; k < 4; ++k) {
+        b += gen() % num_bins;
+      }
+      b /= 4;
+    } else if ( m_distribution == "zipf" ) {
+      const double u = gen() / (double(std::mt19937::max()) + 1.0);
+      b = Index_type(std::pow(double(num_bins), u)) - 1;
+    } else {
+      b = gen() % num_bins;
+    }
+    m_bins[i] = std::min(std::max(b, Index_type(0)), num_bins-1);
+  }
+
+  allocData(m_counts, num_bins);
+  for (Index_type b = 0; b < num_bins; ++b) {
+    m_counts[b] = 0;
+  }
+
+  allocData(m_sorted, len);
+
+  (void) vid;
+}
+
+void HISTOGRAM::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid].at(tune_idx) += calcChecksum(m_counts, m_num_bins);
+}
+
+void HISTOGRAM::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_bins);
+  deallocData(m_counts);
+  deallocData(m_sorted);
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -0,0 +1,137 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// HISTOGRAM kernel reference implementation:
+///
+/// for (Index_type i = ibegin; i < iend; ++i ) {
+///   counts[bins[i]] += 1;
+/// }
+///
+/// The number of bins and the distribution of the bin of each sample are
+/// given by the --histogram_bins and --histogram_distribution command line
+/// options.
+///
+/// Tunings use different strategies to accumulate the counts:
+///   atomic  -- update the shared counts directly (atomically in parallel)
+///   sort    -- sort a copy of the bins, then add the length of each run of
+///              equal bins to its count (a reduce by key)
+///   private -- OpenMP only, each thread counts into its own histogram and
+///              the histograms are summed at the end
+///
+
+#ifndef RAJAPerf_Basic_HISTOGRAM_HPP
+#define RAJAPerf_Basic_HISTOGRAM_HPP
+
+#define HISTOGRAM_DATA_SETUP \
+  Int_ptr bins = m_bins; \
+  Int_ptr counts = m_counts;
+
+#define HISTOGRAM_SORT_DATA_SETUP \
+  Int_ptr sorted = m_sorted;
+
+#define HISTOGRAM_PRIVATE_DATA_SETUP \
+  const Index_type num_bins = m_num_bins;
+
+#define HISTOGRAM_BODY  \
+  counts[bins[i]] += 1;
+
+#define HISTOGRAM_RAJA_BODY(policy)  \
+  RAJA::atomicAdd<policy>(&counts[bins[i]], 1);
+
+#define HISTOGRAM_PRIVATE_BODY  \
+  my_counts[bins[i]] += 1;
+
+#define HISTOGRAM_COPY_BODY  \
+  sorted[i] = bins[i];
+
+// a run of equal bins in sorted[rbegin, rend) from i to j adds (j+1) - i
+#define HISTOGRAM_SORT_RUN_BEGIN \
+  ( i == rbegin || sorted[i] != sorted[i-1] )
+
+#define HISTOGRAM_SORT_RUN_END \
+  ( i == rend-1 || sorted[i] != sorted[i+1] )
+
+#define HISTOGRAM_SORT_BODY  \
+  if HISTOGRAM_SORT_RUN_BEGIN { \
+    counts[sorted[i]] -= i; \
+  } \
+  if HISTOGRAM_SORT_RUN_END { \
+    counts[sorted[i]] += i+1; \
+  }
+
+#define HISTOGRAM_SORT_RAJA_BODY(policy)  \
+  if HISTOGRAM_SORT_RUN_BEGIN { \
+    RAJA::atomicSub<policy>(&counts[sorted[i]], Int_type(i)); \
+  } \
+  if HISTOGRAM_SORT_RUN_END { \
+    RAJA::atomicAdd<policy>(&counts[sorted[i]], Int_type(i+1)); \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+#include <string>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace basic
+{
+
+class HISTOGRAM : public KernelBase
+{
+public:
+
+  HISTOGRAM(const RunParams& params);
+
+  ~HISTOGRAM();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  HISTOGRAM : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  HISTOGRAM : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  HISTOGRAM : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+
+  void runSeqVariantAtomic(VariantID vid);
+  void runSeqVariantSort(VariantID vid);
+
+  void runOpenMPVariantAtomic(VariantID vid);
+  void runOpenMPVariantSort(VariantID vid);
+  void runOpenMPVariantPrivate(VariantID vid);
+
+private:
+  Index_type m_num_bins;
+  std::string m_distribution;
+
+  Int_ptr m_bins;
+  Int_ptr m_counts;
+  Int_ptr m_sorted;
+};
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
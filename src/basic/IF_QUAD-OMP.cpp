@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/OpenMPUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +20,8 @@ namespace basic
 {
 
 
-void IF_QUAD::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < bool runtime_schedule >
+void IF_QUAD::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -39,9 +42,16 @@ void IF_QUAD::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_id
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          IF_QUAD_BODY;
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            IF_QUAD_BODY;
+          }
+        } else {
+          #pragma omp parallel for
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            IF_QUAD_BODY;
+          }
         }
 
       }
@@ -55,9 +65,16 @@ void IF_QUAD::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_id
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          ifquad_lam(i);
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            ifquad_lam(i);
+          }
+        } else {
+          #pragma omp parallel for
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            ifquad_lam(i);
+          }
         }
 
       }
@@ -71,7 +88,7 @@ void IF_QUAD::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_id
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::forall<omp_schedule::parallel_for_exec<runtime_schedule>>(
           RAJA::RangeSegment(ibegin, iend), ifquad_lam);
 
       }
@@ -91,5 +108,7 @@ void IF_QUAD::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_id
 #endif
 }
 
+RAJAPERF_OPENMP_SCHEDULE_TUNING_DEFINE_BOILERPLATE(IF_QUAD)
+
 } // end namespace basic
 } // end namespace rajaperf
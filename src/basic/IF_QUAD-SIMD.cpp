@@ -0,0 +1,153 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "IF_QUAD.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/SIMDUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+void IF_QUAD::runSIMDVariantBranch(VariantID vid)
+{
+#if defined(RUN_SIMD)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  IF_QUAD_DATA_SETUP;
+
+  auto ifquad_lam = [=](Index_type i) {
+                      IF_QUAD_BODY;
+                    };
+
+  switch ( vid ) {
+
+    case Base_SIMD : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp simd simdlen(RAJAPERF_SIMD_WIDTH)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          IF_QUAD_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_SIMD : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), ifquad_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  IF_QUAD : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void IF_QUAD::runSIMDVariantBranchless(VariantID vid)
+{
+#if defined(RUN_SIMD)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  IF_QUAD_DATA_SETUP;
+
+  auto ifquad_branchless_lam = [=](Index_type i) {
+                                 IF_QUAD_BRANCHLESS_BODY;
+                               };
+
+  switch ( vid ) {
+
+    case Base_SIMD : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp simd simdlen(RAJAPERF_SIMD_WIDTH)
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          IF_QUAD_BRANCHLESS_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_SIMD : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), ifquad_branchless_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  IF_QUAD : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void IF_QUAD::runSIMDVariant(VariantID vid, size_t tune_idx)
+{
+  if ( tune_idx == 0 ) {
+    runSIMDVariantBranch(vid);
+  } else {
+    runSIMDVariantBranchless(vid);
+  }
+}
+
+void IF_QUAD::setSIMDTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+  addVariantTuningName(vid, "branchless");
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -57,6 +57,12 @@ IF_QUAD::IF_QUAD(const RunParams& params)
   setVariantDefined( RAJA_HIP );
 
   setVariantDefined( Kokkos_Lambda );
+
+  setVariantDefined( Base_ThreadPool );
+  setVariantDefined( Lambda_ThreadPool );
+
+  setVariantDefined( Base_SIMD );
+  setVariantDefined( RAJA_SIMD );
 }
 
 IF_QUAD::~IF_QUAD()
@@ -65,9 +71,34 @@ IF_QUAD::~IF_QUAD()
 
 void IF_QUAD::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  allocAndInitDataRandSign(m_a, getActualProblemSize(), vid);
-  allocAndInitData(m_b, getActualProblemSize(), vid);
-  allocAndInitData(m_c, getActualProblemSize(), vid);
+  if ( run_params.getIfQuadComplexFraction() < 0.0 ) {
+
+    //
+    // Default data; the sign of a places the branches, so the pattern
+    // applies to it.
+    //
+    allocAndInitDataRandSign(m_a, getActualProblemSize(), 0.5,
+                             run_params.getIfQuadClustered(), vid);
+    allocAndInitData(m_b, getActualProblemSize(), vid);
+    allocAndInitData(m_c, getActualProblemSize(), vid);
+
+  } else {
+
+    //
+    // Choose c so the discriminant is -b^2 for the selected entries
+    // (negative sign in m_c) and b^2/2 for the others.
+    //
+    allocAndInitData(m_a, getActualProblemSize(), vid);
+    allocAndInitData(m_b, getActualProblemSize(), vid);
+    allocAndInitDataRandSign(m_c, getActualProblemSize(),
+                             run_params.getIfQuadComplexFraction(),
+                             run_params.getIfQuadClustered(), vid);
+    for (Index_type i = 0; i < getActualProblemSize(); ++i) {
+      Real_type c_real = m_b[i]*m_b[i] / (4.0*m_a[i]);
+      m_c[i] = ( m_c[i] < 0.0 ) ? 2.0*c_real : 0.5*c_real;
+    }
+
+  }
   allocAndInitDataConst(m_x1, getActualProblemSize(), 0.0, vid);
   allocAndInitDataConst(m_x2, getActualProblemSize(), 0.0, vid);
 }
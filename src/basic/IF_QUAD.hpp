@@ -21,6 +21,13 @@
 ///   }
 /// }
 ///
+/// The fraction of entries with a negative discriminant, and whether they
+/// are spread uniformly or in runs, can be set with the
+/// --if_quad_complex_fraction and --if_quad_pattern options.
+///
+/// The Seq and SIMD variants have a 'branchless' tuning that computes both
+/// branches and selects the results, instead of branching.
+///
 
 #ifndef RAJAPerf_Basic_IF_QUAD_HPP
 #define RAJAPerf_Basic_IF_QUAD_HPP
@@ -43,6 +50,15 @@
     x1[i] = 0.0; \
   }
 
+#define IF_QUAD_BRANCHLESS_BODY  \
+  Real_type s = b[i]*b[i] - 4.0*a[i]*c[i]; \
+  const bool real_roots = ( s >= 0 ); \
+  s = sqrt( real_roots ? s : 0.0 ); \
+  const Real_type r2 = (-b[i]+s)/(2.0*a[i]); \
+  const Real_type r1 = (-b[i]-s)/(2.0*a[i]); \
+  x2[i] = real_roots ? r2 : 0.0; \
+  x1[i] = real_roots ? r1 : 0.0;
+
 #include "common/KernelBase.hpp"
 
 namespace rajaperf
@@ -70,7 +86,18 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
-
+  void runThreadPoolVariant(VariantID vid, size_t tune_idx);
+  void runSIMDVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setSIMDTuningDefinitions(VariantID vid);
+  void runSeqVariantBranch(VariantID vid);
+  void runSeqVariantBranchless(VariantID vid);
+  void runSIMDVariantBranch(VariantID vid);
+  void runSIMDVariantBranchless(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  template < bool runtime_schedule >
+  void runOpenMPVariantImpl(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
@@ -10,20 +10,26 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/IndexTypeUtils.hpp"
+
+#include <atomic>
+#include <cstdint>
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
 namespace basic
 {
 
-void INDEXLIST::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Loop_index_type >
+void INDEXLIST::runOpenMPVariantScan(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
   const Index_type run_reps = getRunReps();
-  const Index_type ibegin = 0;
-  const Index_type iend = getActualProblemSize();
+  const Loop_index_type ibegin = 0;
+  const Loop_index_type iend = static_cast<Loop_index_type>(getActualProblemSize());
 
   INDEXLIST_DATA_SETUP;
 
@@ -33,21 +39,21 @@ void INDEXLIST::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
 #if _OPENMP >= 201811 && defined(RAJA_PERFSUITE_ENABLE_OPENMP5_SCAN)
 #else
-      const Index_type n = iend - ibegin;
-      ::std::vector<Index_type> tmp_scan(n);
-      const int p0 = static_cast<int>(std::min(n, static_cast<Index_type>(omp_get_max_threads())));
-      ::std::vector<Index_type> thread_sums(p0);
+      const Loop_index_type n = iend - ibegin;
+      ::std::vector<Loop_index_type> tmp_scan(n);
+      const int p0 = static_cast<int>(std::min(n, static_cast<Loop_index_type>(omp_get_max_threads())));
+      ::std::vector<Loop_index_type> thread_sums(p0);
 #endif
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Index_type count = 0;
+        Loop_index_type count = 0;
 
 #if _OPENMP >= 201811 && defined(RAJA_PERFSUITE_ENABLE_OPENMP5_SCAN)
         #pragma omp parallel for reduction(inscan, +:count)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          Index_type inc = 0;
+        for (Loop_index_type i = ibegin; i < iend; ++i ) {
+          Loop_index_type inc = 0;
           if (INDEXLIST_CONDITIONAL) {
             list[count] = i ;
             inc = 1;
@@ -60,14 +66,14 @@ void INDEXLIST::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
         {
           const int p = omp_get_num_threads();
           const int pid = omp_get_thread_num();
-          const Index_type step = n / p;
-          const Index_type local_begin = pid * step + ibegin;
-          const Index_type local_end = (pid == p-1) ? iend : (pid+1) * step + ibegin;
+          const Loop_index_type step = n / p;
+          const Loop_index_type local_begin = pid * step + ibegin;
+          const Loop_index_type local_end = (pid == p-1) ? iend : (pid+1) * step + ibegin;
 
-          Index_type local_sum_var = 0;
-          for (Index_type i = local_begin; i < local_end; ++i ) {
+          Loop_index_type local_sum_var = 0;
+          for (Loop_index_type i = local_begin; i < local_end; ++i ) {
 
-            Index_type inc = 0;
+            Loop_index_type inc = 0;
             if (INDEXLIST_CONDITIONAL) {
               inc = 1;
             }
@@ -78,13 +84,13 @@ void INDEXLIST::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
           #pragma omp barrier
 
-          Index_type local_count_var = 0;
+          Loop_index_type local_count_var = 0;
           for (int ip = 0; ip < pid; ++ip) {
             local_count_var += thread_sums[ip];
           }
 
-          for (Index_type i = local_begin; i < local_end; ++i ) {
-            Index_type inc = tmp_scan[i];
+          for (Loop_index_type i = local_begin; i < local_end; ++i ) {
+            Loop_index_type inc = tmp_scan[i];
             if (inc) {
               list[local_count_var] = i ;
             }
@@ -108,8 +114,8 @@ void INDEXLIST::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
     case Lambda_OpenMP : {
 
 #if _OPENMP >= 201811 && defined(RAJA_PERFSUITE_ENABLE_OPENMP5_SCAN)
-      auto indexlist_lam = [=](Index_type i, Index_type count) {
-                                  Index_type inc = 0;
+      auto indexlist_lam = [=](Loop_index_type i, Loop_index_type count) {
+                                  Loop_index_type inc = 0;
                                   if (INDEXLIST_CONDITIONAL) {
                                     list[count] = i ;
                                     inc = 1;
@@ -117,30 +123,30 @@ void INDEXLIST::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
                                   return inc;
                                 };
 #else
-      auto indexlist_lam_input = [=](Index_type i) {
-                                  Index_type inc = 0;
+      auto indexlist_lam_input = [=](Loop_index_type i) {
+                                  Loop_index_type inc = 0;
                                   if (INDEXLIST_CONDITIONAL) {
                                     inc = 1;
                                   }
                                   return inc;
                                 };
-      auto indexlist_lam_output = [=](Index_type i, Index_type count) {
+      auto indexlist_lam_output = [=](Loop_index_type i, Loop_index_type count) {
                                   list[count] = i ;
                                 };
-      const Index_type n = iend - ibegin;
-      ::std::vector<Index_type> tmp_scan(n);
-      const int p0 = static_cast<int>(std::min(n, static_cast<Index_type>(omp_get_max_threads())));
-      ::std::vector<Index_type> thread_sums(p0);
+      const Loop_index_type n = iend - ibegin;
+      ::std::vector<Loop_index_type> tmp_scan(n);
+      const int p0 = static_cast<int>(std::min(n, static_cast<Loop_index_type>(omp_get_max_threads())));
+      ::std::vector<Loop_index_type> thread_sums(p0);
 #endif
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Index_type count = 0;
+        Loop_index_type count = 0;
 
 #if _OPENMP >= 201811 && defined(RAJA_PERFSUITE_ENABLE_OPENMP5_SCAN)
         #pragma omp parallel for reduction(inscan, +:count)
-        for (Index_type i = ibegin; i < iend; ++i ) {
+        for (Loop_index_type i = ibegin; i < iend; ++i ) {
           #pragma omp scan exclusive(count)
           count += indexlist_lam(i, count);
         }
@@ -149,14 +155,14 @@ void INDEXLIST::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
         {
           const int p = omp_get_num_threads();
           const int pid = omp_get_thread_num();
-          const Index_type step = n / p;
-          const Index_type local_begin = pid * step + ibegin;
-          const Index_type local_end = (pid == p-1) ? iend : (pid+1) * step + ibegin;
+          const Loop_index_type step = n / p;
+          const Loop_index_type local_begin = pid * step + ibegin;
+          const Loop_index_type local_end = (pid == p-1) ? iend : (pid+1) * step + ibegin;
 
-          Index_type local_sum_var = 0;
-          for (Index_type i = local_begin; i < local_end; ++i ) {
+          Loop_index_type local_sum_var = 0;
+          for (Loop_index_type i = local_begin; i < local_end; ++i ) {
 
-            Index_type inc = indexlist_lam_input(i);
+            Loop_index_type inc = indexlist_lam_input(i);
             tmp_scan[i] = inc;
             local_sum_var += inc;
           }
@@ -164,13 +170,13 @@ void INDEXLIST::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
           #pragma omp barrier
 
-          Index_type local_count_var = 0;
+          Loop_index_type local_count_var = 0;
           for (int ip = 0; ip < pid; ++ip) {
             local_count_var += thread_sums[ip];
           }
 
-          for (Index_type i = local_begin; i < local_end; ++i ) {
-            Index_type inc = tmp_scan[i];
+          for (Loop_index_type i = local_begin; i < local_end; ++i ) {
+            Loop_index_type inc = tmp_scan[i];
             if (inc) {
               indexlist_lam_output(i, local_count_var);
             }
@@ -203,5 +209,232 @@ void INDEXLIST::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 #endif
 }
 
+void INDEXLIST::runOpenMPVariantLookback(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  INDEXLIST_DATA_SETUP;
+
+  if ( vid == Base_OpenMP ) {
+
+    //
+    // Single pass over x: chunks are taken in order from a shared ticket
+    // counter, so every chunk a thread looks back at is already owned by a
+    // running thread. Each chunk is compacted into a thread local buffer,
+    // and its output offset is found by looking back at the counts
+    // published by preceding chunks. A chunk's state is
+    // (count << 2) | flag, where flag is 1 once the chunk's own count is
+    // known and 2 once the count through the end of the chunk is known.
+    //
+    const Index_type chunk_size = 4096;
+    const Index_type num_chunks = RAJA_DIVIDE_CEILING_INT(iend - ibegin, chunk_size);
+    const int num_threads = omp_get_max_threads();
+    ::std::vector<::std::atomic<Index_type>> chunk_state(num_chunks);
+    ::std::atomic<Index_type> next_chunk(0);
+    ::std::vector<Index_type> thread_buffers(num_threads * chunk_size);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      next_chunk.store(0, ::std::memory_order_relaxed);
+
+      #pragma omp parallel
+      {
+        #pragma omp for
+        for (Index_type c = 0; c < num_chunks; ++c) {
+          chunk_state[c].store(0, ::std::memory_order_relaxed);
+        }
+
+        Index_type* buffer = &thread_buffers[omp_get_thread_num() * chunk_size];
+
+        for (Index_type c = next_chunk.fetch_add(1, ::std::memory_order_relaxed);
+             c < num_chunks;
+             c = next_chunk.fetch_add(1, ::std::memory_order_relaxed)) {
+
+          const Index_type chunk_begin = ibegin + c * chunk_size;
+          const Index_type chunk_end = std::min(chunk_begin + chunk_size, iend);
+
+          Index_type chunk_count = 0;
+          for (Index_type i = chunk_begin; i < chunk_end; ++i ) {
+            buffer[chunk_count] = i;
+            chunk_count += (INDEXLIST_CONDITIONAL) ? 1 : 0;
+          }
+
+          Index_type offset = 0;
+          if ( c > 0 ) {
+            chunk_state[c].store((chunk_count << 2) | 1, ::std::memory_order_release);
+            for (Index_type pc = c-1; pc >= 0; --pc) {
+              Index_type state;
+              do {
+                state = chunk_state[pc].load(::std::memory_order_acquire);
+              } while ( state == 0 );
+              offset += state >> 2;
+              if ( (state & 3) == 2 ) {
+                break;
+              }
+            }
+          }
+          chunk_state[c].store(((offset + chunk_count) << 2) | 2, ::std::memory_order_release);
+
+          for (Index_type j = 0; j < chunk_count; ++j) {
+            list[offset + j] = buffer[j];
+          }
+        }
+      }
+
+      m_len = ( num_chunks > 0 ) ? (chunk_state[num_chunks-1].load() >> 2) : 0;
+
+    }
+    stopTimer();
+
+  } else {
+    ignore_unused(run_reps, ibegin, iend, x, list);
+    getCout() << "\n  INDEXLIST : Unknown variant id = " << vid << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void INDEXLIST::runOpenMPVariantBitmask(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  INDEXLIST_DATA_SETUP;
+
+  if ( vid == Base_OpenMP ) {
+
+    //
+    // One read pass over x: each thread packs the conditional for its part
+    // of the range into one bit per entry and counts them with popcount.
+    // After the thread counts are scanned, a second pass scatters the
+    // indices from the bit masks, which are 1/64 the size of x.
+    //
+    const Index_type n = iend - ibegin;
+    const Index_type num_words = RAJA_DIVIDE_CEILING_INT(n, 64);
+    ::std::vector<::std::uint64_t> masks(num_words);
+    const int p0 = static_cast<int>(std::max(std::min(num_words, static_cast<Index_type>(omp_get_max_threads())),
+                                             static_cast<Index_type>(1)));
+    ::std::vector<Index_type> thread_sums(p0);
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      Index_type count = 0;
+
+      #pragma omp parallel num_threads(p0)
+      {
+        const int p = omp_get_num_threads();
+        const int pid = omp_get_thread_num();
+        // spread the remainder words over the threads, one each
+        const Index_type step = num_words / p;
+        const Index_type rem = num_words % p;
+        const Index_type local_begin = pid * step + std::min(Index_type(pid), rem);
+        const Index_type local_end = local_begin + step + (pid < rem ? 1 : 0);
+
+        Index_type local_sum_var = 0;
+        for (Index_type w = local_begin; w < local_end; ++w ) {
+          const Index_type word_begin = ibegin + w * 64;
+          const Index_type word_end = std::min(word_begin + 64, iend);
+          ::std::uint64_t mask = 0;
+          for (Index_type i = word_begin; i < word_end; ++i ) {
+            mask |= ::std::uint64_t(INDEXLIST_CONDITIONAL) << (i - word_begin);
+          }
+          masks[w] = mask;
+          local_sum_var += __builtin_popcountll(mask);
+        }
+        thread_sums[pid] = local_sum_var;
+
+        #pragma omp barrier
+
+        Index_type local_count_var = 0;
+        for (int ip = 0; ip < pid; ++ip) {
+          local_count_var += thread_sums[ip];
+        }
+
+        for (Index_type w = local_begin; w < local_end; ++w ) {
+          ::std::uint64_t mask = masks[w];
+          while ( mask ) {
+            list[local_count_var++] = ibegin + w * 64 + __builtin_ctzll(mask);
+            mask &= mask - 1;
+          }
+        }
+
+        if (pid == p-1) {
+          count = local_count_var;
+        }
+      }
+
+      m_len = count;
+
+    }
+    stopTimer();
+
+  } else {
+    ignore_unused(run_reps, ibegin, iend, x, list);
+    getCout() << "\n  INDEXLIST : Unknown variant id = " << vid << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void INDEXLIST::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if ( tune_idx == t ) {
+    runOpenMPVariantScan<Index_type>(vid);
+  }
+
+  t += 1;
+
+  if ( vid == Base_OpenMP ) {
+
+    if ( tune_idx == t ) {
+      runOpenMPVariantLookback(vid);
+    }
+
+    t += 1;
+
+    if ( tune_idx == t ) {
+      runOpenMPVariantBitmask(vid);
+    }
+
+    t += 1;
+
+  }
+
+  if ( tune_idx == t &&
+       index_type::isTuning(getVariantTuningName(vid, tune_idx)) ) {
+    runOpenMPVariantScan<Int_type>(vid);
+  }
+}
+
+void INDEXLIST::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP ) {
+    addVariantTuningName(vid, "lookback");
+    addVariantTuningName(vid, "bitmask");
+  }
+
+  for (std::string const& name :
+       index_type::getTuningNames(run_params, getActualProblemSize())) {
+    addVariantTuningName(vid, name);
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
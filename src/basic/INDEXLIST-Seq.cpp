@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/IndexTypeUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,11 +20,12 @@ namespace basic
 {
 
 
-void INDEXLIST::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Loop_index_type >
+void INDEXLIST::runSeqVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
-  const Index_type ibegin = 0;
-  const Index_type iend = getActualProblemSize();
+  const Loop_index_type ibegin = 0;
+  const Loop_index_type iend = static_cast<Loop_index_type>(getActualProblemSize());
 
   INDEXLIST_DATA_SETUP;
 
@@ -33,9 +36,9 @@ void INDEXLIST::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Index_type count = 0;
+        Loop_index_type count = 0;
 
-        for (Index_type i = ibegin; i < iend; ++i ) {
+        for (Loop_index_type i = ibegin; i < iend; ++i ) {
           INDEXLIST_BODY;
         }
 
@@ -50,16 +53,16 @@ void INDEXLIST::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 #if defined(RUN_RAJA_SEQ)
     case Lambda_Seq : {
 
-      auto indexlist_base_lam = [=](Index_type i, Index_type& count) {
+      auto indexlist_base_lam = [=](Loop_index_type i, Loop_index_type& count) {
                                  INDEXLIST_BODY
                                };
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Index_type count = 0;
+        Loop_index_type count = 0;
 
-        for (Index_type i = ibegin; i < iend; ++i ) {
+        for (Loop_index_type i = ibegin; i < iend; ++i ) {
           indexlist_base_lam(i, count);
         }
 
@@ -80,5 +83,7 @@ void INDEXLIST::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 
 }
 
+RAJAPERF_SEQ_INDEX_TYPE_TUNING_DEFINE_BOILERPLATE(INDEXLIST)
+
 } // end namespace basic
 } // end namespace rajaperf
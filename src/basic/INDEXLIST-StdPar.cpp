@@ -0,0 +1,134 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "INDEXLIST.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/StdParUtils.hpp"
+
+#include <functional>
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+void INDEXLIST::runStdParVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+#if defined(RUN_STDPAR)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  INDEXLIST_DATA_SETUP;
+
+  //
+  // Scan of the 0/1 list membership of each index gives the position of
+  // each selected index in the list.
+  //
+  std::vector<Index_type> tmp_scan(iend-ibegin);
+  Index_type* counts = tmp_scan.data() - ibegin;
+
+  switch ( vid ) {
+
+    case Base_StdPar : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        std::transform_exclusive_scan( std::execution::par_unseq,
+                                       stdpar::counting_iterator(ibegin),
+                                       stdpar::counting_iterator(iend),
+                                       counts + ibegin,
+                                       Index_type(0),
+                                       std::plus<Index_type>(),
+                                       [=](Index_type i) -> Index_type {
+          return (INDEXLIST_CONDITIONAL) ? 1 : 0;
+        });
+
+        std::for_each( std::execution::par_unseq,
+                       stdpar::counting_iterator(ibegin),
+                       stdpar::counting_iterator(iend),
+                       [=](Index_type i) {
+          if (INDEXLIST_CONDITIONAL) {
+            list[counts[i]] = i;
+          }
+        });
+
+        m_len = 0;
+        if (iend > ibegin) {
+          const Index_type i = iend - 1;
+          m_len = counts[i] + ((INDEXLIST_CONDITIONAL) ? 1 : 0);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_StdPar : {
+
+      auto indexlist_lam_input = [=](Index_type i) -> Index_type {
+                                   Index_type inc = 0;
+                                   if (INDEXLIST_CONDITIONAL) {
+                                     inc = 1;
+                                   }
+                                   return inc;
+                                 };
+      auto indexlist_lam_output = [=](Index_type i) {
+                                    if (indexlist_lam_input(i)) {
+                                      list[counts[i]] = i;
+                                    }
+                                  };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        std::transform_exclusive_scan( std::execution::par_unseq,
+                                       stdpar::counting_iterator(ibegin),
+                                       stdpar::counting_iterator(iend),
+                                       counts + ibegin,
+                                       Index_type(0),
+                                       std::plus<Index_type>(),
+                                       indexlist_lam_input );
+
+        std::for_each( std::execution::par_unseq,
+                       stdpar::counting_iterator(ibegin),
+                       stdpar::counting_iterator(iend),
+                       indexlist_lam_output );
+
+        m_len = 0;
+        if (iend > ibegin) {
+          m_len = counts[iend-1] + indexlist_lam_input(iend-1);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  INDEXLIST : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace basic
+} // end namespace rajaperf
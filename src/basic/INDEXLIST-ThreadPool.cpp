@@ -0,0 +1,117 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "INDEXLIST.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/ThreadPool.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+void INDEXLIST::runThreadPoolVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+#if defined(RUN_THREADPOOL)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  INDEXLIST_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_ThreadPool : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type count = threadpool::parallel_scan(ibegin, iend, Index_type(0),
+          [=](Index_type cbegin, Index_type cend) {
+          Index_type count = 0;
+          for (Index_type i = cbegin; i < cend; ++i ) {
+            if (INDEXLIST_CONDITIONAL) {
+              count += 1;
+            }
+          }
+          return count;
+        },
+          [=](Index_type cbegin, Index_type cend, Index_type count) {
+          for (Index_type i = cbegin; i < cend; ++i ) {
+            INDEXLIST_BODY;
+          }
+        }, std::plus<Index_type>());
+
+        m_len = count;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_ThreadPool : {
+
+      auto indexlist_lam_input = [=](Index_type i) {
+                                  Index_type inc = 0;
+                                  if (INDEXLIST_CONDITIONAL) {
+                                    inc = 1;
+                                  }
+                                  return inc;
+                                };
+      auto indexlist_lam_output = [=](Index_type i, Index_type count) {
+                                  list[count] = i ;
+                                };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type count = threadpool::parallel_scan(ibegin, iend, Index_type(0),
+          [=](Index_type cbegin, Index_type cend) {
+          Index_type count = 0;
+          for (Index_type i = cbegin; i < cend; ++i ) {
+            count += indexlist_lam_input(i);
+          }
+          return count;
+        },
+          [=](Index_type cbegin, Index_type cend, Index_type count) {
+          for (Index_type i = cbegin; i < cend; ++i ) {
+            Index_type inc = indexlist_lam_input(i);
+            if (inc) {
+              indexlist_lam_output(i, count);
+            }
+            count += inc;
+          }
+        }, std::plus<Index_type>());
+
+        m_len = count;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  INDEXLIST : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -29,7 +29,7 @@ INDEXLIST::INDEXLIST(const RunParams& params)
   setItsPerRep( getActualProblemSize() );
   setKernelsPerRep(1);
   setBytesPerRep( (1*sizeof(Index_type) + 1*sizeof(Index_type)) +
-                  (1*sizeof(Int_type) + 0*sizeof(Int_type)) * getActualProblemSize() / 2 + // about 50% output
+                  (1*sizeof(Int_type) + 0*sizeof(Int_type)) * getActualProblemSize() * params.getIndexListSelectivity() +
                   (0*sizeof(Real_type) + 1*sizeof(Real_type)) * getActualProblemSize() );
   setFLOPsPerRep(0);
 
@@ -49,6 +49,12 @@ INDEXLIST::INDEXLIST(const RunParams& params)
   setVariantDefined( Base_CUDA );
 
   setVariantDefined( Base_HIP );
+
+  setVariantDefined( Base_ThreadPool );
+  setVariantDefined( Lambda_ThreadPool );
+
+  setVariantDefined( Base_StdPar );
+  setVariantDefined( Lambda_StdPar );
 }
 
 INDEXLIST::~INDEXLIST()
@@ -57,7 +63,9 @@ INDEXLIST::~INDEXLIST()
 
 void INDEXLIST::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  allocAndInitDataRandSign(m_x, getActualProblemSize(), vid);
+  allocAndInitDataRandSign(m_x, getActualProblemSize(),
+                           run_params.getIndexListSelectivity(),
+                           run_params.getIndexListClustered(), vid);
   allocAndInitData(m_list, getActualProblemSize(), vid);
   m_len = -1;
 }
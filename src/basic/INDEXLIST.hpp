@@ -17,6 +17,20 @@
 /// }
 /// Index_type len = count;
 ///
+/// The fraction of entries with x[i] < 0.0, and whether they are spread
+/// uniformly or in runs, are set with the --indexlist_selectivity and
+/// --indexlist_pattern options.
+///
+/// Besides the default scan based implementation, Base_OpenMP has tunings
+/// that read x only once: 'lookback' compacts chunks into thread local
+/// buffers in a single pass and finds their output offsets by looking back
+/// at preceding chunks, 'bitmask' packs the conditional into bit masks and
+/// counts them with popcount in one read pass over x, then writes the
+/// indices in a second pass over the masks, which are 1/64 the size of x.
+///
+/// The Seq variants, and the scan based OpenMP variants, have an 'int32'
+/// tuning (--index_type) that runs with Int_type loop indices and counts.
+///
 
 #ifndef RAJAPerf_Basic_INDEXLIST_HPP
 #define RAJAPerf_Basic_INDEXLIST_HPP
@@ -60,7 +74,17 @@ public:
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
-
+  void runThreadPoolVariant(VariantID vid, size_t tune_idx);
+  void runStdParVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  template < typename Loop_index_type >
+  void runSeqVariantImpl(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  template < typename Loop_index_type >
+  void runOpenMPVariantScan(VariantID vid);
+  void runOpenMPVariantLookback(VariantID vid);
+  void runOpenMPVariantBitmask(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
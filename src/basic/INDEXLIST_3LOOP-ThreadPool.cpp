@@ -0,0 +1,135 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/COPYRIGHT file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "INDEXLIST_3LOOP.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/ThreadPool.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+#define INDEXLIST_3LOOP_DATA_SETUP_THREADPOOL \
+  Index_type* counts = new Index_type[iend+1];
+
+#define INDEXLIST_3LOOP_DATA_TEARDOWN_THREADPOOL \
+  delete[] counts; counts = nullptr;
+
+
+void INDEXLIST_3LOOP::runThreadPoolVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+#if defined(RUN_THREADPOOL)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  INDEXLIST_3LOOP_DATA_SETUP;
+
+  INDEXLIST_3LOOP_DATA_SETUP_THREADPOOL;
+
+  //
+  // Chunk methods for two-pass in-place exclusive scan of counts.
+  //
+  auto counts_reduce = [=](Index_type cbegin, Index_type cend) {
+                         Index_type count = 0;
+                         for (Index_type i = cbegin; i < cend; ++i ) {
+                           count += counts[i];
+                         }
+                         return count;
+                       };
+  auto counts_scan = [=](Index_type cbegin, Index_type cend, Index_type count) {
+                       for (Index_type i = cbegin; i < cend; ++i ) {
+                         Index_type inc = counts[i];
+                         counts[i] = count;
+                         count += inc;
+                       }
+                     };
+
+  switch ( vid ) {
+
+    case Base_ThreadPool : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        threadpool::parallel_for(ibegin, iend,
+          [=](Index_type cbegin, Index_type cend) {
+          for (Index_type i = cbegin; i < cend; ++i ) {
+            counts[i] = (INDEXLIST_3LOOP_CONDITIONAL) ? 1 : 0;
+          }
+        });
+
+        threadpool::parallel_scan(ibegin, iend+1, Index_type(0),
+          counts_reduce, counts_scan,
+          std::plus<Index_type>());
+
+        threadpool::parallel_for(ibegin, iend,
+          [=](Index_type cbegin, Index_type cend) {
+          for (Index_type i = cbegin; i < cend; ++i ) {
+            INDEXLIST_3LOOP_MAKE_LIST;
+          }
+        });
+
+        m_len = counts[iend];
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_ThreadPool : {
+
+      auto indexlist_conditional_lam = [=](Index_type i) {
+                                  counts[i] = (INDEXLIST_3LOOP_CONDITIONAL) ? 1 : 0;
+                                };
+
+      auto indexlist_make_list_lam = [=](Index_type i) {
+                                  INDEXLIST_3LOOP_MAKE_LIST;
+                                };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        threadpool::forall(ibegin, iend, indexlist_conditional_lam);
+
+        threadpool::parallel_scan(ibegin, iend+1, Index_type(0),
+          counts_reduce, counts_scan,
+          std::plus<Index_type>());
+
+        threadpool::forall(ibegin, iend, indexlist_make_list_lam);
+
+        m_len = counts[iend];
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  INDEXLIST_3LOOP : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  INDEXLIST_3LOOP_DATA_TEARDOWN_THREADPOOL;
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace basic
+} // end namespace rajaperf
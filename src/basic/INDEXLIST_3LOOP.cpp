@@ -35,7 +35,7 @@ INDEXLIST_3LOOP::INDEXLIST_3LOOP(const RunParams& params)
                   (1*sizeof(Int_type) + 1*sizeof(Int_type)) * (getActualProblemSize()+1) +
 
                   (0*sizeof(Int_type) + 1*sizeof(Int_type)) * (getActualProblemSize()+1) +
-                  (1*sizeof(Int_type) + 0*sizeof(Int_type)) * getActualProblemSize() / 2 ); // about 50% output
+                  (1*sizeof(Int_type) + 0*sizeof(Int_type)) * getActualProblemSize() * params.getIndexListSelectivity() );
   setFLOPsPerRep(0);
 
   setUsesFeature(Forall);
@@ -58,6 +58,9 @@ INDEXLIST_3LOOP::INDEXLIST_3LOOP(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  setVariantDefined( Base_ThreadPool );
+  setVariantDefined( Lambda_ThreadPool );
 }
 
 INDEXLIST_3LOOP::~INDEXLIST_3LOOP()
@@ -66,7 +69,9 @@ INDEXLIST_3LOOP::~INDEXLIST_3LOOP()
 
 void INDEXLIST_3LOOP::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
-  allocAndInitDataRandSign(m_x, getActualProblemSize(), vid);
+  allocAndInitDataRandSign(m_x, getActualProblemSize(),
+                           run_params.getIndexListSelectivity(),
+                           run_params.getIndexListClustered(), vid);
   allocAndInitData(m_list, getActualProblemSize(), vid);
   m_len = -1;
 }
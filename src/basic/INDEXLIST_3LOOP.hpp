@@ -28,6 +28,10 @@
 ///
 /// Index_type len = counts[iend];
 ///
+/// The fraction of entries with x[i] < 0.0, and whether they are spread
+/// uniformly or in runs, are set with the --indexlist_selectivity and
+/// --indexlist_pattern options.
+///
 
 #ifndef RAJAPerf_Basic_INDEXLIST_3LOOP_HPP
 #define RAJAPerf_Basic_INDEXLIST_3LOOP_HPP
@@ -71,6 +75,7 @@ public:
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+  void runThreadPoolVariant(VariantID vid, size_t tune_idx);
 
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
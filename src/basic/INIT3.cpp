@@ -53,6 +53,12 @@ INIT3::INIT3(const RunParams& params)
   setVariantDefined( RAJA_HIP );
 
   setVariantDefined( Kokkos_Lambda );
+
+  setVariantDefined( Base_ThreadPool );
+  setVariantDefined( Lambda_ThreadPool );
+
+  setVariantDefined( Base_SIMD );
+  setVariantDefined( RAJA_SIMD );
 }
 
 INIT3::~INIT3()
@@ -54,6 +54,12 @@ INIT_VIEW1D::INIT_VIEW1D(const RunParams& params)
   setVariantDefined( RAJA_HIP );
 
   setVariantDefined( Kokkos_Lambda );
+
+  setVariantDefined( Base_ThreadPool );
+  setVariantDefined( Lambda_ThreadPool );
+
+  setVariantDefined( Base_SIMD );
+  setVariantDefined( RAJA_SIMD );
 }
 
 INIT_VIEW1D::~INIT_VIEW1D()
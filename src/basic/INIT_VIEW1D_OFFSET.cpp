@@ -54,6 +54,12 @@ INIT_VIEW1D_OFFSET::INIT_VIEW1D_OFFSET(const RunParams& params)
   setVariantDefined( RAJA_HIP );
 
   setVariantDefined( Kokkos_Lambda );
+
+  setVariantDefined( Base_ThreadPool );
+  setVariantDefined( Lambda_ThreadPool );
+
+  setVariantDefined( Base_SIMD );
+  setVariantDefined( RAJA_SIMD );
 }
 
 INIT_VIEW1D_OFFSET::~INIT_VIEW1D_OFFSET()
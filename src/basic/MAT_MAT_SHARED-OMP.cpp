@@ -10,12 +10,13 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 namespace rajaperf {
 namespace basic {
 
-void MAT_MAT_SHARED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+void MAT_MAT_SHARED::runOpenMPVariantShared(VariantID vid) {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
   const Index_type run_reps = getRunReps();
@@ -256,5 +257,153 @@ void MAT_MAT_SHARED::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 #endif
 }
 
+template < size_t tile_size >
+void MAT_MAT_SHARED::runOpenMPVariantTiled(VariantID vid) {
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type N = m_N;
+
+  MAT_MAT_SHARED_DATA_SETUP;
+
+  if (vid == Base_OpenMP) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      #pragma omp parallel for
+      for (Index_type ib = 0; ib < N; ib += tile_size) {
+        const Index_type ie = std::min(ib + Index_type(tile_size), N);
+        MAT_MAT_SHARED_CPU_TILED_BODY(ib, ie, tile_size)
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  MAT_MAT_SHARED : Unknown variant id = " << vid
+              << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void MAT_MAT_SHARED::runOpenMPVariantPacked(VariantID vid) {
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type N = m_N;
+
+  MAT_MAT_SHARED_DATA_SETUP;
+
+  if (vid == Base_OpenMP) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      #pragma omp parallel for
+      for (Index_type ib = 0; ib < N; ib += cpu_row_block) {
+        const Index_type ie = std::min(ib + cpu_row_block, N);
+        MAT_MAT_SHARED_CPU_PACKED_BODY(ib, ie, packed_kc, packed_mr, packed_nr)
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  MAT_MAT_SHARED : Unknown variant id = " << vid
+              << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void MAT_MAT_SHARED::runOpenMPVariantTwoLevel(VariantID vid) {
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type N = m_N;
+
+  MAT_MAT_SHARED_DATA_SETUP;
+
+  if (vid == Base_OpenMP) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      #pragma omp parallel for
+      for (Index_type ib = 0; ib < N; ib += cpu_row_block) {
+        const Index_type ie = std::min(ib + cpu_row_block, N);
+        MAT_MAT_SHARED_CPU_TWO_LEVEL_BODY(ib, ie, two_level_l2, two_level_l1)
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  MAT_MAT_SHARED : Unknown variant id = " << vid
+              << std::endl;
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void MAT_MAT_SHARED::runOpenMPVariant(VariantID vid, size_t tune_idx) {
+
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runOpenMPVariantShared(vid);
+  }
+
+  t += 1;
+
+  if (vid == Base_OpenMP) {
+
+    seq_for(cpu_tile_sizes_type{}, [&](auto tile_size) {
+      if (tune_idx == t) {
+        runOpenMPVariantTiled<tile_size>(vid);
+      }
+      t += 1;
+    });
+
+    if (tune_idx == t) {
+      runOpenMPVariantPacked(vid);
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+      runOpenMPVariantTwoLevel(vid);
+    }
+
+    t += 1;
+  }
+}
+
+void MAT_MAT_SHARED::setOpenMPTuningDefinitions(VariantID vid) {
+
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if (vid == Base_OpenMP) {
+
+    seq_for(cpu_tile_sizes_type{}, [&](auto tile_size) {
+      addVariantTuningName(vid, "tile_"+std::to_string(tile_size));
+    });
+
+    addVariantTuningName(vid, "packed_"+std::to_string(packed_mr)+
+                              "x"+std::to_string(packed_nr));
+
+    addVariantTuningName(vid, "two_level_"+std::to_string(two_level_l2)+
+                              "_"+std::to_string(two_level_l1));
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
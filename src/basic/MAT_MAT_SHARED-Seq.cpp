@@ -8,12 +8,13 @@
 
 #include "MAT_MAT_SHARED.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 namespace rajaperf {
 namespace basic {
 
-void MAT_MAT_SHARED::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)) {
+void MAT_MAT_SHARED::runSeqVariantShared(VariantID vid) {
 
   const Index_type run_reps = getRunReps();
   const Index_type N = m_N;
@@ -250,5 +251,126 @@ void MAT_MAT_SHARED::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
   }
 }
 
+template < size_t tile_size >
+void MAT_MAT_SHARED::runSeqVariantTiled(VariantID vid) {
+  const Index_type run_reps = getRunReps();
+  const Index_type N = m_N;
+
+  MAT_MAT_SHARED_DATA_SETUP;
+
+  if (vid == Base_Seq) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      for (Index_type ib = 0; ib < N; ib += tile_size) {
+        const Index_type ie = std::min(ib + Index_type(tile_size), N);
+        MAT_MAT_SHARED_CPU_TILED_BODY(ib, ie, tile_size)
+      }
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  MAT_MAT_SHARED : Unknown variant id = " << vid
+              << std::endl;
+  }
+}
+
+void MAT_MAT_SHARED::runSeqVariantPacked(VariantID vid) {
+  const Index_type run_reps = getRunReps();
+  const Index_type N = m_N;
+
+  MAT_MAT_SHARED_DATA_SETUP;
+
+  if (vid == Base_Seq) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      MAT_MAT_SHARED_CPU_PACKED_BODY(0, N, packed_kc, packed_mr, packed_nr)
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  MAT_MAT_SHARED : Unknown variant id = " << vid
+              << std::endl;
+  }
+}
+
+void MAT_MAT_SHARED::runSeqVariantTwoLevel(VariantID vid) {
+  const Index_type run_reps = getRunReps();
+  const Index_type N = m_N;
+
+  MAT_MAT_SHARED_DATA_SETUP;
+
+  if (vid == Base_Seq) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      MAT_MAT_SHARED_CPU_TWO_LEVEL_BODY(0, N, two_level_l2, two_level_l1)
+
+    }
+    stopTimer();
+
+  } else {
+    getCout() << "\n  MAT_MAT_SHARED : Unknown variant id = " << vid
+              << std::endl;
+  }
+}
+
+void MAT_MAT_SHARED::runSeqVariant(VariantID vid, size_t tune_idx) {
+
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runSeqVariantShared(vid);
+  }
+
+  t += 1;
+
+  if (vid == Base_Seq) {
+
+    seq_for(cpu_tile_sizes_type{}, [&](auto tile_size) {
+      if (tune_idx == t) {
+        runSeqVariantTiled<tile_size>(vid);
+      }
+      t += 1;
+    });
+
+    if (tune_idx == t) {
+      runSeqVariantPacked(vid);
+    }
+
+    t += 1;
+
+    if (tune_idx == t) {
+      runSeqVariantTwoLevel(vid);
+    }
+
+    t += 1;
+  }
+}
+
+void MAT_MAT_SHARED::setSeqTuningDefinitions(VariantID vid) {
+
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if (vid == Base_Seq) {
+
+    seq_for(cpu_tile_sizes_type{}, [&](auto tile_size) {
+      addVariantTuningName(vid, "tile_"+std::to_string(tile_size));
+    });
+
+    addVariantTuningName(vid, "packed_"+std::to_string(packed_mr)+
+                              "x"+std::to_string(packed_nr));
+
+    addVariantTuningName(vid, "two_level_"+std::to_string(two_level_l2)+
+                              "_"+std::to_string(two_level_l1));
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -60,6 +60,9 @@ MAT_MAT_SHARED::MAT_MAT_SHARED(const RunParams &params)
   setVariantDefined(Base_HIP);
   setVariantDefined(Lambda_HIP);
   setVariantDefined(RAJA_HIP);
+
+  setVariantDefined(Base_ThreadPool);
+  setVariantDefined(Lambda_ThreadPool);
 }
 
 MAT_MAT_SHARED::~MAT_MAT_SHARED() {}
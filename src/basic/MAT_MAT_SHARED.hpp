@@ -61,6 +61,14 @@
 ///        }
 ///      }
 ///
+/// Base_Seq and Base_OpenMP also have CPU tunings that compute C = A * B
+/// directly, without the tile copies above:
+///   - tile_<T>: i-k-j loops over T x T cache blocks, for each T in
+///     cpu_tile_sizes_type
+///   - packed_<MR>x<NR>: panels of B are packed contiguously and an
+///     MR x NR block of C is accumulated in registers
+///   - two_level_<L2>_<L1>: L2 sized blocks of B, each computed with L1
+///     sized i-k-j tiles
 ///
 
 #ifndef RAJAPerf_Basic_MAT_MAT_SHARED_HPP
@@ -119,6 +127,104 @@ constexpr rajaperf::Index_type TL_SZ = 16;
   if (Row < N && Col < N)                                                      \
     C[Col + N * Row] = Cs[ty][tx];
 
+//
+// CPU tunings, each computes the rows [i0, i1) of C.
+//
+#define MAT_MAT_SHARED_CPU_ZERO_ROWS(i0, i1)                                   \
+  for (Index_type i = i0; i < i1; ++i) {                                       \
+    for (Index_type j = 0; j < N; ++j) {                                       \
+      C[j + N * i] = 0.0;                                                      \
+    }                                                                          \
+  }
+
+#define MAT_MAT_SHARED_CPU_TILE(i0, i1, k0, k1, j0, j1)                        \
+  for (Index_type i = i0; i < i1; ++i) {                                       \
+    for (Index_type k = k0; k < k1; ++k) {                                     \
+      const Real_type a_ik = A[k + N * i];                                     \
+      for (Index_type j = j0; j < j1; ++j) {                                   \
+        C[j + N * i] += a_ik * B[j + N * k];                                   \
+      }                                                                        \
+    }                                                                          \
+  }
+
+#define MAT_MAT_SHARED_CPU_TILED_BODY(i0, i1, tile_size)                       \
+  MAT_MAT_SHARED_CPU_ZERO_ROWS(i0, i1)                                         \
+  for (Index_type kk = 0; kk < N; kk += tile_size) {                           \
+    const Index_type kend = std::min(kk + Index_type(tile_size), N);           \
+    for (Index_type jj = 0; jj < N; jj += tile_size) {                         \
+      const Index_type jend = std::min(jj + Index_type(tile_size), N);         \
+      MAT_MAT_SHARED_CPU_TILE(i0, i1, kk, kend, jj, jend)                      \
+    }                                                                          \
+  }
+
+#define MAT_MAT_SHARED_CPU_TWO_LEVEL_BODY(i0, i1, l2_size, l1_size)            \
+  MAT_MAT_SHARED_CPU_ZERO_ROWS(i0, i1)                                         \
+  for (Index_type kk2 = 0; kk2 < N; kk2 += l2_size) {                          \
+    const Index_type kend2 = std::min(kk2 + l2_size, N);                       \
+    for (Index_type jj2 = 0; jj2 < N; jj2 += l2_size) {                        \
+      const Index_type jend2 = std::min(jj2 + l2_size, N);                     \
+      for (Index_type ii = i0; ii < i1; ii += l1_size) {                       \
+        const Index_type iend = std::min(ii + l1_size, Index_type(i1));        \
+        for (Index_type kk = kk2; kk < kend2; kk += l1_size) {                 \
+          const Index_type kend = std::min(kk + l1_size, kend2);               \
+          for (Index_type jj = jj2; jj < jend2; jj += l1_size) {               \
+            const Index_type jend = std::min(jj + l1_size, jend2);             \
+            MAT_MAT_SHARED_CPU_TILE(ii, iend, kk, kend, jj, jend)              \
+          }                                                                    \
+        }                                                                      \
+      }                                                                        \
+    }                                                                          \
+  }
+
+// Accumulates rows [ii, ii+rows) of an MR x NR block of C in Cr; full
+// blocks pass the constant MR so the loops fully unroll.
+#define MAT_MAT_SHARED_CPU_PACKED_MICRO(rows, nr)                              \
+  for (Index_type k = kk; k < kend; ++k) {                                     \
+    for (Index_type r = 0; r < rows; ++r) {                                    \
+      const Real_type a_rk = A[k + N * (ii + r)];                              \
+      for (Index_type j = 0; j < nr; ++j) {                                    \
+        Cr[r][j] += a_rk * Bp[j + nr * (k - kk)];                              \
+      }                                                                        \
+    }                                                                          \
+  }
+
+#define MAT_MAT_SHARED_CPU_PACKED_BODY(i0, i1, kc, mr, nr)                     \
+  MAT_MAT_SHARED_CPU_ZERO_ROWS(i0, i1)                                         \
+  Real_type Bp[kc * nr];                                                       \
+  for (Index_type kk = 0; kk < N; kk += kc) {                                  \
+    const Index_type kend = std::min(kk + kc, N);                              \
+    for (Index_type jj = 0; jj < N; jj += nr) {                                \
+      const Index_type jn = std::min(Index_type(nr), N - jj);                  \
+      for (Index_type k = kk; k < kend; ++k) {                                 \
+        for (Index_type j = 0; j < jn; ++j) {                                  \
+          Bp[j + nr * (k - kk)] = B[jj + j + N * k];                           \
+        }                                                                      \
+        for (Index_type j = jn; j < nr; ++j) {                                 \
+          Bp[j + nr * (k - kk)] = 0.0;                                         \
+        }                                                                      \
+      }                                                                        \
+      for (Index_type ii = i0; ii < i1; ii += mr) {                            \
+        const Index_type in = std::min(Index_type(mr), Index_type(i1) - ii);   \
+        Real_type Cr[mr][nr];                                                  \
+        for (Index_type r = 0; r < mr; ++r) {                                  \
+          for (Index_type j = 0; j < nr; ++j) {                                \
+            Cr[r][j] = 0.0;                                                    \
+          }                                                                    \
+        }                                                                      \
+        if (in == mr) {                                                        \
+          MAT_MAT_SHARED_CPU_PACKED_MICRO(mr, nr)                              \
+        } else {                                                               \
+          MAT_MAT_SHARED_CPU_PACKED_MICRO(in, nr)                              \
+        }                                                                      \
+        for (Index_type r = 0; r < in; ++r) {                                  \
+          for (Index_type j = 0; j < jn; ++j) {                                \
+            C[jj + j + N * (ii + r)] += Cr[r][j];                              \
+          }                                                                    \
+        }                                                                      \
+      }                                                                        \
+    }                                                                          \
+  }
+
 namespace rajaperf {
 class RunParams;
 
@@ -139,7 +245,20 @@ public:
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
+  void runThreadPoolVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantShared(VariantID vid);
+  void runOpenMPVariantShared(VariantID vid);
+  template < size_t tile_size >
+  void runSeqVariantTiled(VariantID vid);
+  template < size_t tile_size >
+  void runOpenMPVariantTiled(VariantID vid);
+  void runSeqVariantPacked(VariantID vid);
+  void runOpenMPVariantPacked(VariantID vid);
+  void runSeqVariantTwoLevel(VariantID vid);
+  void runOpenMPVariantTwoLevel(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
@@ -151,6 +270,14 @@ private:
   static const size_t default_gpu_block_size = TL_SZ * TL_SZ;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size, gpu_block_size::ExactSqrt>;
 
+  using cpu_tile_sizes_type = camp::int_seq<size_t, 32, 64, 128>;
+  static const Index_type packed_kc = 256;
+  static const Index_type packed_mr = 4;
+  static const Index_type packed_nr = 8;
+  static const Index_type two_level_l2 = 256;
+  static const Index_type two_level_l1 = 32;
+  static const Index_type cpu_row_block = 64; // rows per OpenMP iteration
+
   Real_ptr m_A;
   Real_ptr m_B;
   Real_ptr m_C;
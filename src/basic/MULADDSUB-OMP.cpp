@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/OpenMPUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,17 +20,18 @@ namespace basic
 {
 
 
-void MULADDSUB::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Loop_index_type, bool runtime_schedule >
+void MULADDSUB::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
   const Index_type run_reps = getRunReps();
-  const Index_type ibegin = 0;
-  const Index_type iend = getActualProblemSize();
+  const Loop_index_type ibegin = 0;
+  const Loop_index_type iend = static_cast<Loop_index_type>(getActualProblemSize());
 
   MULADDSUB_DATA_SETUP;
 
-  auto mas_lam = [=](Index_type i) {
+  auto mas_lam = [=](Loop_index_type i) {
                    MULADDSUB_BODY;
                  };
 
@@ -39,9 +42,16 @@ void MULADDSUB::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          MULADDSUB_BODY;
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime)
+          for (Loop_index_type i = ibegin; i < iend; ++i ) {
+            MULADDSUB_BODY;
+          }
+        } else {
+          #pragma omp parallel for
+          for (Loop_index_type i = ibegin; i < iend; ++i ) {
+            MULADDSUB_BODY;
+          }
         }
 
       }
@@ -55,9 +65,16 @@ void MULADDSUB::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          mas_lam(i);
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime)
+          for (Loop_index_type i = ibegin; i < iend; ++i ) {
+            mas_lam(i);
+          }
+        } else {
+          #pragma omp parallel for
+          for (Loop_index_type i = ibegin; i < iend; ++i ) {
+            mas_lam(i);
+          }
         }
 
       }
@@ -71,8 +88,8 @@ void MULADDSUB::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::forall<RAJA::omp_parallel_for_exec>(
-          RAJA::RangeSegment(ibegin, iend), mas_lam);
+        RAJA::forall<omp_schedule::parallel_for_exec<runtime_schedule>>(
+          RAJA::TypedRangeSegment<Loop_index_type>(ibegin, iend), mas_lam);
 
       }
       stopTimer();
@@ -91,5 +108,7 @@ void MULADDSUB::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 #endif
 }
 
+RAJAPERF_OPENMP_SCHEDULE_INDEX_TYPE_TUNING_DEFINE_BOILERPLATE(MULADDSUB)
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -18,15 +18,16 @@ namespace basic
 {
 
 
-void MULADDSUB::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Loop_index_type >
+void MULADDSUB::runSeqVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
-  const Index_type ibegin = 0;
-  const Index_type iend = getActualProblemSize();
+  const Loop_index_type ibegin = 0;
+  const Loop_index_type iend = static_cast<Loop_index_type>(getActualProblemSize());
 
   MULADDSUB_DATA_SETUP;
 
-  auto mas_lam = [=](Index_type i) {
+  auto mas_lam = [=](Loop_index_type i) {
                    MULADDSUB_BODY;
                  };
 
@@ -37,7 +38,7 @@ void MULADDSUB::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        for (Index_type i = ibegin; i < iend; ++i ) {
+        for (Loop_index_type i = ibegin; i < iend; ++i ) {
           MULADDSUB_BODY;
         }
 
@@ -53,7 +54,7 @@ void MULADDSUB::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        for (Index_type i = ibegin; i < iend; ++i ) {
+        for (Loop_index_type i = ibegin; i < iend; ++i ) {
           mas_lam(i);
         }
 
@@ -69,7 +70,7 @@ void MULADDSUB::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         RAJA::forall<RAJA::simd_exec>(
-          RAJA::RangeSegment(ibegin, iend), mas_lam);
+          RAJA::TypedRangeSegment<Loop_index_type>(ibegin, iend), mas_lam);
 
       }
       stopTimer();
@@ -86,5 +87,7 @@ void MULADDSUB::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 
 }
 
+RAJAPERF_SEQ_INDEX_TYPE_TUNING_DEFINE_BOILERPLATE(MULADDSUB)
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -10,6 +10,9 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/OpenMPUtils.hpp"
+
+#include <algorithm>
 #include <iostream>
 
 namespace rajaperf
@@ -17,11 +20,111 @@ namespace rajaperf
 namespace basic
 {
 
-//#define USE_OMP_COLLAPSE
-#undef USE_OMP_COLLAPSE
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+//
+// RAJA kernel policy that parallelizes the outer collapse_depth loops.
+//
+template < size_t collapse_depth >
+struct NestedInitOpenMPPolicy;
+
+template < >
+struct NestedInitOpenMPPolicy<1>
+{
+  using type =
+    RAJA::KernelPolicy<
+      RAJA::statement::For<2, RAJA::omp_parallel_for_exec,  // k
+        RAJA::statement::For<1, RAJA::loop_exec,            // j
+          RAJA::statement::For<0, RAJA::loop_exec,          // i
+            RAJA::statement::Lambda<0>
+          >
+        >
+      >
+    >;
+};
 
+template < >
+struct NestedInitOpenMPPolicy<2>
+{
+  using type =
+    RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
+                                RAJA::ArgList<2, 1>,        // k, j
+        RAJA::statement::For<0, RAJA::loop_exec,            // i
+          RAJA::statement::Lambda<0>
+        >
+      >
+    >;
+};
 
-void NESTED_INIT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < >
+struct NestedInitOpenMPPolicy<3>
+{
+  using type =
+    RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
+                                RAJA::ArgList<2, 1, 0>,     // k, j, i
+        RAJA::statement::Lambda<0>
+      >
+    >;
+};
+
+//
+// RAJA kernel policies for the loop order and tiling tunings, which
+// parallelize the outermost loop.
+//
+template < size_t loop_order >
+using NestedInitOpenMPOrderPolicy =
+  RAJA::KernelPolicy<
+    RAJA::statement::For<loop_order / 100, RAJA::omp_parallel_for_exec, // outer
+      RAJA::statement::For<(loop_order / 10) % 10, RAJA::loop_exec,     // middle
+        RAJA::statement::For<loop_order % 10, RAJA::loop_exec,          // inner
+          RAJA::statement::Lambda<0>
+        >
+      >
+    >
+  >;
+
+template < size_t tile_size >
+using NestedInitOpenMPTile2DPolicy =
+  RAJA::KernelPolicy<
+    RAJA::statement::For<2, RAJA::omp_parallel_for_exec,                 // k
+      RAJA::statement::Tile<1, RAJA::tile_fixed<tile_size>, RAJA::loop_exec,
+        RAJA::statement::Tile<0, RAJA::tile_fixed<tile_size>, RAJA::loop_exec,
+          RAJA::statement::For<1, RAJA::loop_exec,                       // j
+            RAJA::statement::For<0, RAJA::loop_exec,                     // i
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >
+      >
+    >
+  >;
+
+template < size_t tile_size >
+using NestedInitOpenMPTile3DPolicy =
+  RAJA::KernelPolicy<
+    RAJA::statement::Tile<2, RAJA::tile_fixed<tile_size>,
+                          RAJA::omp_parallel_for_exec,
+      RAJA::statement::Tile<1, RAJA::tile_fixed<tile_size>, RAJA::loop_exec,
+        RAJA::statement::Tile<0, RAJA::tile_fixed<tile_size>, RAJA::loop_exec,
+          RAJA::statement::For<2, RAJA::loop_exec,                       // k
+            RAJA::statement::For<1, RAJA::loop_exec,                     // j
+              RAJA::statement::For<0, RAJA::loop_exec,                   // i
+                RAJA::statement::Lambda<0>
+              >
+            >
+          >
+        >
+      >
+    >
+  >;
+
+#endif
+
+
+template < size_t collapse_depth >
+void NESTED_INIT::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -40,11 +143,31 @@ void NESTED_INIT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-#if defined(USE_OMP_COLLAPSE)
+        if (collapse_depth == 3) {
+
           #pragma omp parallel for collapse(3)
-#else
+          for (Index_type k = 0; k < nk; ++k ) {
+            for (Index_type j = 0; j < nj; ++j ) {
+              for (Index_type i = 0; i < ni; ++i ) {
+                NESTED_INIT_BODY;
+              }
+            }
+          }
+
+        } else if (collapse_depth == 2) {
+
+          #pragma omp parallel for collapse(2)
+          for (Index_type k = 0; k < nk; ++k ) {
+            for (Index_type j = 0; j < nj; ++j ) {
+              for (Index_type i = 0; i < ni; ++i ) {
+                NESTED_INIT_BODY;
+              }
+            }
+          }
+
+        } else {
+
           #pragma omp parallel for
-#endif
           for (Index_type k = 0; k < nk; ++k ) {
             for (Index_type j = 0; j < nj; ++j ) {
               for (Index_type i = 0; i < ni; ++i ) {
@@ -53,6 +176,8 @@ void NESTED_INIT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
             }
           }
 
+        }
+
       }
       stopTimer();
 
@@ -64,11 +189,31 @@ void NESTED_INIT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-#if defined(USE_OMP_COLLAPSE)
+        if (collapse_depth == 3) {
+
           #pragma omp parallel for collapse(3)
-#else
+          for (Index_type k = 0; k < nk; ++k ) {
+            for (Index_type j = 0; j < nj; ++j ) {
+              for (Index_type i = 0; i < ni; ++i ) {
+                nestedinit_lam(i, j, k);
+              }
+            }
+          }
+
+        } else if (collapse_depth == 2) {
+
+          #pragma omp parallel for collapse(2)
+          for (Index_type k = 0; k < nk; ++k ) {
+            for (Index_type j = 0; j < nj; ++j ) {
+              for (Index_type i = 0; i < ni; ++i ) {
+                nestedinit_lam(i, j, k);
+              }
+            }
+          }
+
+        } else {
+
           #pragma omp parallel for
-#endif
           for (Index_type k = 0; k < nk; ++k ) {
             for (Index_type j = 0; j < nj; ++j ) {
               for (Index_type i = 0; i < ni; ++i ) {
@@ -77,6 +222,8 @@ void NESTED_INIT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
             }
           }
 
+        }
+
       }
       stopTimer();
 
@@ -85,26 +232,205 @@ void NESTED_INIT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 
     case RAJA_OpenMP : {
 
-#if defined(USE_OMP_COLLAPSE)
-      using EXEC_POL =
-        RAJA::KernelPolicy<
-          RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
-                                    RAJA::ArgList<2, 1, 0>,  // k, j, i
-            RAJA::statement::Lambda<0>
-          >
-        >;
+      using EXEC_POL = typename NestedInitOpenMPPolicy<collapse_depth>::type;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment(0, ni),
+                                                 RAJA::RangeSegment(0, nj),
+                                                 RAJA::RangeSegment(0, nk)),
+                                nestedinit_lam
+                              );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  NESTED_INIT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
 #else
-      using EXEC_POL =
-        RAJA::KernelPolicy<
-          RAJA::statement::For<2, RAJA::omp_parallel_for_exec,  // k
-            RAJA::statement::For<1, RAJA::loop_exec,            // j
-              RAJA::statement::For<0, RAJA::loop_exec,          // i
-                RAJA::statement::Lambda<0>
-              >
-            >
-          >
-        >;
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+template < size_t loop_order >
+void NESTED_INIT::runOpenMPVariantOrder(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  NESTED_INIT_DATA_SETUP;
+
+  auto nestedinit_lam = [=](Index_type i, Index_type j, Index_type k) {
+                          NESTED_INIT_BODY;
+                        };
+
+  //
+  // Loop extents and indices are held in arrays indexed by loop argument,
+  // the compile time loop order picks which one each loop runs over.
+  //
+  constexpr size_t outer = loop_order / 100;
+  constexpr size_t middle = (loop_order / 10) % 10;
+  constexpr size_t inner = loop_order % 10;
+  const Index_type n[3] = {ni, nj, nk};
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type o = 0; o < n[outer]; ++o ) {
+          Index_type ijk[3];
+          ijk[outer] = o;
+          for (ijk[middle] = 0; ijk[middle] < n[middle]; ++ijk[middle] ) {
+            for (ijk[inner] = 0; ijk[inner] < n[inner]; ++ijk[inner] ) {
+              const Index_type i = ijk[0];
+              const Index_type j = ijk[1];
+              const Index_type k = ijk[2];
+              NESTED_INIT_BODY;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type o = 0; o < n[outer]; ++o ) {
+          Index_type ijk[3];
+          ijk[outer] = o;
+          for (ijk[middle] = 0; ijk[middle] < n[middle]; ++ijk[middle] ) {
+            for (ijk[inner] = 0; ijk[inner] < n[inner]; ++ijk[inner] ) {
+              nestedinit_lam(ijk[0], ijk[1], ijk[2]);
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL = NestedInitOpenMPOrderPolicy<loop_order>;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment(0, ni),
+                                                 RAJA::RangeSegment(0, nj),
+                                                 RAJA::RangeSegment(0, nk)),
+                                nestedinit_lam
+                              );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  NESTED_INIT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
 #endif
+}
+
+template < size_t tile_size >
+void NESTED_INIT::runOpenMPVariantTile2D(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  NESTED_INIT_DATA_SETUP;
+
+  auto nestedinit_lam = [=](Index_type i, Index_type j, Index_type k) {
+                          NESTED_INIT_BODY;
+                        };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type k = 0; k < nk; ++k ) {
+          for (Index_type jj = 0; jj < nj; jj += tile_size ) {
+            const Index_type jend = std::min(jj + Index_type(tile_size), nj);
+            for (Index_type ii = 0; ii < ni; ii += tile_size ) {
+              const Index_type iend = std::min(ii + Index_type(tile_size), ni);
+              for (Index_type j = jj; j < jend; ++j ) {
+                for (Index_type i = ii; i < iend; ++i ) {
+                  NESTED_INIT_BODY;
+                }
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type k = 0; k < nk; ++k ) {
+          for (Index_type jj = 0; jj < nj; jj += tile_size ) {
+            const Index_type jend = std::min(jj + Index_type(tile_size), nj);
+            for (Index_type ii = 0; ii < ni; ii += tile_size ) {
+              const Index_type iend = std::min(ii + Index_type(tile_size), ni);
+              for (Index_type j = jj; j < jend; ++j ) {
+                for (Index_type i = ii; i < iend; ++i ) {
+                  nestedinit_lam(i, j, k);
+                }
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL = NestedInitOpenMPTile2DPolicy<tile_size>;
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
@@ -132,5 +458,160 @@ void NESTED_INIT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 #endif
 }
 
+template < size_t tile_size >
+void NESTED_INIT::runOpenMPVariantTile3D(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  NESTED_INIT_DATA_SETUP;
+
+  auto nestedinit_lam = [=](Index_type i, Index_type j, Index_type k) {
+                          NESTED_INIT_BODY;
+                        };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type kk = 0; kk < nk; kk += tile_size ) {
+          const Index_type kend = std::min(kk + Index_type(tile_size), nk);
+          for (Index_type jj = 0; jj < nj; jj += tile_size ) {
+            const Index_type jend = std::min(jj + Index_type(tile_size), nj);
+            for (Index_type ii = 0; ii < ni; ii += tile_size ) {
+              const Index_type iend = std::min(ii + Index_type(tile_size), ni);
+              for (Index_type k = kk; k < kend; ++k ) {
+                for (Index_type j = jj; j < jend; ++j ) {
+                  for (Index_type i = ii; i < iend; ++i ) {
+                    NESTED_INIT_BODY;
+                  }
+                }
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type kk = 0; kk < nk; kk += tile_size ) {
+          const Index_type kend = std::min(kk + Index_type(tile_size), nk);
+          for (Index_type jj = 0; jj < nj; jj += tile_size ) {
+            const Index_type jend = std::min(jj + Index_type(tile_size), nj);
+            for (Index_type ii = 0; ii < ni; ii += tile_size ) {
+              const Index_type iend = std::min(ii + Index_type(tile_size), ni);
+              for (Index_type k = kk; k < kend; ++k ) {
+                for (Index_type j = jj; j < jend; ++j ) {
+                  for (Index_type i = ii; i < iend; ++i ) {
+                    nestedinit_lam(i, j, k);
+                  }
+                }
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      using EXEC_POL = NestedInitOpenMPTile3DPolicy<tile_size>;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment(0, ni),
+                                                 RAJA::RangeSegment(0, nj),
+                                                 RAJA::RangeSegment(0, nk)),
+                                nestedinit_lam
+                              );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  NESTED_INIT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void NESTED_INIT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(omp_collapse_depths_type{}, [&](auto collapse_depth) {
+    if (tune_idx == t) {
+      runOpenMPVariantImpl<collapse_depth>(vid);
+    }
+    t += 1;
+  });
+
+  seq_for(loop_orders_type{}, [&](auto loop_order) {
+    if (tune_idx == t) {
+      runOpenMPVariantOrder<loop_order>(vid);
+    }
+    t += 1;
+  });
+
+  seq_for(tile_sizes_type{}, [&](auto tile_size) {
+    if (tune_idx == t) {
+      runOpenMPVariantTile2D<tile_size>(vid);
+    }
+    t += 1;
+  });
+
+  seq_for(tile_sizes_type{}, [&](auto tile_size) {
+    if (tune_idx == t) {
+      runOpenMPVariantTile3D<tile_size>(vid);
+    }
+    t += 1;
+  });
+}
+
+void NESTED_INIT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  seq_for(omp_collapse_depths_type{}, [&](auto collapse_depth) {
+    addVariantTuningName(vid, "collapse_"+std::to_string(collapse_depth));
+  });
+
+  seq_for(loop_orders_type{}, [&](auto loop_order) {
+    addVariantTuningName(vid, getLoopOrderName(loop_order));
+  });
+
+  seq_for(tile_sizes_type{}, [&](auto tile_size) {
+    addVariantTuningName(vid, "tile2d_"+std::to_string(tile_size));
+  });
+
+  seq_for(tile_sizes_type{}, [&](auto tile_size) {
+    addVariantTuningName(vid, "tile3d_"+std::to_string(tile_size));
+  });
+}
+
 } // end namespace basic
 } // end namespace rajaperf
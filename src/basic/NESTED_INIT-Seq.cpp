@@ -10,6 +10,7 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +19,7 @@ namespace basic
 {
 
 
-void NESTED_INIT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void NESTED_INIT::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
 
@@ -106,5 +107,391 @@ void NESTED_INIT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 
 }
 
+
+#if defined(RUN_RAJA_SEQ)
+//
+// RAJA kernel policies for the loop order and tiling tunings.
+//
+template < size_t loop_order >
+using NestedInitSeqOrderPolicy =
+  RAJA::KernelPolicy<
+    RAJA::statement::For<loop_order / 100, RAJA::loop_exec,             // outer
+      RAJA::statement::For<(loop_order / 10) % 10, RAJA::loop_exec,     // middle
+        RAJA::statement::For<loop_order % 10, RAJA::loop_exec,          // inner
+          RAJA::statement::Lambda<0>
+        >
+      >
+    >
+  >;
+
+template < size_t tile_size >
+using NestedInitSeqTile2DPolicy =
+  RAJA::KernelPolicy<
+    RAJA::statement::For<2, RAJA::loop_exec,                             // k
+      RAJA::statement::Tile<1, RAJA::tile_fixed<tile_size>, RAJA::loop_exec,
+        RAJA::statement::Tile<0, RAJA::tile_fixed<tile_size>, RAJA::loop_exec,
+          RAJA::statement::For<1, RAJA::loop_exec,                       // j
+            RAJA::statement::For<0, RAJA::loop_exec,                     // i
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >
+      >
+    >
+  >;
+
+template < size_t tile_size >
+using NestedInitSeqTile3DPolicy =
+  RAJA::KernelPolicy<
+    RAJA::statement::Tile<2, RAJA::tile_fixed<tile_size>, RAJA::loop_exec,
+      RAJA::statement::Tile<1, RAJA::tile_fixed<tile_size>, RAJA::loop_exec,
+        RAJA::statement::Tile<0, RAJA::tile_fixed<tile_size>, RAJA::loop_exec,
+          RAJA::statement::For<2, RAJA::loop_exec,                       // k
+            RAJA::statement::For<1, RAJA::loop_exec,                     // j
+              RAJA::statement::For<0, RAJA::loop_exec,                   // i
+                RAJA::statement::Lambda<0>
+              >
+            >
+          >
+        >
+      >
+    >
+  >;
+#endif // RUN_RAJA_SEQ
+
+
+template < size_t loop_order >
+void NESTED_INIT::runSeqVariantOrder(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  NESTED_INIT_DATA_SETUP;
+
+  auto nestedinit_lam = [=](Index_type i, Index_type j, Index_type k) {
+                          NESTED_INIT_BODY;
+                        };
+
+  //
+  // Loop extents and indices are held in arrays indexed by loop argument,
+  // the compile time loop order picks which one each loop runs over.
+  //
+  constexpr size_t outer = loop_order / 100;
+  constexpr size_t middle = (loop_order / 10) % 10;
+  constexpr size_t inner = loop_order % 10;
+  const Index_type n[3] = {ni, nj, nk};
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type ijk[3];
+        for (ijk[outer] = 0; ijk[outer] < n[outer]; ++ijk[outer] ) {
+          for (ijk[middle] = 0; ijk[middle] < n[middle]; ++ijk[middle] ) {
+            for (ijk[inner] = 0; ijk[inner] < n[inner]; ++ijk[inner] ) {
+              const Index_type i = ijk[0];
+              const Index_type j = ijk[1];
+              const Index_type k = ijk[2];
+              NESTED_INIT_BODY;
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Index_type ijk[3];
+        for (ijk[outer] = 0; ijk[outer] < n[outer]; ++ijk[outer] ) {
+          for (ijk[middle] = 0; ijk[middle] < n[middle]; ++ijk[middle] ) {
+            for (ijk[inner] = 0; ijk[inner] < n[inner]; ++ijk[inner] ) {
+              nestedinit_lam(ijk[0], ijk[1], ijk[2]);
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      using EXEC_POL = NestedInitSeqOrderPolicy<loop_order>;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment(0, ni),
+                                                 RAJA::RangeSegment(0, nj),
+                                                 RAJA::RangeSegment(0, nk)),
+                                nestedinit_lam
+                              );
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  NESTED_INIT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+template < size_t tile_size >
+void NESTED_INIT::runSeqVariantTile2D(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  NESTED_INIT_DATA_SETUP;
+
+  auto nestedinit_lam = [=](Index_type i, Index_type j, Index_type k) {
+                          NESTED_INIT_BODY;
+                        };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = 0; k < nk; ++k ) {
+          for (Index_type jj = 0; jj < nj; jj += tile_size ) {
+            const Index_type jend = std::min(jj + Index_type(tile_size), nj);
+            for (Index_type ii = 0; ii < ni; ii += tile_size ) {
+              const Index_type iend = std::min(ii + Index_type(tile_size), ni);
+              for (Index_type j = jj; j < jend; ++j ) {
+                for (Index_type i = ii; i < iend; ++i ) {
+                  NESTED_INIT_BODY;
+                }
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = 0; k < nk; ++k ) {
+          for (Index_type jj = 0; jj < nj; jj += tile_size ) {
+            const Index_type jend = std::min(jj + Index_type(tile_size), nj);
+            for (Index_type ii = 0; ii < ni; ii += tile_size ) {
+              const Index_type iend = std::min(ii + Index_type(tile_size), ni);
+              for (Index_type j = jj; j < jend; ++j ) {
+                for (Index_type i = ii; i < iend; ++i ) {
+                  nestedinit_lam(i, j, k);
+                }
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      using EXEC_POL = NestedInitSeqTile2DPolicy<tile_size>;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment(0, ni),
+                                                 RAJA::RangeSegment(0, nj),
+                                                 RAJA::RangeSegment(0, nk)),
+                                nestedinit_lam
+                              );
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  NESTED_INIT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+template < size_t tile_size >
+void NESTED_INIT::runSeqVariantTile3D(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  NESTED_INIT_DATA_SETUP;
+
+  auto nestedinit_lam = [=](Index_type i, Index_type j, Index_type k) {
+                          NESTED_INIT_BODY;
+                        };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type kk = 0; kk < nk; kk += tile_size ) {
+          const Index_type kend = std::min(kk + Index_type(tile_size), nk);
+          for (Index_type jj = 0; jj < nj; jj += tile_size ) {
+            const Index_type jend = std::min(jj + Index_type(tile_size), nj);
+            for (Index_type ii = 0; ii < ni; ii += tile_size ) {
+              const Index_type iend = std::min(ii + Index_type(tile_size), ni);
+              for (Index_type k = kk; k < kend; ++k ) {
+                for (Index_type j = jj; j < jend; ++j ) {
+                  for (Index_type i = ii; i < iend; ++i ) {
+                    NESTED_INIT_BODY;
+                  }
+                }
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type kk = 0; kk < nk; kk += tile_size ) {
+          const Index_type kend = std::min(kk + Index_type(tile_size), nk);
+          for (Index_type jj = 0; jj < nj; jj += tile_size ) {
+            const Index_type jend = std::min(jj + Index_type(tile_size), nj);
+            for (Index_type ii = 0; ii < ni; ii += tile_size ) {
+              const Index_type iend = std::min(ii + Index_type(tile_size), ni);
+              for (Index_type k = kk; k < kend; ++k ) {
+                for (Index_type j = jj; j < jend; ++j ) {
+                  for (Index_type i = ii; i < iend; ++i ) {
+                    nestedinit_lam(i, j, k);
+                  }
+                }
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      using EXEC_POL = NestedInitSeqTile3DPolicy<tile_size>;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXEC_POL>( RAJA::make_tuple(RAJA::RangeSegment(0, ni),
+                                                 RAJA::RangeSegment(0, nj),
+                                                 RAJA::RangeSegment(0, nk)),
+                                nestedinit_lam
+                              );
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  NESTED_INIT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void NESTED_INIT::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runSeqVariantDefault(vid);
+  }
+
+  t += 1;
+
+  seq_for(loop_orders_type{}, [&](auto loop_order) {
+    if (tune_idx == t) {
+      runSeqVariantOrder<loop_order>(vid);
+    }
+    t += 1;
+  });
+
+  seq_for(tile_sizes_type{}, [&](auto tile_size) {
+    if (tune_idx == t) {
+      runSeqVariantTile2D<tile_size>(vid);
+    }
+    t += 1;
+  });
+
+  seq_for(tile_sizes_type{}, [&](auto tile_size) {
+    if (tune_idx == t) {
+      runSeqVariantTile3D<tile_size>(vid);
+    }
+    t += 1;
+  });
+}
+
+void NESTED_INIT::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  seq_for(loop_orders_type{}, [&](auto loop_order) {
+    addVariantTuningName(vid, getLoopOrderName(loop_order));
+  });
+
+  seq_for(tile_sizes_type{}, [&](auto tile_size) {
+    addVariantTuningName(vid, "tile2d_"+std::to_string(tile_size));
+  });
+
+  seq_for(tile_sizes_type{}, [&](auto tile_size) {
+    addVariantTuningName(vid, "tile3d_"+std::to_string(tile_size));
+  });
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -17,6 +17,15 @@
 ///   }
 /// }
 ///
+/// Seq and OpenMP variants have tunings that run the loops in every other
+/// order ('order_<outer><middle><inner>', e.g., order_ijk walks the array
+/// with the largest stride innermost) and with the j, i loops or all three
+/// loops tiled ('tile2d_<size>', 'tile3d_<size>'). The RAJA variants express
+/// these with the nesting of RAJA::statement::For and RAJA::statement::Tile,
+/// so the report shows the cost of a kernel policy written in the wrong
+/// order for the memory layout. OpenMP variants parallelize the outermost
+/// loop (or tile loop) of each tuning.
+///
 
 #ifndef RAJAPerf_Basic_NESTED_INIT_HPP
 #define RAJAPerf_Basic_NESTED_INIT_HPP
@@ -34,6 +43,8 @@
 
 #include "common/KernelBase.hpp"
 
+#include <string>
+
 namespace rajaperf
 {
 class RunParams;
@@ -59,7 +70,27 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
-
+  void runThreadPoolVariant(VariantID vid, size_t tune_idx);
+  void runSIMDVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  template < size_t loop_order >
+  void runSeqVariantOrder(VariantID vid);
+  template < size_t tile_size >
+  void runSeqVariantTile2D(VariantID vid);
+  template < size_t tile_size >
+  void runSeqVariantTile3D(VariantID vid);
+
+  void setOpenMPTuningDefinitions(VariantID vid);
+  template < size_t collapse_depth >
+  void runOpenMPVariantImpl(VariantID vid);
+  template < size_t loop_order >
+  void runOpenMPVariantOrder(VariantID vid);
+  template < size_t tile_size >
+  void runOpenMPVariantTile2D(VariantID vid);
+  template < size_t tile_size >
+  void runOpenMPVariantTile3D(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
@@ -71,6 +102,23 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
                                                          gpu_block_size::MultipleOf<32>>;
+  using omp_collapse_depths_type = camp::int_seq<size_t, 1, 2, 3>;
+
+  //
+  // Loop orders other than the reference k, j, i order. Each is written as
+  // the loop argument (i = 0, j = 1, k = 2) of the outer, middle and inner
+  // loops, one decimal digit each; e.g., 102 is j, i, k.
+  //
+  using loop_orders_type = camp::int_seq<size_t, 201, 120, 102, 21, 12>;
+  using tile_sizes_type = camp::int_seq<size_t, 8, 32>;
+
+  static std::string getLoopOrderName(size_t loop_order)
+  {
+    const char loop_names[] = {'i', 'j', 'k'};
+    return std::string("order_") + loop_names[loop_order / 100] +
+                                   loop_names[(loop_order / 10) % 10] +
+                                   loop_names[loop_order % 10];
+  }
 
   Index_type m_array_length;
 
@@ -41,6 +41,34 @@ __global__ void atomic_pi(Real_ptr pi,
 }
 
 
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void atomic_pi_privatized(Real_ptr pi,
+                                     Real_type dx,
+                                     Index_type iend)
+{
+   __shared__ Real_type ppi[block_size];
+
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   ppi[ threadIdx.x ] = 0.0;
+   if (i < iend) {
+     double x = (double(i) + 0.5) * dx;
+     ppi[ threadIdx.x ] = dx / (1.0 + x * x);
+   }
+   __syncthreads();
+
+   for ( i = block_size / 2; i > 0; i /= 2 ) {
+     if ( threadIdx.x < i ) {
+       ppi[ threadIdx.x ] += ppi[ threadIdx.x + i ];
+     }
+     __syncthreads();
+   }
+
+   if ( threadIdx.x == 0 ) {
+     RAJA::atomicAdd<RAJA::hip_atomic>( pi, ppi[ 0 ] );
+   }
+}
+
 
 template < size_t block_size >
 void PI_ATOMIC::runHipVariantImpl(VariantID vid)
@@ -127,7 +155,131 @@ void PI_ATOMIC::runHipVariantImpl(VariantID vid)
   }
 }
 
-RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BIOLERPLATE(PI_ATOMIC, Hip)
+template < size_t block_size >
+void PI_ATOMIC::runHipVariantPrivatized(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PI_ATOMIC_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    PI_ATOMIC_DATA_SETUP_HIP;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      initHipDeviceData(pi, &m_pi_init, 1);
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      hipLaunchKernelGGL((atomic_pi_privatized<block_size>), grid_size, block_size, 0, 0, pi, dx, iend );
+      hipErrchk( hipGetLastError() );
+
+      getHipDeviceData(m_pi, pi, 1);
+      *m_pi *= 4.0;
+
+    }
+    stopTimer();
+
+    PI_ATOMIC_DATA_TEARDOWN_HIP;
+
+  } else if ( vid == RAJA_HIP ) {
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::ReduceSum<RAJA::hip_reduce, Real_type> pisum(m_pi_init);
+
+      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >(
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+          double x = (double(i) + 0.5) * dx;
+          pisum += dx / (1.0 + x * x);
+      });
+
+      *pi = 4.0 * static_cast<Real_type>(pisum.get());
+
+    }
+    stopTimer();
+
+  } else {
+     getCout() << "\n  PI_ATOMIC : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+void PI_ATOMIC::runHipVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      if (tune_idx == t) {
+
+        runHipVariantImpl<block_size>(vid);
+
+      }
+
+      t += 1;
+
+    }
+
+  });
+
+  if ( vid == Base_HIP || vid == RAJA_HIP ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        if (tune_idx == t) {
+
+          runHipVariantPrivatized<block_size>(vid);
+
+        }
+
+        t += 1;
+
+      }
+
+    });
+
+  }
+}
+
+void PI_ATOMIC::setHipTuningDefinitions(VariantID vid)
+{
+  seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+    if (run_params.numValidGPUBlockSize() == 0u ||
+        run_params.validGPUBlockSize(block_size)) {
+
+      addVariantTuningName(vid, "block_"+std::to_string(block_size));
+
+    }
+
+  });
+
+  if ( vid == Base_HIP || vid == RAJA_HIP ) {
+
+    seq_for(gpu_block_sizes_type{}, [&](auto block_size) {
+
+      if (run_params.numValidGPUBlockSize() == 0u ||
+          run_params.validGPUBlockSize(block_size)) {
+
+        const std::string name = ( vid == RAJA_HIP ) ? "reduce" : "privatized";
+        addVariantTuningName(vid, name+"_block_"+std::to_string(block_size));
+
+      }
+
+    });
+
+  }
+}
 
 } // end namespace basic
 } // end namespace rajaperf
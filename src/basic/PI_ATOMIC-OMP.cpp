@@ -10,7 +10,10 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/OpenMPUtils.hpp"
+
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
@@ -18,7 +21,8 @@ namespace basic
 {
 
 
-void PI_ATOMIC::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < bool runtime_schedule >
+void PI_ATOMIC::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -36,11 +40,20 @@ void PI_ATOMIC::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         *pi = m_pi_init;
-        #pragma omp parallel for
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          double x = (double(i) + 0.5) * dx;
-          #pragma omp atomic
-          *pi += dx / (1.0 + x * x);
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            double x = (double(i) + 0.5) * dx;
+            #pragma omp atomic
+            *pi += dx / (1.0 + x * x);
+          }
+        } else {
+          #pragma omp parallel for
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            double x = (double(i) + 0.5) * dx;
+            #pragma omp atomic
+            *pi += dx / (1.0 + x * x);
+          }
         }
         *pi *= 4.0;
 
@@ -62,9 +75,16 @@ void PI_ATOMIC::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         *pi = m_pi_init;
-        #pragma omp parallel for
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          piatomic_base_lam(i);
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            piatomic_base_lam(i);
+          }
+        } else {
+          #pragma omp parallel for
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            piatomic_base_lam(i);
+          }
         }
         *pi *= 4.0;
 
@@ -80,7 +100,7 @@ void PI_ATOMIC::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         *pi = m_pi_init;
-        RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::forall<omp_schedule::parallel_for_exec<runtime_schedule>>(
           RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
             double x = (double(i) + 0.5) * dx;
             RAJA::atomicAdd<RAJA::omp_atomic>(pi, dx / (1.0 + x * x));
@@ -104,5 +124,140 @@ void PI_ATOMIC::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 #endif
 }
 
+void PI_ATOMIC::runOpenMPVariantPrivatized(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PI_ATOMIC_DATA_SETUP;
+
+  const int num_threads = omp_get_max_threads();
+  std::vector<Real_type> partials(num_threads * partial_stride);
+  Real_ptr partial = partials.data();
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        *pi = m_pi_init;
+        for (int t = 0; t < num_threads; ++t) {
+          partial[t * partial_stride] = 0.0;
+        }
+        #pragma omp parallel
+        {
+          Real_ptr my_pi = &partial[omp_get_thread_num() * partial_stride];
+          #pragma omp for
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            double x = (double(i) + 0.5) * dx;
+            *my_pi += dx / (1.0 + x * x);
+          }
+        }
+        for (int t = 0; t < num_threads; ++t) {
+          *pi += partial[t * partial_stride];
+        }
+        *pi *= 4.0;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto piatomic_privatized_lam = [=](Index_type i, Real_ptr my_pi) {
+                                       double x = (double(i) + 0.5) * dx;
+                                       *my_pi += dx / (1.0 + x * x);
+                                     };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        *pi = m_pi_init;
+        for (int t = 0; t < num_threads; ++t) {
+          partial[t * partial_stride] = 0.0;
+        }
+        #pragma omp parallel
+        {
+          Real_ptr my_pi = &partial[omp_get_thread_num() * partial_stride];
+          #pragma omp for
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            piatomic_privatized_lam(i, my_pi);
+          }
+        }
+        for (int t = 0; t < num_threads; ++t) {
+          *pi += partial[t * partial_stride];
+        }
+        *pi *= 4.0;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      // the 'reduce' tuning, a RAJA reduction in place of the atomic
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceSum<RAJA::omp_reduce, Real_type> pisum(m_pi_init);
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+            double x = (double(i) + 0.5) * dx;
+            pisum += dx / (1.0 + x * x);
+        });
+        *pi = 4.0 * static_cast<Real_type>(pisum.get());
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PI_ATOMIC : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void PI_ATOMIC::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  const size_t num_schedule_tunings =
+      omp_schedule::getTuningNames(run_params).size();
+
+  if ( tune_idx == 0 ) {
+    runOpenMPVariantImpl<false>(vid);
+  } else if ( tune_idx < num_schedule_tunings ) {
+    omp_schedule::RuntimeScheduleScope schedule(run_params, tune_idx);
+    runOpenMPVariantImpl<true>(vid);
+  } else {
+    runOpenMPVariantPrivatized(vid);
+  }
+}
+
+void PI_ATOMIC::setOpenMPTuningDefinitions(VariantID vid)
+{
+  for (std::string const& name : omp_schedule::getTuningNames(run_params)) {
+    addVariantTuningName(vid, name);
+  }
+  // RAJA_OpenMP has no privatized form of the atomic loop, its tuning uses a
+  // RAJA reduction instead
+  addVariantTuningName(vid, ( vid == RAJA_OpenMP ) ? "reduce" : "privatized");
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -55,6 +55,9 @@ PI_ATOMIC::PI_ATOMIC(const RunParams& params)
   setVariantDefined( RAJA_HIP );
 
   setVariantDefined( Kokkos_Lambda );
+
+  setVariantDefined( Base_ThreadPool );
+  setVariantDefined( Lambda_ThreadPool );
 }
 
 PI_ATOMIC::~PI_ATOMIC()
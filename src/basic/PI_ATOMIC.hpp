@@ -19,6 +19,13 @@
 /// }
 /// pi *= 4.0;
 ///
+/// Besides the atomic update per iteration above, the Base and Lambda
+/// OpenMP and Base GPU variants have 'privatized' tunings: OpenMP threads
+/// accumulate into per-thread partial sums, padded to a cache line each,
+/// that are summed after the loop, and GPU thread blocks sum in shared
+/// memory and do one atomic update per block. The RAJA OpenMP and GPU
+/// variants have 'reduce' tunings that use RAJA::ReduceSum instead.
+///
 
 #ifndef RAJAPerf_Basic_PI_ATOMIC_HPP
 #define RAJAPerf_Basic_PI_ATOMIC_HPP
@@ -55,18 +62,30 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
+  void runThreadPoolVariant(VariantID vid, size_t tune_idx);
 
+  void setOpenMPTuningDefinitions(VariantID vid);
+  template < bool runtime_schedule >
+  void runOpenMPVariantImpl(VariantID vid);
+  void runOpenMPVariantPrivatized(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
   void runCudaVariantImpl(VariantID vid);
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
+  template < size_t block_size >
+  void runCudaVariantPrivatized(VariantID vid);
+  template < size_t block_size >
+  void runHipVariantPrivatized(VariantID vid);
 
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  // stride between per-thread partial sums, one cache line
+  static const Index_type partial_stride = 64 / sizeof(Real_type);
+
   Real_type m_dx;
   Real_ptr m_pi;
   Real_type m_pi_init;
@@ -10,7 +10,10 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/OpenMPUtils.hpp"
+
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
@@ -18,7 +21,8 @@ namespace basic
 {
 
 
-void PI_REDUCE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type, typename Compute_type, bool runtime_schedule >
+void PI_REDUCE::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -26,7 +30,7 @@ void PI_REDUCE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  PI_REDUCE_DATA_SETUP;
+  PI_REDUCE_PRECISION_DATA_SETUP(Data_type, Compute_type);
 
   switch ( vid ) {
 
@@ -35,11 +39,18 @@ void PI_REDUCE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type pi = m_pi_init;
-
-        #pragma omp parallel for reduction(+:pi)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          PI_REDUCE_BODY;
+        Compute_type pi = m_pi_init;
+
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime) reduction(+:pi)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            PI_REDUCE_PRECISION_BODY(Compute_type);
+          }
+        } else {
+          #pragma omp parallel for reduction(+:pi)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            PI_REDUCE_PRECISION_BODY(Compute_type);
+          }
         }
 
         m_pi = 4.0 * pi;
@@ -52,19 +63,26 @@ void PI_REDUCE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
     case Lambda_OpenMP : {
 
-      auto pireduce_base_lam = [=](Index_type i) -> Real_type {
-                                 double x = (double(i) + 0.5) * dx;
-                                 return dx / (1.0 + x * x);
+      auto pireduce_base_lam = [=](Index_type i) -> Compute_type {
+                                 Compute_type x = (Compute_type(i) + Compute_type(0.5)) * Compute_type(dx);
+                                 return Compute_type(dx) / (Compute_type(1.0) + x * x);
                                };
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type pi = m_pi_init;
-
-        #pragma omp parallel for reduction(+:pi)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          pi += pireduce_base_lam(i);
+        Compute_type pi = m_pi_init;
+
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime) reduction(+:pi)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            pi += pireduce_base_lam(i);
+          }
+        } else {
+          #pragma omp parallel for reduction(+:pi)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            pi += pireduce_base_lam(i);
+          }
         }
 
         m_pi = 4.0 * pi;
@@ -80,15 +98,98 @@ void PI_REDUCE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::ReduceSum<RAJA::omp_reduce, Real_type> pi(m_pi_init);
+        RAJA::ReduceSum<RAJA::omp_reduce, Compute_type> pi(m_pi_init);
 
-        RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::forall<omp_schedule::parallel_for_exec<runtime_schedule>>(
           RAJA::RangeSegment(ibegin, iend),
           [=](Index_type i) {
-            PI_REDUCE_BODY;
+            PI_REDUCE_PRECISION_BODY(Compute_type);
         });
 
-        m_pi = 4.0 * pi.get();
+        m_pi = 4.0 * static_cast<Real_type>(pi.get());
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PI_REDUCE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void PI_REDUCE::runOpenMPVariantReproducible(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PI_REDUCE_DATA_SETUP;
+
+  const Index_type nblocks = reproducible::getNumBlocks(iend - ibegin);
+  std::vector<Real_type> pi_partials_vec(nblocks);
+  Real_ptr pi_partials = pi_partials_vec.data();
+
+  auto pireduce_block_lam = [=](Index_type b) {
+                              PI_REDUCE_BLOCK_BODY;
+                            };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type b = 0; b < nblocks; ++b ) {
+          PI_REDUCE_BLOCK_BODY;
+        }
+
+        m_pi = 4.0 * (m_pi_init + reproducible::treeSum(pi_partials, nblocks));
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type b = 0; b < nblocks; ++b ) {
+          pireduce_block_lam(b);
+        }
+
+        m_pi = 4.0 * (m_pi_init + reproducible::treeSum(pi_partials, nblocks));
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nblocks), pireduce_block_lam);
+
+        m_pi = 4.0 * (m_pi_init + reproducible::treeSum(pi_partials, nblocks));
 
       }
       stopTimer();
@@ -107,5 +208,37 @@ void PI_REDUCE::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 #endif
 }
 
+void PI_REDUCE::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  const size_t num_schedule_tunings =
+      omp_schedule::getTuningNames(run_params).size();
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+
+  if ( tune_idx == 0 ) {
+    runOpenMPVariantImpl<Real_type, Real_type, false>(vid);
+  } else if ( tune_idx < num_schedule_tunings ) {
+    omp_schedule::RuntimeScheduleScope schedule(run_params, tune_idx);
+    runOpenMPVariantImpl<Real_type, Real_type, true>(vid);
+  } else if ( tuning_name == "fp32" ) {
+    runOpenMPVariantImpl<precision::Float_type, precision::Float_type,
+                         false>(vid);
+  } else if ( tuning_name == "mixed" ) {
+    runOpenMPVariantImpl<precision::Float_type, Real_type, false>(vid);
+  } else {
+    runOpenMPVariantReproducible(vid);
+  }
+}
+
+void PI_REDUCE::setOpenMPTuningDefinitions(VariantID vid)
+{
+  for (std::string const& name : omp_schedule::getTuningNames(run_params)) {
+    addVariantTuningName(vid, name);
+  }
+  addVariantTuningName(vid, "reproducible");
+  for (std::string const& name : precision::getTuningNames(run_params)) {
+    addVariantTuningName(vid, name);
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
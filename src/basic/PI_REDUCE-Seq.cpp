@@ -11,6 +11,7 @@
 #include "RAJA/RAJA.hpp"
 
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
@@ -18,13 +19,14 @@ namespace basic
 {
 
 
-void PI_REDUCE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type, typename Compute_type >
+void PI_REDUCE::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  PI_REDUCE_DATA_SETUP;
+  PI_REDUCE_PRECISION_DATA_SETUP(Data_type, Compute_type);
 
   switch ( vid ) {
 
@@ -33,10 +35,10 @@ void PI_REDUCE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type pi = m_pi_init;
+        Compute_type pi = m_pi_init;
 
         for (Index_type i = ibegin; i < iend; ++i ) {
-          PI_REDUCE_BODY;
+          PI_REDUCE_PRECISION_BODY(Compute_type);
         }
 
         m_pi = 4.0 * pi;
@@ -50,15 +52,15 @@ void PI_REDUCE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 #if defined(RUN_RAJA_SEQ)
     case Lambda_Seq : {
 
-      auto pireduce_base_lam = [=](Index_type i) -> Real_type {
-                                 double x = (double(i) + 0.5) * dx;
-                                 return dx / (1.0 + x * x);
+      auto pireduce_base_lam = [=](Index_type i) -> Compute_type {
+                                 Compute_type x = (Compute_type(i) + Compute_type(0.5)) * Compute_type(dx);
+                                 return Compute_type(dx) / (Compute_type(1.0) + x * x);
                                };
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type pi = m_pi_init;
+        Compute_type pi = m_pi_init;
 
         for (Index_type i = ibegin; i < iend; ++i ) {
           pi += pireduce_base_lam(i);
@@ -77,14 +79,14 @@ void PI_REDUCE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::ReduceSum<RAJA::seq_reduce, Real_type> pi(m_pi_init);
+        RAJA::ReduceSum<RAJA::seq_reduce, Compute_type> pi(m_pi_init);
 
         RAJA::forall<RAJA::loop_exec>( RAJA::RangeSegment(ibegin, iend),
           [=](Index_type i) {
-            PI_REDUCE_BODY;
+            PI_REDUCE_PRECISION_BODY(Compute_type);
         });
 
-        m_pi = 4.0 * pi.get();
+        m_pi = 4.0 * static_cast<Real_type>(pi.get());
 
       }
       stopTimer();
@@ -101,5 +103,106 @@ void PI_REDUCE::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 
 }
 
+void PI_REDUCE::runSeqVariantReproducible(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PI_REDUCE_DATA_SETUP;
+
+  const Index_type nblocks = reproducible::getNumBlocks(iend - ibegin);
+  std::vector<Real_type> pi_partials_vec(nblocks);
+  Real_ptr pi_partials = pi_partials_vec.data();
+
+  auto pireduce_block_lam = [=](Index_type b) {
+                              PI_REDUCE_BLOCK_BODY;
+                            };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type b = 0; b < nblocks; ++b ) {
+          PI_REDUCE_BLOCK_BODY;
+        }
+
+        m_pi = 4.0 * (m_pi_init + reproducible::treeSum(pi_partials, nblocks));
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type b = 0; b < nblocks; ++b ) {
+          pireduce_block_lam(b);
+        }
+
+        m_pi = 4.0 * (m_pi_init + reproducible::treeSum(pi_partials, nblocks));
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nblocks), pireduce_block_lam);
+
+        m_pi = 4.0 * (m_pi_init + reproducible::treeSum(pi_partials, nblocks));
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      getCout() << "\n  PI_REDUCE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void PI_REDUCE::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+  if ( tuning_name == "reproducible" ) {
+    runSeqVariantReproducible(vid);
+  } else if ( tuning_name == "fp32" ) {
+    runSeqVariantDefault<precision::Float_type, precision::Float_type>(vid);
+  } else if ( tuning_name == "mixed" ) {
+    runSeqVariantDefault<precision::Float_type, Real_type>(vid);
+  } else {
+    runSeqVariantDefault<Real_type, Real_type>(vid);
+  }
+}
+
+void PI_REDUCE::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+  addVariantTuningName(vid, "reproducible");
+  for (std::string const& name : precision::getTuningNames(run_params)) {
+    addVariantTuningName(vid, name);
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
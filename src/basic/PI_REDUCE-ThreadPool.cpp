@@ -0,0 +1,96 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PI_REDUCE.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/ThreadPool.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+void PI_REDUCE::runThreadPoolVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+#if defined(RUN_THREADPOOL)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  PI_REDUCE_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_ThreadPool : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type pi = m_pi_init;
+
+        pi += threadpool::parallel_reduce(ibegin, iend, Real_type(0),
+          [=](Index_type cbegin, Index_type cend, Real_type& pi) {
+          for (Index_type i = cbegin; i < cend; ++i ) {
+            PI_REDUCE_BODY;
+          }
+        }, std::plus<Real_type>());
+
+        m_pi = 4.0 * pi;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_ThreadPool : {
+
+      auto pireduce_base_lam = [=](Index_type i) -> Real_type {
+                                 double x = (double(i) + 0.5) * dx;
+                                 return dx / (1.0 + x * x);
+                               };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Real_type pi = m_pi_init;
+
+        pi += threadpool::parallel_reduce(ibegin, iend, Real_type(0),
+          [=](Index_type cbegin, Index_type cend, Real_type& pi) {
+          for (Index_type i = cbegin; i < cend; ++i ) {
+            pi += pireduce_base_lam(i);
+          }
+        }, std::plus<Real_type>());
+
+        m_pi = 4.0 * pi;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  PI_REDUCE : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -19,6 +19,15 @@
 /// }
 /// pi *= 4.0;
 ///
+/// The Seq and OpenMP 'reproducible' tunings sum fixed size blocks of
+/// iterations in order and combine the block sums by a fixed tree (see
+/// common/ReduceUtils.hpp), so pi is bitwise the same for any number of
+/// threads and schedule.
+///
+/// The Seq and OpenMP fp32 and mixed tunings (see common/PrecisionUtils.hpp)
+/// compute the terms in Float_type and accumulate them in Float_type or
+/// Real_type; the kernel has no arrays, so they save no memory traffic.
+///
 
 #ifndef RAJAPerf_Basic_PI_REDUCE_HPP
 #define RAJAPerf_Basic_PI_REDUCE_HPP
@@ -30,7 +39,26 @@
   double x = (double(i) + 0.5) * dx; \
   pi += dx / (1.0 + x * x);
 
+// the terms in the types of a precision tuning (see common/PrecisionUtils.hpp)
+#define PI_REDUCE_PRECISION_DATA_SETUP(Data_type, Compute_type) \
+  Data_type dx = m_dx;
+
+#define PI_REDUCE_PRECISION_BODY(Compute_type) \
+  Compute_type x = (Compute_type(i) + Compute_type(0.5)) * Compute_type(dx); \
+  pi += Compute_type(dx) / (Compute_type(1.0) + x * x);
+
+#define PI_REDUCE_BLOCK_BODY \
+  const Index_type bbegin = ibegin + b * reproducible::block_size; \
+  const Index_type bend = RAJA_MIN(bbegin + reproducible::block_size, iend); \
+  Real_type pi = 0.0; \
+  for (Index_type i = bbegin; i < bend; ++i ) { \
+    PI_REDUCE_BODY; \
+  } \
+  pi_partials[b] = pi;
+
 #include "common/KernelBase.hpp"
+#include "common/PrecisionUtils.hpp"
+#include "common/ReduceUtils.hpp"
 
 namespace rajaperf
 {
@@ -56,7 +84,17 @@ public:
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
-
+  void runThreadPoolVariant(VariantID vid, size_t tune_idx);
+  void runSIMDVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  template < typename Data_type, typename Compute_type >
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantReproducible(VariantID vid);
+  template < typename Data_type, typename Compute_type, bool runtime_schedule >
+  void runOpenMPVariantImpl(VariantID vid);
+  void runOpenMPVariantReproducible(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
@@ -10,8 +10,11 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/OpenMPUtils.hpp"
+
 #include <limits>
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
@@ -19,7 +22,8 @@ namespace basic
 {
 
 
-void REDUCE3_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < bool runtime_schedule >
+void REDUCE3_INT::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -40,11 +44,20 @@ void REDUCE3_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
         Int_type vmin = m_vmin_init;
         Int_type vmax = m_vmax_init;
 
-        #pragma omp parallel for reduction(+:vsum), \
-                                 reduction(min:vmin), \
-                                 reduction(max:vmax)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          REDUCE3_INT_BODY;
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime) reduction(+:vsum), \
+                                                     reduction(min:vmin), \
+                                                     reduction(max:vmax)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            REDUCE3_INT_BODY;
+          }
+        } else {
+          #pragma omp parallel for reduction(+:vsum), \
+                                   reduction(min:vmin), \
+                                   reduction(max:vmax)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            REDUCE3_INT_BODY;
+          }
         }
 
         m_vsum += vsum;
@@ -70,13 +83,24 @@ void REDUCE3_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
         Int_type vmin = m_vmin_init;
         Int_type vmax = m_vmax_init;
 
-        #pragma omp parallel for reduction(+:vsum), \
-                                 reduction(min:vmin), \
-                                 reduction(max:vmax)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          vsum += reduce3int_base_lam(i);
-          vmin = RAJA_MIN(vmin, reduce3int_base_lam(i));
-          vmax = RAJA_MAX(vmax, reduce3int_base_lam(i));
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime) reduction(+:vsum), \
+                                                     reduction(min:vmin), \
+                                                     reduction(max:vmax)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            vsum += reduce3int_base_lam(i);
+            vmin = RAJA_MIN(vmin, reduce3int_base_lam(i));
+            vmax = RAJA_MAX(vmax, reduce3int_base_lam(i));
+          }
+        } else {
+          #pragma omp parallel for reduction(+:vsum), \
+                                   reduction(min:vmin), \
+                                   reduction(max:vmax)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            vsum += reduce3int_base_lam(i);
+            vmin = RAJA_MIN(vmin, reduce3int_base_lam(i));
+            vmax = RAJA_MAX(vmax, reduce3int_base_lam(i));
+          }
         }
 
         m_vsum += vsum;
@@ -98,7 +122,7 @@ void REDUCE3_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
         RAJA::ReduceMin<RAJA::omp_reduce, Int_type> vmin(m_vmin_init);
         RAJA::ReduceMax<RAJA::omp_reduce, Int_type> vmax(m_vmax_init);
 
-        RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::forall<omp_schedule::parallel_for_exec<runtime_schedule>>(
           RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           REDUCE3_INT_BODY_RAJA;
         });
@@ -124,5 +148,125 @@ void REDUCE3_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 #endif
 }
 
+void REDUCE3_INT::runOpenMPVariantReproducible(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE3_INT_DATA_SETUP;
+
+  const Index_type nblocks = reproducible::getNumBlocks(iend - ibegin);
+  std::vector<Int_type> partials_vec(3 * nblocks);
+  Int_ptr vsum_partials = partials_vec.data();
+  Int_ptr vmin_partials = vsum_partials + nblocks;
+  Int_ptr vmax_partials = vmin_partials + nblocks;
+
+  auto reduce3int_block_lam = [=](Index_type b) {
+                                REDUCE3_INT_BLOCK_BODY;
+                              };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type b = 0; b < nblocks; ++b ) {
+          REDUCE3_INT_BLOCK_BODY;
+        }
+
+        m_vsum += m_vsum_init + reproducible::treeSum(vsum_partials, nblocks);
+        m_vmin = RAJA_MIN(m_vmin, RAJA_MIN(m_vmin_init,
+                          reproducible::treeMin(vmin_partials, nblocks)));
+        m_vmax = RAJA_MAX(m_vmax, RAJA_MAX(m_vmax_init,
+                          reproducible::treeMax(vmax_partials, nblocks)));
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type b = 0; b < nblocks; ++b ) {
+          reduce3int_block_lam(b);
+        }
+
+        m_vsum += m_vsum_init + reproducible::treeSum(vsum_partials, nblocks);
+        m_vmin = RAJA_MIN(m_vmin, RAJA_MIN(m_vmin_init,
+                          reproducible::treeMin(vmin_partials, nblocks)));
+        m_vmax = RAJA_MAX(m_vmax, RAJA_MAX(m_vmax_init,
+                          reproducible::treeMax(vmax_partials, nblocks)));
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nblocks), reduce3int_block_lam);
+
+        m_vsum += m_vsum_init + reproducible::treeSum(vsum_partials, nblocks);
+        m_vmin = RAJA_MIN(m_vmin, RAJA_MIN(m_vmin_init,
+                          reproducible::treeMin(vmin_partials, nblocks)));
+        m_vmax = RAJA_MAX(m_vmax, RAJA_MAX(m_vmax_init,
+                          reproducible::treeMax(vmax_partials, nblocks)));
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  REDUCE3_INT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void REDUCE3_INT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  const size_t num_schedule_tunings =
+      omp_schedule::getTuningNames(run_params).size();
+
+  if ( tune_idx == 0 ) {
+    runOpenMPVariantImpl<false>(vid);
+  } else if ( tune_idx < num_schedule_tunings ) {
+    omp_schedule::RuntimeScheduleScope schedule(run_params, tune_idx);
+    runOpenMPVariantImpl<true>(vid);
+  } else {
+    runOpenMPVariantReproducible(vid);
+  }
+}
+
+void REDUCE3_INT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  for (std::string const& name : omp_schedule::getTuningNames(run_params)) {
+    addVariantTuningName(vid, name);
+  }
+  addVariantTuningName(vid, "reproducible");
+}
+
 } // end namespace basic
 } // end namespace rajaperf
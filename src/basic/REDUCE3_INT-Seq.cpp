@@ -12,6 +12,7 @@
 
 #include <limits>
 #include <iostream>
+#include <vector>
 
 namespace rajaperf
 {
@@ -19,7 +20,7 @@ namespace basic
 {
 
 
-void REDUCE3_INT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void REDUCE3_INT::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -115,5 +116,112 @@ void REDUCE3_INT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 
 }
 
+void REDUCE3_INT::runSeqVariantReproducible(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE3_INT_DATA_SETUP;
+
+  const Index_type nblocks = reproducible::getNumBlocks(iend - ibegin);
+  std::vector<Int_type> partials_vec(3 * nblocks);
+  Int_ptr vsum_partials = partials_vec.data();
+  Int_ptr vmin_partials = vsum_partials + nblocks;
+  Int_ptr vmax_partials = vmin_partials + nblocks;
+
+  auto reduce3int_block_lam = [=](Index_type b) {
+                                REDUCE3_INT_BLOCK_BODY;
+                              };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type b = 0; b < nblocks; ++b ) {
+          REDUCE3_INT_BLOCK_BODY;
+        }
+
+        m_vsum += m_vsum_init + reproducible::treeSum(vsum_partials, nblocks);
+        m_vmin = RAJA_MIN(m_vmin, RAJA_MIN(m_vmin_init,
+                          reproducible::treeMin(vmin_partials, nblocks)));
+        m_vmax = RAJA_MAX(m_vmax, RAJA_MAX(m_vmax_init,
+                          reproducible::treeMax(vmax_partials, nblocks)));
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type b = 0; b < nblocks; ++b ) {
+          reduce3int_block_lam(b);
+        }
+
+        m_vsum += m_vsum_init + reproducible::treeSum(vsum_partials, nblocks);
+        m_vmin = RAJA_MIN(m_vmin, RAJA_MIN(m_vmin_init,
+                          reproducible::treeMin(vmin_partials, nblocks)));
+        m_vmax = RAJA_MAX(m_vmax, RAJA_MAX(m_vmax_init,
+                          reproducible::treeMax(vmax_partials, nblocks)));
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nblocks), reduce3int_block_lam);
+
+        m_vsum += m_vsum_init + reproducible::treeSum(vsum_partials, nblocks);
+        m_vmin = RAJA_MIN(m_vmin, RAJA_MIN(m_vmin_init,
+                          reproducible::treeMin(vmin_partials, nblocks)));
+        m_vmax = RAJA_MAX(m_vmax, RAJA_MAX(m_vmax_init,
+                          reproducible::treeMax(vmax_partials, nblocks)));
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif
+
+    default : {
+      getCout() << "\n  REDUCE3_INT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void REDUCE3_INT::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  if ( tune_idx == 0 ) {
+    runSeqVariantDefault(vid);
+  } else {
+    runSeqVariantReproducible(vid);
+  }
+}
+
+void REDUCE3_INT::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+  addVariantTuningName(vid, "reproducible");
+}
+
 } // end namespace basic
 } // end namespace rajaperf
@@ -0,0 +1,114 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "REDUCE3_INT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/StdParUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+void REDUCE3_INT::runStdParVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+#if defined(RUN_STDPAR)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE3_INT_DATA_SETUP;
+
+  struct Reduce3Vals {
+    Int_type vsum;
+    Int_type vmin;
+    Int_type vmax;
+  };
+
+  const Reduce3Vals identity{0, m_vmin_init, m_vmax_init};
+
+  auto reduce3int_combine = [](const Reduce3Vals& a, const Reduce3Vals& b) {
+                              return Reduce3Vals{a.vsum + b.vsum,
+                                                 RAJA_MIN(a.vmin, b.vmin),
+                                                 RAJA_MAX(a.vmax, b.vmax)};
+                            };
+
+  switch ( vid ) {
+
+    case Base_StdPar : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Reduce3Vals vals =
+          std::transform_reduce( std::execution::par_unseq,
+                                 stdpar::counting_iterator(ibegin),
+                                 stdpar::counting_iterator(iend),
+                                 identity,
+                                 reduce3int_combine,
+                                 [=](Index_type i) {
+            return Reduce3Vals{vec[i], vec[i], vec[i]};
+          });
+
+        m_vsum += m_vsum_init + vals.vsum;
+        m_vmin = RAJA_MIN(m_vmin, vals.vmin);
+        m_vmax = RAJA_MAX(m_vmax, vals.vmax);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_StdPar : {
+
+      auto reduce3int_base_lam = [=](Index_type i) -> Reduce3Vals {
+                                   const Int_type val = vec[i];
+                                   return Reduce3Vals{val, val, val};
+                                 };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Reduce3Vals vals =
+          std::transform_reduce( std::execution::par_unseq,
+                                 stdpar::counting_iterator(ibegin),
+                                 stdpar::counting_iterator(iend),
+                                 identity,
+                                 reduce3int_combine,
+                                 reduce3int_base_lam );
+
+        m_vsum += m_vsum_init + vals.vsum;
+        m_vmin = RAJA_MIN(m_vmin, vals.vmin);
+        m_vmax = RAJA_MAX(m_vmax, vals.vmax);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  REDUCE3_INT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -0,0 +1,116 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "REDUCE3_INT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/ThreadPool.hpp"
+
+#include <limits>
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+
+void REDUCE3_INT::runThreadPoolVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+#if defined(RUN_THREADPOOL)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE3_INT_DATA_SETUP;
+
+  struct Reduce3Vals {
+    Int_type vsum;
+    Int_type vmin;
+    Int_type vmax;
+  };
+
+  const Reduce3Vals identity{0, m_vmin_init, m_vmax_init};
+
+  auto reduce3int_combine = [](const Reduce3Vals& a, const Reduce3Vals& b) {
+                              return Reduce3Vals{a.vsum + b.vsum,
+                                                 RAJA_MIN(a.vmin, b.vmin),
+                                                 RAJA_MAX(a.vmax, b.vmax)};
+                            };
+
+  switch ( vid ) {
+
+    case Base_ThreadPool : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Reduce3Vals vals = threadpool::parallel_reduce(ibegin, iend, identity,
+          [=](Index_type cbegin, Index_type cend, Reduce3Vals& vals) {
+          Int_type vsum = vals.vsum;
+          Int_type vmin = vals.vmin;
+          Int_type vmax = vals.vmax;
+          for (Index_type i = cbegin; i < cend; ++i ) {
+            REDUCE3_INT_BODY;
+          }
+          vals = Reduce3Vals{vsum, vmin, vmax};
+        }, reduce3int_combine);
+
+        m_vsum += m_vsum_init + vals.vsum;
+        m_vmin = RAJA_MIN(m_vmin, vals.vmin);
+        m_vmax = RAJA_MAX(m_vmax, vals.vmax);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_ThreadPool : {
+
+      auto reduce3int_base_lam = [=](Index_type i) -> Int_type {
+                                   return vec[i];
+                                 };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        Reduce3Vals vals = threadpool::parallel_reduce(ibegin, iend, identity,
+          [=](Index_type cbegin, Index_type cend, Reduce3Vals& vals) {
+          for (Index_type i = cbegin; i < cend; ++i ) {
+            vals.vsum += reduce3int_base_lam(i);
+            vals.vmin = RAJA_MIN(vals.vmin, reduce3int_base_lam(i));
+            vals.vmax = RAJA_MAX(vals.vmax, reduce3int_base_lam(i));
+          }
+        }, reduce3int_combine);
+
+        m_vsum += m_vsum_init + vals.vsum;
+        m_vmin = RAJA_MIN(m_vmin, vals.vmin);
+        m_vmax = RAJA_MAX(m_vmax, vals.vmax);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  REDUCE3_INT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace basic
+} // end namespace rajaperf
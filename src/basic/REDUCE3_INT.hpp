@@ -25,6 +25,12 @@
 ///
 /// RAJA_MIN/MAX are macros that do what you would expect.
 ///
+/// The Seq and OpenMP 'reproducible' tunings reduce fixed size blocks of
+/// iterations in order and combine the block results by a fixed tree (see
+/// common/ReduceUtils.hpp). Integer sums do not depend on the order, so
+/// these tunings give the cost of the blocked reduction, for comparison
+/// with the REDUCE_STRUCT and PI_REDUCE tunings where the order matters.
+///
 
 #ifndef RAJAPerf_Basic_REDUCE3_INT_HPP
 #define RAJAPerf_Basic_REDUCE3_INT_HPP
@@ -43,8 +49,22 @@
   vmin.min(vec[i]) ; \
   vmax.max(vec[i]) ;
 
+#define REDUCE3_INT_BLOCK_BODY \
+  const Index_type bbegin = ibegin + b * reproducible::block_size; \
+  const Index_type bend = RAJA_MIN(bbegin + reproducible::block_size, iend); \
+  Int_type vsum = 0; \
+  Int_type vmin = vec[bbegin]; \
+  Int_type vmax = vec[bbegin]; \
+  for (Index_type i = bbegin; i < bend; ++i ) { \
+    REDUCE3_INT_BODY; \
+  } \
+  vsum_partials[b] = vsum; \
+  vmin_partials[b] = vmin; \
+  vmax_partials[b] = vmax;
+
 
 #include "common/KernelBase.hpp"
+#include "common/ReduceUtils.hpp"
 
 namespace rajaperf
 {
@@ -71,7 +91,17 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
-
+  void runThreadPoolVariant(VariantID vid, size_t tune_idx);
+  void runStdParVariant(VariantID vid, size_t tune_idx);
+  void runSIMDVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantReproducible(VariantID vid);
+  template < bool runtime_schedule >
+  void runOpenMPVariantImpl(VariantID vid);
+  void runOpenMPVariantReproducible(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
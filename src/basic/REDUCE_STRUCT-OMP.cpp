@@ -12,6 +12,7 @@
 
 #include <limits>
 #include <iostream>
+#include <vector>
 
 namespace rajaperf 
 {
@@ -19,7 +20,8 @@ namespace basic
 {
 
 
-void REDUCE_STRUCT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type, typename Compute_type >
+void REDUCE_STRUCT::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -27,7 +29,7 @@ void REDUCE_STRUCT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
   const Index_type ibegin = 0;
   const Index_type iend = getActualProblemSize();
 
-  REDUCE_STRUCT_DATA_SETUP;
+  REDUCE_STRUCT_PRECISION_DATA_SETUP(Data_type, Compute_type);
 
   switch ( vid ) {
 
@@ -36,9 +38,9 @@ void REDUCE_STRUCT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type xsum = m_init_sum; Real_type ysum = m_init_sum;
-        Real_type xmin = m_init_min; Real_type ymin = m_init_min;
-        Real_type xmax = m_init_max; Real_type ymax = m_init_max;
+        Compute_type xsum = init_sum; Compute_type ysum = init_sum;
+        Compute_type xmin = init_min; Compute_type ymin = init_min;
+        Compute_type xmax = init_max; Compute_type ymax = init_max;
 
         #pragma omp parallel for reduction(+:xsum), \
                                  reduction(min:xmin), \
@@ -47,7 +49,7 @@ void REDUCE_STRUCT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
                                  reduction(min:ymin), \
                                  reduction(max:ymax)
         for (Index_type i = ibegin; i < iend; ++i ) {
-          REDUCE_STRUCT_BODY;
+          REDUCE_STRUCT_PRECISION_BODY(Compute_type);
         }
 
         points.SetCenter(xsum/points.N, ysum/points.N);
@@ -65,20 +67,20 @@ void REDUCE_STRUCT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 
     case Lambda_OpenMP : {
 
-      auto reduce_struct_x_base_lam = [=](Index_type i) -> Real_type {
-                                   return points.x[i];
+      auto reduce_struct_x_base_lam = [=](Index_type i) -> Compute_type {
+                                   return x[i];
                                  };
 
-      auto reduce_struct_y_base_lam = [=](Index_type i) -> Real_type {
-                                   return points.y[i];
+      auto reduce_struct_y_base_lam = [=](Index_type i) -> Compute_type {
+                                   return y[i];
                                  };
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type xsum = m_init_sum; Real_type ysum = m_init_sum;
-        Real_type xmin = m_init_min; Real_type ymin = m_init_min;
-        Real_type xmax = m_init_max; Real_type ymax = m_init_max;
+        Compute_type xsum = init_sum; Compute_type ysum = init_sum;
+        Compute_type xmin = init_min; Compute_type ymin = init_min;
+        Compute_type xmax = init_max; Compute_type ymax = init_max;
 
         #pragma omp parallel for reduction(+:xsum), \
                                  reduction(min:xmin), \
@@ -113,16 +115,16 @@ void REDUCE_STRUCT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
  
-        RAJA::ReduceSum<RAJA::omp_reduce, Real_type> xsum(m_init_sum);
-        RAJA::ReduceSum<RAJA::omp_reduce, Real_type> ysum(m_init_sum);
-        RAJA::ReduceMin<RAJA::omp_reduce, Real_type> xmin(m_init_min); 
-        RAJA::ReduceMin<RAJA::omp_reduce, Real_type> ymin(m_init_min);
-        RAJA::ReduceMax<RAJA::omp_reduce, Real_type> xmax(m_init_max); 
-        RAJA::ReduceMax<RAJA::omp_reduce, Real_type> ymax(m_init_max);
+        RAJA::ReduceSum<RAJA::omp_reduce, Compute_type> xsum(init_sum);
+        RAJA::ReduceSum<RAJA::omp_reduce, Compute_type> ysum(init_sum);
+        RAJA::ReduceMin<RAJA::omp_reduce, Compute_type> xmin(init_min); 
+        RAJA::ReduceMin<RAJA::omp_reduce, Compute_type> ymin(init_min);
+        RAJA::ReduceMax<RAJA::omp_reduce, Compute_type> xmax(init_max); 
+        RAJA::ReduceMax<RAJA::omp_reduce, Compute_type> ymax(init_max);
 
         RAJA::forall<RAJA::omp_parallel_for_exec>(
           RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
-          REDUCE_STRUCT_BODY_RAJA;
+          REDUCE_STRUCT_PRECISION_BODY_RAJA(Compute_type);
         });
 
         points.SetCenter((xsum.get()/(points.N)),
@@ -150,5 +152,137 @@ void REDUCE_STRUCT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(t
 #endif
 }
 
+void REDUCE_STRUCT::runOpenMPVariantReproducible(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE_STRUCT_DATA_SETUP;
+
+  const Index_type nblocks = reproducible::getNumBlocks(iend - ibegin);
+  std::vector<Real_type> partials_vec(6 * nblocks);
+  Real_ptr xsum_partials = partials_vec.data();
+  Real_ptr ysum_partials = xsum_partials + nblocks;
+  Real_ptr xmin_partials = ysum_partials + nblocks;
+  Real_ptr ymin_partials = xmin_partials + nblocks;
+  Real_ptr xmax_partials = ymin_partials + nblocks;
+  Real_ptr ymax_partials = xmax_partials + nblocks;
+
+  auto reduce_struct_block_lam = [=](Index_type b) {
+                                   REDUCE_STRUCT_BLOCK_BODY;
+                                 };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type b = 0; b < nblocks; ++b ) {
+          REDUCE_STRUCT_BLOCK_BODY;
+        }
+
+        Real_type xsum = m_init_sum + reproducible::treeSum(xsum_partials, nblocks);
+        Real_type ysum = m_init_sum + reproducible::treeSum(ysum_partials, nblocks);
+        points.SetCenter(xsum/points.N, ysum/points.N);
+        points.SetXMin(RAJA_MIN(m_init_min, reproducible::treeMin(xmin_partials, nblocks)));
+        points.SetXMax(RAJA_MAX(m_init_max, reproducible::treeMax(xmax_partials, nblocks)));
+        points.SetYMin(RAJA_MIN(m_init_min, reproducible::treeMin(ymin_partials, nblocks)));
+        points.SetYMax(RAJA_MAX(m_init_max, reproducible::treeMax(ymax_partials, nblocks)));
+        m_points=points;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type b = 0; b < nblocks; ++b ) {
+          reduce_struct_block_lam(b);
+        }
+
+        Real_type xsum = m_init_sum + reproducible::treeSum(xsum_partials, nblocks);
+        Real_type ysum = m_init_sum + reproducible::treeSum(ysum_partials, nblocks);
+        points.SetCenter(xsum/points.N, ysum/points.N);
+        points.SetXMin(RAJA_MIN(m_init_min, reproducible::treeMin(xmin_partials, nblocks)));
+        points.SetXMax(RAJA_MAX(m_init_max, reproducible::treeMax(xmax_partials, nblocks)));
+        points.SetYMin(RAJA_MIN(m_init_min, reproducible::treeMin(ymin_partials, nblocks)));
+        points.SetYMax(RAJA_MAX(m_init_max, reproducible::treeMax(ymax_partials, nblocks)));
+        m_points=points;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nblocks), reduce_struct_block_lam);
+
+        Real_type xsum = m_init_sum + reproducible::treeSum(xsum_partials, nblocks);
+        Real_type ysum = m_init_sum + reproducible::treeSum(ysum_partials, nblocks);
+        points.SetCenter(xsum/points.N, ysum/points.N);
+        points.SetXMin(RAJA_MIN(m_init_min, reproducible::treeMin(xmin_partials, nblocks)));
+        points.SetXMax(RAJA_MAX(m_init_max, reproducible::treeMax(xmax_partials, nblocks)));
+        points.SetYMin(RAJA_MIN(m_init_min, reproducible::treeMin(ymin_partials, nblocks)));
+        points.SetYMax(RAJA_MAX(m_init_max, reproducible::treeMax(ymax_partials, nblocks)));
+        m_points=points;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  REDUCE_STRUCT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void REDUCE_STRUCT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+  if ( tuning_name == "reproducible" ) {
+    runOpenMPVariantReproducible(vid);
+  } else if ( tuning_name == "fp32" ) {
+    runOpenMPVariantDefault<precision::Float_type, precision::Float_type>(vid);
+  } else if ( tuning_name == "mixed" ) {
+    runOpenMPVariantDefault<precision::Float_type, Real_type>(vid);
+  } else {
+    runOpenMPVariantDefault<Real_type, Real_type>(vid);
+  }
+}
+
+void REDUCE_STRUCT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+  addVariantTuningName(vid, "reproducible");
+  for (std::string const& name : precision::getTuningNames(run_params)) {
+    addVariantTuningName(vid, name);
+  }
+}
+
 } // end namespace basic
 } // end namespace rajaperf
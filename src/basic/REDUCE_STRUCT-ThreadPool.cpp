@@ -0,0 +1,133 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "REDUCE_STRUCT.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/ThreadPool.hpp"
+
+#include <limits>
+#include <iostream>
+
+namespace rajaperf 
+{
+namespace basic
+{
+
+
+void REDUCE_STRUCT::runThreadPoolVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+#if defined(RUN_THREADPOOL)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  REDUCE_STRUCT_DATA_SETUP;
+
+  struct ReduceStructVals {
+    Real_type xsum; Real_type xmin; Real_type xmax;
+    Real_type ysum; Real_type ymin; Real_type ymax;
+  };
+
+  const ReduceStructVals identity{0.0, m_init_min, m_init_max,
+                                  0.0, m_init_min, m_init_max};
+
+  auto reduce_struct_combine = [](const ReduceStructVals& a,
+                                  const ReduceStructVals& b) {
+    return ReduceStructVals{a.xsum + b.xsum,
+                            RAJA_MIN(a.xmin, b.xmin), RAJA_MAX(a.xmax, b.xmax),
+                            a.ysum + b.ysum,
+                            RAJA_MIN(a.ymin, b.ymin), RAJA_MAX(a.ymax, b.ymax)};
+  };
+
+  switch ( vid ) {
+
+    case Base_ThreadPool : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        ReduceStructVals vals = threadpool::parallel_reduce(ibegin, iend, identity,
+          [=](Index_type cbegin, Index_type cend, ReduceStructVals& vals) {
+          Real_type xsum = vals.xsum; Real_type ysum = vals.ysum;
+          Real_type xmin = vals.xmin; Real_type ymin = vals.ymin;
+          Real_type xmax = vals.xmax; Real_type ymax = vals.ymax;
+          for (Index_type i = cbegin; i < cend; ++i ) {
+            REDUCE_STRUCT_BODY;
+          }
+          vals = ReduceStructVals{xsum, xmin, xmax, ysum, ymin, ymax};
+        }, reduce_struct_combine);
+
+        points.SetCenter((m_init_sum + vals.xsum)/points.N,
+                         (m_init_sum + vals.ysum)/points.N);
+        points.SetXMin(vals.xmin);
+        points.SetXMax(vals.xmax);
+        points.SetYMin(vals.ymin);
+        points.SetYMax(vals.ymax);
+        m_points=points;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_ThreadPool : {
+
+      auto reduce_struct_x_base_lam = [=](Index_type i) -> Real_type {
+                                   return points.x[i];
+                                 };
+
+      auto reduce_struct_y_base_lam = [=](Index_type i) -> Real_type {
+                                   return points.y[i];
+                                 };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        ReduceStructVals vals = threadpool::parallel_reduce(ibegin, iend, identity,
+          [=](Index_type cbegin, Index_type cend, ReduceStructVals& vals) {
+          for (Index_type i = cbegin; i < cend; ++i ) {
+            vals.xsum += reduce_struct_x_base_lam(i);
+            vals.xmin = RAJA_MIN(vals.xmin, reduce_struct_x_base_lam(i));
+            vals.xmax = RAJA_MAX(vals.xmax, reduce_struct_x_base_lam(i));
+            vals.ysum += reduce_struct_y_base_lam(i);
+            vals.ymin = RAJA_MIN(vals.ymin, reduce_struct_y_base_lam(i));
+            vals.ymax = RAJA_MAX(vals.ymax, reduce_struct_y_base_lam(i));
+          }
+        }, reduce_struct_combine);
+
+        points.SetCenter((m_init_sum + vals.xsum)/points.N,
+                         (m_init_sum + vals.ysum)/points.N);
+        points.SetXMin(vals.xmin);
+        points.SetXMax(vals.xmax);
+        points.SetYMin(vals.ymin);
+        points.SetYMax(vals.ymax);
+        m_points=points;
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  REDUCE_STRUCT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace basic
+} // end namespace rajaperf
@@ -56,13 +56,19 @@ REDUCE_STRUCT::REDUCE_STRUCT(const RunParams& params)
 
   setVariantDefined( Base_HIP );
   setVariantDefined( RAJA_HIP );
+
+  setVariantDefined( Base_ThreadPool );
+  setVariantDefined( Lambda_ThreadPool );
+
+  setVariantDefined( Base_SIMD );
+  setVariantDefined( RAJA_SIMD );
 }
 
 REDUCE_STRUCT::~REDUCE_STRUCT()
 {
 }
 
-void REDUCE_STRUCT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void REDUCE_STRUCT::setUp(VariantID vid, size_t tune_idx)
 {
   m_init_sum = 0.0;
   m_init_min = std::numeric_limits<Real_type>::max();
@@ -75,6 +81,13 @@ void REDUCE_STRUCT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
       m_x[i] = i*dx;  
       m_y[i] = i*dy; 
   } 
+
+  if ( precision::isTuning(getVariantTuningName(vid, tune_idx)) ) {
+    precision::allocAndCopyData(m_x_fp32, m_x, getActualProblemSize());
+    precision::allocAndCopyData(m_y_fp32, m_y, getActualProblemSize());
+    recordBytesSaved(vid, tune_idx, precision::getBytesSaved(
+      2*sizeof(Real_type) * getActualProblemSize()));
+  }
 }
 
 void REDUCE_STRUCT::updateChecksum(VariantID vid, size_t tune_idx)
@@ -89,11 +102,15 @@ void REDUCE_STRUCT::updateChecksum(VariantID vid, size_t tune_idx)
   return;
 }
 
-void REDUCE_STRUCT::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void REDUCE_STRUCT::tearDown(VariantID vid, size_t tune_idx)
 {
-  (void) vid;
   deallocData(m_x);
   deallocData(m_y);
+
+  if ( precision::isTuning(getVariantTuningName(vid, tune_idx)) ) {
+    precision::deallocData(m_x_fp32);
+    precision::deallocData(m_y_fp32);
+  }
 }
 
 } // end namespace basic
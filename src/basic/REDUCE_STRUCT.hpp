@@ -32,6 +32,14 @@
 ///
 /// RAJA_MIN/MAX are macros that do what you would expect.
 ///
+/// The Seq and OpenMP 'reproducible' tunings reduce fixed size blocks of
+/// iterations in order and combine the block results by a fixed tree (see
+/// common/ReduceUtils.hpp), so the centers are bitwise the same for any
+/// number of threads and schedule.
+///
+/// The Seq and OpenMP fp32 and mixed tunings (see common/PrecisionUtils.hpp)
+/// read x and y in Float_type and reduce them in Float_type or Real_type.
+///
 
 #ifndef RAJAPerf_Basic_REDUCE_STRUCT_HPP
 #define RAJAPerf_Basic_REDUCE_STRUCT_HPP
@@ -43,6 +51,35 @@
   points.x = m_x; \
   points.y = m_y; \
 
+// the data in the types of a precision tuning (see common/PrecisionUtils.hpp)
+#define REDUCE_STRUCT_PRECISION_DATA_SETUP(Data_type, Compute_type) \
+  REDUCE_STRUCT_DATA_SETUP \
+  Data_type* x = precision::getData<Data_type>(m_x, m_x_fp32); \
+  Data_type* y = precision::getData<Data_type>(m_y, m_y_fp32); \
+  const Compute_type init_sum = m_init_sum; \
+  const Compute_type init_min = std::numeric_limits<Compute_type>::max(); \
+  const Compute_type init_max = std::numeric_limits<Compute_type>::lowest();
+
+#define REDUCE_STRUCT_PRECISION_BODY(Compute_type)  \
+  const Compute_type xi = x[i] ; \
+  const Compute_type yi = y[i] ; \
+  xsum += xi ; \
+  xmin = RAJA_MIN(xmin, xi) ; \
+  xmax = RAJA_MAX(xmax, xi) ; \
+  ysum += yi ; \
+  ymin = RAJA_MIN(ymin, yi) ; \
+  ymax = RAJA_MAX(ymax, yi) ;
+
+#define REDUCE_STRUCT_PRECISION_BODY_RAJA(Compute_type)  \
+  const Compute_type xi = x[i] ; \
+  const Compute_type yi = y[i] ; \
+  xsum += xi ; \
+  xmin.min(xi) ; \
+  xmax.max(xi) ; \
+  ysum += yi ; \
+  ymin.min(yi) ; \
+  ymax.max(yi) ;
+
 #define REDUCE_STRUCT_BODY  \
   xsum += points.x[i] ; \
   xmin = RAJA_MIN(xmin, points.x[i]) ; \
@@ -59,8 +96,25 @@
   ymin.min(points.y[i]) ; \
   ymax.max(points.y[i]) ;
 
+#define REDUCE_STRUCT_BLOCK_BODY \
+  const Index_type bbegin = ibegin + b * reproducible::block_size; \
+  const Index_type bend = RAJA_MIN(bbegin + reproducible::block_size, iend); \
+  Real_type xsum = 0.0; Real_type ysum = 0.0; \
+  Real_type xmin = points.x[bbegin]; Real_type ymin = points.y[bbegin]; \
+  Real_type xmax = points.x[bbegin]; Real_type ymax = points.y[bbegin]; \
+  for (Index_type i = bbegin; i < bend; ++i ) { \
+    REDUCE_STRUCT_BODY; \
+  } \
+  xsum_partials[b] = xsum; ysum_partials[b] = ysum; \
+  xmin_partials[b] = xmin; ymin_partials[b] = ymin; \
+  xmax_partials[b] = xmax; ymax_partials[b] = ymax;
+
 
 #include "common/KernelBase.hpp"
+#include "common/PrecisionUtils.hpp"
+#include "common/ReduceUtils.hpp"
+
+#include <limits>
 
 namespace rajaperf
 {
@@ -86,7 +140,17 @@ public:
   void runCudaVariant(VariantID vid, size_t tune_idx);
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
-
+  void runThreadPoolVariant(VariantID vid, size_t tune_idx);
+  void runSIMDVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  template < typename Data_type, typename Compute_type >
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantReproducible(VariantID vid);
+  template < typename Data_type, typename Compute_type >
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantReproducible(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
@@ -119,6 +183,7 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
   Real_ptr m_x; Real_ptr m_y;
+  precision::Float_ptr m_x_fp32; precision::Float_ptr m_y_fp32;
   Real_type	m_init_sum; 
   Real_type	m_init_min; 
   Real_type	m_init_max; 
@@ -0,0 +1,122 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "SCATTER_ADD.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#if defined(RAJA_ENABLE_HIP)
+
+#include "common/HipDataUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace basic
+{
+
+#define SCATTER_ADD_DATA_SETUP_HIP \
+  allocAndInitHipDeviceData(x, m_x, iend); \
+  allocAndInitHipDeviceData(y, m_y, iend); \
+  allocAndInitHipDeviceData(idx, m_idx, iend);
+
+#define SCATTER_ADD_DATA_TEARDOWN_HIP \
+  getHipDeviceData(m_y, y, iend); \
+  deallocHipDeviceData(x); \
+  deallocHipDeviceData(y); \
+  deallocHipDeviceData(idx);
+
+template < size_t block_size >
+__launch_bounds__(block_size)
+__global__ void scatter_add(Real_ptr y, Real_ptr x,
+                            Int_ptr idx,
+                            Index_type iend)
+{
+   Index_type i = blockIdx.x * block_size + threadIdx.x;
+   if (i < iend) {
+     SCATTER_ADD_RAJA_BODY(RAJA::hip_atomic);
+   }
+}
+
+
+template < size_t block_size >
+void SCATTER_ADD::runHipVariantImpl(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  SCATTER_ADD_DATA_SETUP;
+
+  if ( vid == Base_HIP ) {
+
+    SCATTER_ADD_DATA_SETUP_HIP;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      hipLaunchKernelGGL((scatter_add<block_size>), dim3(grid_size), dim3(block_size), 0, 0,
+                         y, x, idx, iend );
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+    SCATTER_ADD_DATA_TEARDOWN_HIP;
+
+  } else if ( vid == Lambda_HIP ) {
+
+    SCATTER_ADD_DATA_SETUP_HIP;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      auto scatter_add_lambda = [=] __device__ (Index_type i) {
+        SCATTER_ADD_RAJA_BODY(RAJA::hip_atomic);
+      };
+
+      const size_t grid_size = RAJA_DIVIDE_CEILING_INT(iend, block_size);
+      hipLaunchKernelGGL((lambda_hip_forall<block_size, decltype(scatter_add_lambda)>),
+        grid_size, block_size, 0, 0, ibegin, iend, scatter_add_lambda);
+      hipErrchk( hipGetLastError() );
+
+    }
+    stopTimer();
+
+    SCATTER_ADD_DATA_TEARDOWN_HIP;
+
+  } else if ( vid == RAJA_HIP ) {
+
+    SCATTER_ADD_DATA_SETUP_HIP;
+
+    startTimer();
+    for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+      RAJA::forall< RAJA::hip_exec<block_size, true /*async*/> >(
+        RAJA::RangeSegment(ibegin, iend), [=] __device__ (Index_type i) {
+        SCATTER_ADD_RAJA_BODY(RAJA::hip_atomic);
+      });
+
+    }
+    stopTimer();
+
+    SCATTER_ADD_DATA_TEARDOWN_HIP;
+
+  } else {
+     getCout() << "\n  SCATTER_ADD : Unknown Hip variant id = " << vid << std::endl;
+  }
+}
+
+RAJAPERF_GPU_BLOCK_SIZE_TUNING_DEFINE_BIOLERPLATE(SCATTER_ADD, Hip)
+
+} // end namespace basic
+} // end namespace rajaperf
+
+#endif  // RAJA_ENABLE_HIP
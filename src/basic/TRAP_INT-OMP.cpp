@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/OpenMPUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -32,7 +34,8 @@ Real_type trap_int_func(Real_type x,
 }
 
 
-void TRAP_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < bool runtime_schedule >
+void TRAP_INT::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -51,9 +54,16 @@ void TRAP_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 
         Real_type sumx = m_sumx_init;
 
-        #pragma omp parallel for reduction(+:sumx)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          TRAP_INT_BODY;
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime) reduction(+:sumx)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            TRAP_INT_BODY;
+          }
+        } else {
+          #pragma omp parallel for reduction(+:sumx)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            TRAP_INT_BODY;
+          }
         }
 
         m_sumx += sumx * h;
@@ -76,9 +86,16 @@ void TRAP_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 
         Real_type sumx = m_sumx_init;
 
-        #pragma omp parallel for reduction(+:sumx)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          sumx += trapint_base_lam(i);
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime) reduction(+:sumx)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            sumx += trapint_base_lam(i);
+          }
+        } else {
+          #pragma omp parallel for reduction(+:sumx)
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            sumx += trapint_base_lam(i);
+          }
         }
 
         m_sumx += sumx * h;
@@ -96,7 +113,7 @@ void TRAP_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 
         RAJA::ReduceSum<RAJA::omp_reduce, Real_type> sumx(m_sumx_init);
 
-        RAJA::forall<RAJA::omp_parallel_for_exec>(
+        RAJA::forall<omp_schedule::parallel_for_exec<runtime_schedule>>(
           RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
           TRAP_INT_BODY;
         });
@@ -120,5 +137,7 @@ void TRAP_INT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_i
 #endif
 }
 
+RAJAPERF_OPENMP_SCHEDULE_TUNING_DEFINE_BOILERPLATE(TRAP_INT)
+
 } // end namespace basic
 } // end namespace rajaperf
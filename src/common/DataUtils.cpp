@@ -11,7 +11,10 @@
 
 #include "RAJA/internal/MemUtils_CPU.hpp"
 
+#include <algorithm>
 #include <cstdlib>
+#include <random>
+#include <vector>
 
 namespace rajaperf
 {
@@ -66,12 +69,28 @@ void allocAndInitDataRandSign(Real_ptr& ptr, int len, VariantID vid)
   initDataRandSign(ptr, len, vid);
 }
 
+void allocAndInitDataRandSign(Real_ptr& ptr, int len,
+                              Real_type neg_fraction, bool clustered,
+                              VariantID vid)
+{
+  allocData(ptr, len);
+  initDataRandSign(ptr, len, neg_fraction, clustered, vid);
+}
+
 void allocAndInitDataRandValue(Real_ptr& ptr, int len, VariantID vid)
 {
   allocData(ptr, len);
   initDataRandValue(ptr, len, vid);
 }
 
+void allocAndInitDataIndexPattern(Int_ptr& ptr, int len,
+                                  const std::string& pattern,
+                                  VariantID vid)
+{
+  allocData(ptr, len);
+  initDataIndexPattern(ptr, len, pattern, vid);
+}
+
 void allocAndInitData(Complex_ptr& ptr, int len, VariantID vid)
 {
   allocData(ptr, len);
@@ -232,6 +251,15 @@ void initDataConst(Real_ptr& ptr, int len, Real_type val,
  * Initialize Real_type data array with random sign.
  */
 void initDataRandSign(Real_ptr& ptr, int len, VariantID vid)
+{
+  initDataRandSign(ptr, len, 0.5, false, vid);
+}
+
+/*
+ * Initialize Real_type data array with a given fraction of negative entries.
+ */
+void initDataRandSign(Real_ptr& ptr, int len,
+                      Real_type neg_fraction, bool clustered, VariantID vid)
 {
   (void) vid;
 
@@ -251,9 +279,17 @@ void initDataRandSign(Real_ptr& ptr, int len, VariantID vid)
 
   srand(4793);
 
+  const int cluster_len = 1024;
+  const int cluster_neg_len = static_cast<int>(neg_fraction * cluster_len + 0.5);
+
   for (int i = 0; i < len; ++i) {
-    Real_type signfact = Real_type(rand())/RAND_MAX;
-    signfact = ( signfact < 0.5 ? -1.0 : 1.0 );
+    Real_type signfact;
+    if ( clustered ) {
+      signfact = ( i % cluster_len < cluster_neg_len ? -1.0 : 1.0 );
+    } else {
+      signfact = Real_type(rand())/RAND_MAX;
+      signfact = ( signfact < neg_fraction ? -1.0 : 1.0 );
+    }
     ptr[i] = signfact*factor*(i + 1.1)/(i + 1.12345);
   };
 
@@ -288,6 +324,93 @@ void initDataRandValue(Real_ptr& ptr, int len, VariantID vid)
   incDataInitCount();
 }
 
+/*
+ * Initialize Int_type data array with indices following a pattern.
+ */
+void initDataIndexPattern(Int_ptr& ptr, int len,
+                          const std::string& pattern, VariantID vid)
+{
+  (void) vid;
+
+// First touch...
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  if ( vid == Base_OpenMP ||
+       vid == Lambda_OpenMP ||
+       vid == RAJA_OpenMP ) {
+    #pragma omp parallel for
+    for (int i = 0; i < len; ++i) {
+      ptr[i] = 0;
+    };
+  }
+#endif
+
+  // mt19937 output is the same everywhere, unlike rand() and std::shuffle
+  std::mt19937 gen(4793);
+  auto random_permutation = [&](std::vector<Int_type>& perm) {
+    for (size_t i = 0; i < perm.size(); ++i) {
+      perm[i] = static_cast<Int_type>(i);
+    }
+    for (size_t i = perm.size(); i > 1; --i) {
+      std::swap(perm[i-1], perm[gen() % i]);
+    }
+  };
+
+  if ( pattern == "strided" ) {
+
+    const int stride = 16;
+    int i = 0;
+    for (int start = 0; start < stride; ++start) {
+      for (int j = start; j < len; j += stride) {
+        ptr[i++] = j;
+      }
+    }
+
+  } else if ( pattern == "blocked_random" ) {
+
+    const int block_size = 64;
+    std::vector<Int_type> blocks((len + block_size - 1) / block_size);
+    random_permutation(blocks);
+    int i = 0;
+    for (Int_type block : blocks) {
+      for (int j = block * block_size;
+           j < std::min((block + 1) * block_size, len); ++j) {
+        ptr[i++] = j;
+      }
+    }
+
+  } else if ( pattern == "random" ) {
+
+    std::vector<Int_type> perm(len);
+    random_permutation(perm);
+    std::copy(perm.begin(), perm.end(), ptr);
+
+  } else if ( pattern == "zipf" ) {
+
+    std::vector<Real_type> cdf(len);
+    Real_type sum = 0.0;
+    for (int n = 0; n < len; ++n) {
+      sum += 1.0 / (n + 1);
+      cdf[n] = sum;
+    }
+    std::vector<Int_type> hot(len);
+    random_permutation(hot);
+    for (int i = 0; i < len; ++i) {
+      const Real_type u = sum * (gen() / (Real_type(gen.max()) + 1.0));
+      const int n = std::upper_bound(cdf.begin(), cdf.end(), u) - cdf.begin();
+      ptr[i] = hot[std::min(n, len - 1)];
+    }
+
+  } else {
+
+    for (int i = 0; i < len; ++i) {
+      ptr[i] = i;
+    }
+
+  }
+
+  incDataInitCount();
+}
+
 /*
  * Initialize Complex_type data array.
  */
@@ -19,6 +19,7 @@
 
 #include <limits>
 #include <new>
+#include <string>
 #include <type_traits>
 
 #if defined(RAJA_ENABLE_CUDA)
@@ -76,6 +77,17 @@ void allocAndInitDataConst(Real_ptr& ptr, int len, Real_type val,
 void allocAndInitDataRandSign(Real_ptr& ptr, int len,
                               VariantID vid = NumVariants);
 
+/*!
+ * \brief Allocate and initialize aligned Real_type data array with a given
+ *        fraction of negative entries.
+ *
+ * Array is initialized using method initDataRandSign(Real_ptr& ptr, int len,
+ * Real_type neg_fraction...) below.
+ */
+void allocAndInitDataRandSign(Real_ptr& ptr, int len,
+                              Real_type neg_fraction, bool clustered,
+                              VariantID vid = NumVariants);
+
 /*!
  * \brief Allocate and initialize aligned Real_type data array with random
  *        values.
@@ -85,6 +97,16 @@ void allocAndInitDataRandSign(Real_ptr& ptr, int len,
 void allocAndInitDataRandValue(Real_ptr& ptr, int len,
                                VariantID vid = NumVariants);
 
+/*!
+ * \brief Allocate and initialize Int_type array of indices.
+ *
+ * Array is initialized using method initDataIndexPattern(Int_ptr& ptr...)
+ * below.
+ */
+void allocAndInitDataIndexPattern(Int_ptr& ptr, int len,
+                                  const std::string& pattern,
+                                  VariantID vid = NumVariants);
+
 /*!
  * \brief Allocate and initialize aligned Complex_type data array.
  */
@@ -147,6 +169,20 @@ void initDataConst(Real_ptr& ptr, int len, Real_type val,
 void initDataRandSign(Real_ptr& ptr, int len,
                       VariantID vid = NumVariants);
 
+/*!
+ * \brief Initialize Real_type data array with a given fraction of negative
+ *        entries.
+ *
+ * Array entries are initialized as in initDataRandSign(Real_ptr& ptr...)
+ * above, but a fraction neg_fraction of them are negative. If clustered is
+ * false, each entry is negative with probability neg_fraction; otherwise
+ * the negative entries form one contiguous run at the start of each block
+ * of 1024 entries.
+ */
+void initDataRandSign(Real_ptr& ptr, int len,
+                      Real_type neg_fraction, bool clustered,
+                      VariantID vid = NumVariants);
+
 /*!
  * \brief Initialize Real_type data array with random values.
  *
@@ -155,6 +191,26 @@ void initDataRandSign(Real_ptr& ptr, int len,
 void initDataRandValue(Real_ptr& ptr, int len,
                        VariantID vid = NumVariants);
 
+/*!
+ * \brief Initialize Int_type data array with indices in [0, len).
+ *
+ * The indices follow the named pattern:
+ *   identity -- ptr[i] = i
+ *   strided -- a permutation visiting every 16th index, then every 16th
+ *              index starting at 1, and so on
+ *   blocked_random -- blocks of 64 consecutive indices in random order
+ *   random -- a random permutation
+ *   zipf -- random indices where the n-th most used index is used with
+ *           probability proportional to 1/n, i.e., a small hot set of
+ *           indices (spread randomly over [0, len)) gets most of the use;
+ *           this is the only pattern with repeated indices
+ *
+ * The random patterns use a fixed seed, so they are the same in each call.
+ */
+void initDataIndexPattern(Int_ptr& ptr, int len,
+                          const std::string& pattern,
+                          VariantID vid = NumVariants);
+
 /*!
  * \brief Initialize Complex_type data array.
  *
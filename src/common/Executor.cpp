@@ -11,6 +11,7 @@
 
 #include "common/KernelBase.hpp"
 #include "common/OutputUtils.hpp"
+#include "common/ThreadPool.hpp"
 
 #ifdef RAJA_PERFSUITE_ENABLE_MPI
 #include <mpi.h>
@@ -849,6 +850,10 @@ void Executor::runSuite()
     return;
   }
 
+#if defined(RUN_THREADPOOL)
+  threadpool::initialize(run_params.getNumThreadPoolThreads());
+#endif
+
   getCout() << "\n\nRun warmup kernels...\n";
 
   vector<KernelBase*> warmup_kernels;
@@ -882,6 +887,10 @@ void Executor::runSuite()
 
   } // loop over passes through suite
 
+#if defined(RUN_THREADPOOL)
+  threadpool::finalize();
+#endif
+
 }
 
 template < typename Kernel >
@@ -949,12 +958,36 @@ void Executor::outputRunData()
     file = openOutputFile(out_fprefix + "-timing-" + RunParams::CombinerOptToStr(combiner) + ".csv");
     writeCSVReport(*file, CSVRepMode::Timing, combiner, 6 /* prec */);
 
+    file = openOutputFile(out_fprefix + "-gflops-" + RunParams::CombinerOptToStr(combiner) + ".csv");
+    writeCSVReport(*file, CSVRepMode::FlopRate, combiner, 3 /* prec */);
+
+    file = openOutputFile(out_fprefix + "-bandwidth-" + RunParams::CombinerOptToStr(combiner) + ".csv");
+    writeCSVReport(*file, CSVRepMode::Bandwidth, combiner, 3 /* prec */);
+
+    if ( run_params.getPeakGFLOPs() > 0.0 ) {
+      file = openOutputFile(out_fprefix + "-peak-" + RunParams::CombinerOptToStr(combiner) + ".csv");
+      writeCSVReport(*file, CSVRepMode::PeakFraction, combiner, 3 /* prec */);
+    }
+
     if ( haveReferenceVariant() ) {
       file = openOutputFile(out_fprefix + "-speedup-" + RunParams::CombinerOptToStr(combiner) + ".csv");
       writeCSVReport(*file, CSVRepMode::Speedup, combiner, 3 /* prec */);
     }
   }
 
+  if ( haveULPErrors() ) {
+    // errors are the largest over all passes
+    file = openOutputFile(out_fprefix + "-ulperror.csv");
+    writeCSVReport(*file, CSVRepMode::ULPError,
+                   RunParams::CombinerOpt::Maximum, 1 /* prec */);
+  }
+
+  if ( haveBytesSaved() ) {
+    file = openOutputFile(out_fprefix + "-bytessaved.csv");
+    writeCSVReport(*file, CSVRepMode::BytesSaved,
+                   RunParams::CombinerOpt::Maximum, 0 /* prec */);
+  }
+
   file = openOutputFile(out_fprefix + "-checksum.txt");
   writeChecksumReport(*file);
 
@@ -974,6 +1007,26 @@ void Executor::outputRunData()
   }
 }
 
+bool Executor::haveULPErrors() const
+{
+  for (KernelBase* kern : kernels) {
+    if ( kern->hasULPError() ) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool Executor::haveBytesSaved() const
+{
+  for (KernelBase* kern : kernels) {
+    if ( kern->hasBytesSaved() ) {
+      return true;
+    }
+  }
+  return false;
+}
+
 unique_ptr<ostream> Executor::openOutputFile(const string& filename) const
 {
   int rank = 0;
@@ -1060,6 +1113,12 @@ void Executor::writeCSVReport(ostream& file, CSVRepMode mode,
     //
     for (size_t ik = 0; ik < kernels.size(); ++ik) {
       KernelBase* kern = kernels[ik];
+      if ( (mode == CSVRepMode::ULPError) && !kern->hasULPError() ) {
+        continue;
+      }
+      if ( (mode == CSVRepMode::BytesSaved) && !kern->hasBytesSaved() ) {
+        continue;
+      }
       file <<left<< setw(kercol_width) << kern->getName();
       for (size_t iv = 0; iv < variant_ids.size(); ++iv) {
         VariantID vid = variant_ids[iv];
@@ -1070,7 +1129,7 @@ void Executor::writeCSVReport(ostream& file, CSVRepMode mode,
                (!kern->hasVariantTuningDefined(reference_vid, reference_tune_idx) ||
                 !kern->hasVariantTuningDefined(vid, tuning_name)) ) {
             file << "Not run";
-          } else if ( (mode == CSVRepMode::Timing) &&
+          } else if ( (mode != CSVRepMode::Speedup) &&
                       !kern->hasVariantTuningDefined(vid, tuning_name) ) {
             file << "Not run";
           } else {
@@ -1635,6 +1694,28 @@ string Executor::getReportTitle(CSVRepMode mode, RunParams::CombinerOpt combiner
       }
       break;
     }
+    case CSVRepMode::FlopRate : {
+      title += string("FLOP Rate Report (GFLOP/s) ");
+      break;
+    }
+    case CSVRepMode::PeakFraction : {
+      title += string("Fraction of Peak FLOP Rate Report") +
+               string(": peak = ") + std::to_string(run_params.getPeakGFLOPs()) +
+               string(" GFLOP/s ");
+      break;
+    }
+    case CSVRepMode::Bandwidth : {
+      title += string("Bandwidth Report (GB/s) ");
+      break;
+    }
+    case CSVRepMode::ULPError : {
+      title += string("Error Report (ULPs vs. std:: math) ");
+      break;
+    }
+    case CSVRepMode::BytesSaved : {
+      title += string("Memory Traffic Saved Report (bytes/rep vs. declared bytes/rep) ");
+      break;
+    }
     default : { getCout() << "\n Unknown CSV report mode = " << mode << endl; }
   };
   return title;
@@ -1702,6 +1783,35 @@ long double Executor::getReportDataEntry(CSVRepMode mode,
       }
       break;
     }
+    case CSVRepMode::FlopRate :
+    case CSVRepMode::PeakFraction : {
+      // time entries are for one pass, i.e., getRunReps() reps
+      long double time = getReportDataEntry(CSVRepMode::Timing, combiner,
+                                            kern, vid, tune_idx);
+      if ( time > 0.0 ) {
+        retval = 1.0e-9 * kern->getFLOPsPerRep() * kern->getRunReps() / time;
+      }
+      if ( mode == CSVRepMode::PeakFraction ) {
+        retval /= run_params.getPeakGFLOPs();
+      }
+      break;
+    }
+    case CSVRepMode::Bandwidth : {
+      long double time = getReportDataEntry(CSVRepMode::Timing, combiner,
+                                            kern, vid, tune_idx);
+      if ( time > 0.0 ) {
+        retval = 1.0e-9 * kern->getBytesPerRep(vid, tune_idx) * kern->getRunReps() / time;
+      }
+      break;
+    }
+    case CSVRepMode::ULPError : {
+      retval = kern->getMaxULPError(vid, tune_idx);
+      break;
+    }
+    case CSVRepMode::BytesSaved : {
+      retval = kern->getBytesSaved(vid, tune_idx);
+      break;
+    }
     default : { getCout() << "\n Unknown CSV report mode = " << mode << endl; }
   };
   return retval;
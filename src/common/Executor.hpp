@@ -52,6 +52,11 @@ private:
   enum CSVRepMode {
     Timing = 0,
     Speedup,
+    FlopRate,
+    PeakFraction,
+    Bandwidth,
+    ULPError,
+    BytesSaved,
 
     NumRepModes // Keep this one last and DO NOT remove (!!)
   };
@@ -69,6 +74,9 @@ private:
 
   bool haveReferenceVariant() { return reference_vid < NumVariants; }
 
+  bool haveULPErrors() const;
+  bool haveBytesSaved() const;
+
   void writeKernelInfoSummary(std::ostream& str, bool to_file) const;
 
   void writeCSVReport(std::ostream& file, CSVRepMode mode,
@@ -0,0 +1,277 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Vectorizable math functions for the 'simd_libm' and 'poly_<U>ulp'
+/// tunings of kernels that call transcendental functions.
+///
+/// simd_libm -- calls to the glibc libmvec vector exp, sin and cos in a
+///              '#pragma omp simd' loop, through the declarations below;
+///              only with RAJA_PERFSUITE_ENABLE_LIBMVEC.
+///
+/// poly_<U>ulp -- fastmath::exp, sin and cos below: argument reduction and
+///                a Taylor polynomial whose degree is the smallest that
+///                keeps the truncation error under U units in the last
+///                place. They are inline and branch free so loops calling
+///                them vectorize. exp is for |x| <= 708, where the result is
+///                a normal number; there is no range check, which would
+///                stop loops calling it from vectorizing. The argument
+///                reduction of sin and cos is accurate for |x| up to
+///                about 1e6. fastmath::sqrt, for the same loops, is within
+///                1 ULP at every U.
+///
+/// calcMaxULPError measures the error of a result against the std:: one.
+///
+
+#ifndef RAJAPerf_FastMath_HPP
+#define RAJAPerf_FastMath_HPP
+
+#include "rajaperf_config.hpp"
+#include "RPTypes.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#if defined(RAJAPERF_USE_LIBMVEC)
+//
+// exp, sin and cos under other names, declared to have libmvec vector
+// versions as glibc's math.h does only with -ffast-math, so omp simd loops
+// call libmvec. Other names also keep the compiler from treating them as
+// the builtins, which it may combine, e.g. sin and cos into a sincos call
+// that does not vectorize.
+//
+extern "C" {
+#pragma omp declare simd notinbranch
+double rajaperf_libmvec_exp(double) noexcept __asm__("exp");
+#pragma omp declare simd notinbranch
+double rajaperf_libmvec_sin(double) noexcept __asm__("sin");
+#pragma omp declare simd notinbranch
+double rajaperf_libmvec_cos(double) noexcept __asm__("cos");
+}
+#endif
+
+namespace rajaperf
+{
+
+namespace fastmath
+{
+
+/*!
+ * \brief Accuracies of the poly tunings, in units in the last place.
+ */
+using ulps_type = camp::int_seq<size_t, 4, 1024, 1048576>;
+
+inline std::string getPolyTuningName(size_t ulps)
+{
+  return "poly_" + std::to_string(ulps) + "ulp";
+}
+
+/*!
+ * \brief Smallest degree n such that the first Taylor term left out,
+ *        r^(n+1) / (n+1)!, is at most ulps units in the last place of a
+ *        result of size min_result, for |r| <= rmax.
+ */
+constexpr int taylorDegree(size_t ulps, double rmax, double min_result)
+{
+  double term = 1.0;
+  int n = 0;
+  while ( n < 30 ) {
+    term *= rmax / (n+1);
+    if ( term <= ulps * std::numeric_limits<double>::epsilon() / 2 * min_result ) {
+      break;
+    }
+    ++n;
+  }
+  return n;
+}
+
+//
+// Taylor polynomials in Horner form, unrolled at compile time so loops
+// calling them have no inner loop. ExpTaylor<1, n> is sum_{k<=n} r^k/k!;
+// AltTaylor<j, n> is 1 - r2/(j(j+1)) (1 - r2/((j+2)(j+3)) (...)) up to the
+// power r^n.
+//
+template < int j, int n, bool done = (j > n) >
+struct ExpTaylor
+{
+  static Real_type eval(Real_type r)
+  { return 1.0 + r * ExpTaylor<j+1, n>::eval(r) * (1.0 / j); }
+};
+template < int j, int n >
+struct ExpTaylor<j, n, true>
+{
+  static Real_type eval(Real_type) { return 1.0; }
+};
+
+template < int j, int n, bool done = (j+1 > n) >
+struct AltTaylor
+{
+  static Real_type eval(Real_type r2)
+  { return 1.0 - r2 * AltTaylor<j+2, n>::eval(r2) * (1.0 / (j*(j+1))); }
+};
+template < int j, int n >
+struct AltTaylor<j, n, true>
+{
+  static Real_type eval(Real_type) { return 1.0; }
+};
+
+//
+// kd is the nearest integer to x * inv_c, rounded by adding 1.5*2^52, and
+// the low bits of the bit pattern of t, kbits, are kd as an integer.
+//
+#define RAJAPERF_FASTMATH_ROUND(x, inv_c) \
+  const Real_type t = (x) * (inv_c) + 6755399441055744.0; \
+  const Real_type kd = t - 6755399441055744.0; \
+  std::uint64_t kbits; \
+  std::memcpy(&kbits, &t, sizeof(kbits));
+
+template < size_t ulps >
+inline Real_type exp(Real_type x)
+{
+  // exp(r) >= 1/sqrt(2) for |r| <= ln(2)/2
+  constexpr int degree = taylorDegree(ulps, 0.34657359027997264, 0.7071);
+
+  // x = k ln(2) + r, exp(x) = 2^k exp(r); ln(2) in two parts, the first
+  // with trailing zero bits so k times it is exact
+  RAJAPERF_FASTMATH_ROUND(x, 1.44269504088896338700e+00);
+  const Real_type r = (x - kd * 6.93147180369123816490e-01)
+                         - kd * 1.90821492927058770002e-10;
+
+  const Real_type p = ExpTaylor<1, degree>::eval(r);
+
+  // 2^k from its bit pattern, the exponent field is k + 1023
+  const std::uint64_t sbits = (kbits + 1023) << 52;
+  Real_type scale;
+  std::memcpy(&scale, &sbits, sizeof(scale));
+  return p * scale;
+}
+
+//
+// sin(r) and cos(r) for |r| <= pi/4 by Taylor polynomials. sin and cos of
+// x = k pi/2 + r are then +-sin(r) or +-cos(r) by the quadrant k mod 4.
+//
+template < size_t ulps >
+inline void sincosReduced(Real_type r, Real_type& s, Real_type& c)
+{
+  // sin(r)/r and cos(r) are >= 1/sqrt(2) for |r| <= pi/4
+  constexpr int degree = taylorDegree(ulps, 0.78539816339744831, 0.7071);
+
+  const Real_type r2 = r * r;
+  // sin(r) = r (1 - r^2/(2*3) (1 - r^2/(4*5) (...)))
+  s = r * AltTaylor<2, degree>::eval(r2);
+  // cos(r) = 1 - r^2/(1*2) (1 - r^2/(3*4) (...))
+  c = AltTaylor<1, degree>::eval(r2);
+}
+
+// x = k pi/2 + r with pi/2 in three parts of 33, 33 and 53 bits
+#define RAJAPERF_FASTMATH_REDUCE_PIO2(x) \
+  RAJAPERF_FASTMATH_ROUND(x, 6.36619772367581382433e-01); \
+  const Real_type r = ((x - kd * 1.57079632673412561417e+00) \
+                          - kd * 6.07710050630396597660e-11) \
+                          - kd * 2.02226624879595063154e-21;
+
+//
+// Quadrant selection with integer masks rather than conditionals, which
+// keeps loops that call both sin and cos vectorizable: the bits of a where
+// mask is set and of b elsewhere, xor sign.
+//
+inline Real_type selectBits(std::uint64_t mask, Real_type a, Real_type b,
+                            std::uint64_t sign)
+{
+  std::uint64_t abits, bbits;
+  std::memcpy(&abits, &a, sizeof(abits));
+  std::memcpy(&bbits, &b, sizeof(bbits));
+  const std::uint64_t bits = ((abits & mask) | (bbits & ~mask)) ^ sign;
+  Real_type v;
+  std::memcpy(&v, &bits, sizeof(v));
+  return v;
+}
+
+template < size_t ulps >
+inline Real_type sin(Real_type x)
+{
+  RAJAPERF_FASTMATH_REDUCE_PIO2(x);
+  Real_type s, c;
+  sincosReduced<ulps>(r, s, c);
+  // cos(r) in odd quadrants, negated in quadrants 2 and 3
+  return selectBits(std::uint64_t(0) - (kbits & 1), c, s,
+                    (kbits & 2) << 62);
+}
+
+template < size_t ulps >
+inline Real_type cos(Real_type x)
+{
+  RAJAPERF_FASTMATH_REDUCE_PIO2(x);
+  Real_type s, c;
+  sincosReduced<ulps>(r, s, c);
+  // sin(r) in odd quadrants, negated in quadrants 1 and 2
+  return selectBits(std::uint64_t(0) - (kbits & 1), s, c,
+                    ((kbits + 1) & 2) << 62);
+}
+
+//
+// std::sqrt may set errno, which keeps loops calling it from vectorizing
+// without -fno-math-errno. This is for normal x > 0: an estimate of
+// 1/sqrt(x) from the bits of x, four Newton steps, and a last correction
+// of x/sqrt(x), to within 1 ULP.
+//
+inline Real_type sqrt(Real_type x)
+{
+  std::uint64_t bits;
+  std::memcpy(&bits, &x, sizeof(bits));
+  bits = 0x5FE6EB50C7B537A9ull - (bits >> 1);
+  Real_type y;
+  std::memcpy(&y, &bits, sizeof(y));
+
+  const Real_type hx = 0.5 * x;
+  y = y * (1.5 - hx * y * y);
+  y = y * (1.5 - hx * y * y);
+  y = y * (1.5 - hx * y * y);
+  y = y * (1.5 - hx * y * y);
+
+  const Real_type s = x * y;
+  return s + (x - s * s) * (0.5 * y);
+}
+
+#undef RAJAPERF_FASTMATH_ROUND
+#undef RAJAPERF_FASTMATH_REDUCE_PIO2
+
+/*!
+ * \brief Largest difference between d and ref in units in the last place
+ *        of ref.
+ *
+ * Where d or ref is not finite the error is zero if they match exactly
+ * (NaN matching NaN) and infinite otherwise.
+ */
+inline ULPError_type calcMaxULPError(const Real_type* d, const Real_type* ref,
+                                     Index_type len)
+{
+  ULPError_type max_err = 0.0;
+  for (Index_type i = 0; i < len; ++i) {
+    ULPError_type err = 0.0;
+    if ( std::isfinite(d[i]) && std::isfinite(ref[i]) ) {
+      const Real_type aref = std::fabs(ref[i]);
+      const Real_type ulp = std::nextafter(aref, static_cast<Real_type>(HUGE_VAL)) - aref;
+      err = std::fabs(static_cast<ULPError_type>(d[i]) - ref[i]) / ulp;
+    } else if ( !(d[i] == ref[i]) &&
+                !(std::isnan(d[i]) && std::isnan(ref[i])) ) {
+      err = std::numeric_limits<ULPError_type>::infinity();
+    }
+    max_err = (err > max_err) ? err : max_err;
+  }
+  return max_err;
+}
+
+} // closing brace for fastmath namespace
+
+} // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,244 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods and macros for index type tunings.
+///
+/// The default tuning of a kernel indexes its loops with Index_type
+/// (RAJA::Index_type, 64-bit). Kernels with index type tunings also run
+///
+///   int32 -- loop indices, trip counts and index lists in Int_type
+///
+/// when it is given with the --index_type command line option. These
+/// kernels implement run*VariantImpl<Loop_index_type> with their loop
+/// indices, and the index lists they gather through, in Loop_index_type.
+/// The tunings do the same work, so their checksums match.
+///
+/// Kernels that also have precision tunings (see common/PrecisionUtils.hpp)
+/// implement run*VariantImpl<Data_type, Compute_type, Loop_index_type>; their
+/// int32 tunings run in Real_type. The OpenMP index type tunings run the loops
+/// of the default schedule tuning (see common/OpenMPUtils.hpp).
+///
+
+#ifndef RAJAPerf_IndexTypeUtils_HPP
+#define RAJAPerf_IndexTypeUtils_HPP
+
+#include "common/RPTypes.hpp"
+#include "common/RunParams.hpp"
+#include "common/OpenMPUtils.hpp"
+#include "common/PrecisionUtils.hpp"
+
+#include <limits>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+
+namespace index_type
+{
+
+/*!
+ * \brief Names of the index type tunings given with --index_type; int64 is
+ *        the default tuning.
+ *
+ * The int32 tuning is skipped, with a warning, when the problem size does
+ * not fit in Int_type.
+ */
+inline std::vector<std::string> getTuningNames(const RunParams& run_params,
+                                               Index_type problem_size)
+{
+  std::vector<std::string> names;
+  for (std::string const& index_type : run_params.getIndexTypes()) {
+    if ( index_type == "int32" ) {
+      if ( problem_size >
+           static_cast<Index_type>(std::numeric_limits<Int_type>::max()) ) {
+        getCout() << "\n Skipping int32 index type tuning, problem size "
+                  << problem_size << " exceeds the int32 range" << std::endl;
+      } else {
+        names.emplace_back("int32");
+      }
+      break;
+    }
+  }
+  return names;
+}
+
+inline bool isTuning(const std::string& tuning_name)
+{
+  return tuning_name == "int32";
+}
+
+/*!
+ * \brief The index list of a kernel in Loop_index_type, either its
+ *        Index_type list or its Int_type copy.
+ */
+template < typename Loop_index_type >
+Loop_index_type* getIndexList(Index_ptr index_list, Int_ptr int_list);
+
+template < >
+inline Index_type* getIndexList<Index_type>(Index_ptr index_list,
+                                            Int_ptr RAJAPERF_UNUSED_ARG(int_list))
+{
+  return index_list;
+}
+
+template < >
+inline Int_type* getIndexList<Int_type>(Index_ptr RAJAPERF_UNUSED_ARG(index_list),
+                                        Int_ptr int_list)
+{
+  return int_list;
+}
+
+} // closing brace for index_type namespace
+
+} // closing brace for rajaperf namespace
+
+//
+// The default and index type tunings of a kernel's Seq variants.
+//
+#define RAJAPERF_SEQ_INDEX_TYPE_TUNING_DEFINE_BOILERPLATE(kernel)              \
+  void kernel::runSeqVariant(VariantID vid, size_t tune_idx)                   \
+  {                                                                            \
+    if ( index_type::isTuning(getVariantTuningName(vid, tune_idx)) ) {         \
+      runSeqVariantImpl<Int_type>(vid);                                        \
+    } else {                                                                   \
+      runSeqVariantImpl<Index_type>(vid);                                      \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  void kernel::setSeqTuningDefinitions(VariantID vid)                          \
+  {                                                                            \
+    addVariantTuningName(vid, getDefaultTuningName());                         \
+    for (std::string const& name :                                             \
+         index_type::getTuningNames(run_params, getActualProblemSize())) {     \
+      addVariantTuningName(vid, name);                                         \
+    }                                                                          \
+  }
+
+//
+// The default and index type tunings of a kernel's OpenMP variants.
+//
+#define RAJAPERF_OPENMP_INDEX_TYPE_TUNING_DEFINE_BOILERPLATE(kernel)           \
+  void kernel::runOpenMPVariant(VariantID vid, size_t tune_idx)                \
+  {                                                                            \
+    if ( index_type::isTuning(getVariantTuningName(vid, tune_idx)) ) {         \
+      runOpenMPVariantImpl<Int_type>(vid);                                     \
+    } else {                                                                   \
+      runOpenMPVariantImpl<Index_type>(vid);                                   \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  void kernel::setOpenMPTuningDefinitions(VariantID vid)                       \
+  {                                                                            \
+    addVariantTuningName(vid, getDefaultTuningName());                         \
+    for (std::string const& name :                                             \
+         index_type::getTuningNames(run_params, getActualProblemSize())) {     \
+      addVariantTuningName(vid, name);                                         \
+    }                                                                          \
+  }
+
+//
+// The OpenMP schedule tunings of a kernel (see common/OpenMPUtils.hpp),
+// then its index type tunings, which use the default schedule.
+//
+#define RAJAPERF_OPENMP_SCHEDULE_INDEX_TYPE_TUNING_DEFINE_BOILERPLATE(kernel)  \
+  void kernel::runOpenMPVariant(VariantID vid, size_t tune_idx)                \
+  {                                                                            \
+    if ( index_type::isTuning(getVariantTuningName(vid, tune_idx)) ) {         \
+      runOpenMPVariantImpl<Int_type, false>(vid);                              \
+    } else if ( tune_idx == 0 ) {                                              \
+      runOpenMPVariantImpl<Index_type, false>(vid);                            \
+    } else {                                                                   \
+      omp_schedule::RuntimeScheduleScope schedule(run_params, tune_idx);       \
+      runOpenMPVariantImpl<Index_type, true>(vid);                             \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  void kernel::setOpenMPTuningDefinitions(VariantID vid)                       \
+  {                                                                            \
+    for (std::string const& name : omp_schedule::getTuningNames(run_params)) { \
+      addVariantTuningName(vid, name);                                         \
+    }                                                                          \
+    for (std::string const& name :                                             \
+         index_type::getTuningNames(run_params, getActualProblemSize())) {     \
+      addVariantTuningName(vid, name);                                         \
+    }                                                                          \
+  }
+
+//
+// The default, precision and index type tunings of a kernel's Seq variants.
+//
+#define RAJAPERF_SEQ_PRECISION_INDEX_TYPE_TUNING_DEFINE_BOILERPLATE(kernel)    \
+  void kernel::runSeqVariant(VariantID vid, size_t tune_idx)                   \
+  {                                                                            \
+    const std::string& tuning_name = getVariantTuningName(vid, tune_idx);      \
+    if ( tuning_name == "fp32" ) {                                             \
+      runSeqVariantImpl<precision::Float_type, precision::Float_type,          \
+                        Index_type>(vid);                                      \
+    } else if ( tuning_name == "mixed" ) {                                     \
+      runSeqVariantImpl<precision::Float_type, Real_type, Index_type>(vid);    \
+    } else if ( index_type::isTuning(tuning_name) ) {                          \
+      runSeqVariantImpl<Real_type, Real_type, Int_type>(vid);                  \
+    } else {                                                                   \
+      runSeqVariantImpl<Real_type, Real_type, Index_type>(vid);                \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  void kernel::setSeqTuningDefinitions(VariantID vid)                          \
+  {                                                                            \
+    addVariantTuningName(vid, getDefaultTuningName());                         \
+    for (std::string const& name : precision::getTuningNames(run_params)) {    \
+      addVariantTuningName(vid, name);                                         \
+    }                                                                          \
+    for (std::string const& name :                                             \
+         index_type::getTuningNames(run_params, getActualProblemSize())) {     \
+      addVariantTuningName(vid, name);                                         \
+    }                                                                          \
+  }
+
+//
+// The OpenMP schedule tunings of a kernel (see common/OpenMPUtils.hpp),
+// then its precision and index type tunings, which use the default schedule.
+//
+#define RAJAPERF_OPENMP_SCHEDULE_PRECISION_INDEX_TYPE_TUNING_DEFINE_BOILERPLATE(kernel) \
+  void kernel::runOpenMPVariant(VariantID vid, size_t tune_idx)                \
+  {                                                                            \
+    const std::string& tuning_name = getVariantTuningName(vid, tune_idx);      \
+    if ( tuning_name == "fp32" ) {                                             \
+      runOpenMPVariantImpl<precision::Float_type, precision::Float_type,       \
+                           Index_type, false>(vid);                            \
+    } else if ( tuning_name == "mixed" ) {                                     \
+      runOpenMPVariantImpl<precision::Float_type, Real_type,                   \
+                           Index_type, false>(vid);                            \
+    } else if ( index_type::isTuning(tuning_name) ) {                          \
+      runOpenMPVariantImpl<Real_type, Real_type, Int_type, false>(vid);        \
+    } else if ( tune_idx == 0 ) {                                              \
+      runOpenMPVariantImpl<Real_type, Real_type, Index_type, false>(vid);      \
+    } else {                                                                   \
+      omp_schedule::RuntimeScheduleScope schedule(run_params, tune_idx);       \
+      runOpenMPVariantImpl<Real_type, Real_type, Index_type, true>(vid);       \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  void kernel::setOpenMPTuningDefinitions(VariantID vid)                       \
+  {                                                                            \
+    for (std::string const& name : omp_schedule::getTuningNames(run_params)) { \
+      addVariantTuningName(vid, name);                                         \
+    }                                                                          \
+    for (std::string const& name : precision::getTuningNames(run_params)) {    \
+      addVariantTuningName(vid, name);                                         \
+    }                                                                          \
+    for (std::string const& name :                                             \
+         index_type::getTuningNames(run_params, getActualProblemSize())) {     \
+      addVariantTuningName(vid, name);                                         \
+    }                                                                          \
+  }
+
+#endif  // closing endif for header file include guard
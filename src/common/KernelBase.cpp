@@ -39,6 +39,9 @@ KernelBase::KernelBase(KernelID kid, const RunParams& params) :
   running_tuning = getUnknownTuningIdx();
 
   checksum_scale_factor = 1.0;
+
+  has_ulp_error = false;
+  has_bytes_saved = false;
 }
 
 
@@ -138,6 +141,33 @@ void KernelBase::setVariantDefined(VariantID vid)
     break;
     }
 
+    case Base_ThreadPool :
+    case Lambda_ThreadPool :
+    {
+#if defined(RUN_THREADPOOL)
+      setThreadPoolTuningDefinitions(vid);
+#endif
+      break;
+    }
+
+    case Base_StdPar :
+    case Lambda_StdPar :
+    {
+#if defined(RUN_STDPAR)
+      setStdParTuningDefinitions(vid);
+#endif
+      break;
+    }
+
+    case Base_SIMD :
+    case RAJA_SIMD :
+    {
+#if defined(RUN_SIMD)
+      setSIMDTuningDefinitions(vid);
+#endif
+      break;
+    }
+
     default : {
 #if 0
       getCout() << "\n  " << getName()
@@ -147,6 +177,8 @@ void KernelBase::setVariantDefined(VariantID vid)
   }
 
   checksum[vid].resize(variant_tuning_names[vid].size(), 0.0);
+  max_ulp_error[vid].resize(variant_tuning_names[vid].size(), 0.0);
+  bytes_saved[vid].resize(variant_tuning_names[vid].size(), 0);
   num_exec[vid].resize(variant_tuning_names[vid].size(), 0);
   min_time[vid].resize(variant_tuning_names[vid].size(), std::numeric_limits<double>::max());
   max_time[vid].resize(variant_tuning_names[vid].size(), -std::numeric_limits<double>::max());
@@ -251,6 +283,34 @@ void KernelBase::runKernel(VariantID vid, size_t tune_idx)
 #if defined(RUN_KOKKOS)
       runKokkosVariant(vid, tune_idx);
 #endif
+      break;
+    }
+
+    case Base_ThreadPool :
+    case Lambda_ThreadPool :
+    {
+#if defined(RUN_THREADPOOL)
+      runThreadPoolVariant(vid, tune_idx);
+#endif
+      break;
+    }
+
+    case Base_StdPar :
+    case Lambda_StdPar :
+    {
+#if defined(RUN_STDPAR)
+      runStdParVariant(vid, tune_idx);
+#endif
+      break;
+    }
+
+    case Base_SIMD :
+    case RAJA_SIMD :
+    {
+#if defined(RUN_SIMD)
+      runSIMDVariant(vid, tune_idx);
+#endif
+      break;
     }
 
     default : {
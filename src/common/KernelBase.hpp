@@ -26,6 +26,7 @@
 #include "RAJA/policy/hip/raja_hiperrchk.hpp"
 #endif
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <iostream>
@@ -94,6 +95,18 @@ public:
   virtual void setKokkosTuningDefinitions(VariantID vid)
   { addVariantTuningName(vid, getDefaultTuningName()); }
 #endif
+#if defined(RUN_THREADPOOL)
+  virtual void setThreadPoolTuningDefinitions(VariantID vid)
+  { addVariantTuningName(vid, getDefaultTuningName()); }
+#endif
+#if defined(RUN_STDPAR)
+  virtual void setStdParTuningDefinitions(VariantID vid)
+  { addVariantTuningName(vid, getDefaultTuningName()); }
+#endif
+#if defined(RUN_SIMD)
+  virtual void setSIMDTuningDefinitions(VariantID vid)
+  { addVariantTuningName(vid, getDefaultTuningName()); }
+#endif
 
   //
   // Getter methods used to generate kernel execution summary
@@ -168,6 +181,17 @@ public:
   double getTotTime(VariantID vid, size_t tune_idx) { return tot_time[vid].at(tune_idx); }
   Checksum_type getChecksum(VariantID vid, size_t tune_idx) const { return checksum[vid].at(tune_idx); }
 
+  // max error in ULPs vs. std:: math, for kernels that call recordULPError
+  bool hasULPError() const { return has_ulp_error; }
+  ULPError_type getMaxULPError(VariantID vid, size_t tune_idx) const { return max_ulp_error[vid].at(tune_idx); }
+
+  // memory traffic per rep a tuning avoids vs. getBytesPerRep(), for kernels
+  // that call recordBytesSaved
+  bool hasBytesSaved() const { return has_bytes_saved; }
+  Index_type getBytesSaved(VariantID vid, size_t tune_idx) const { return bytes_saved[vid].at(tune_idx); }
+  // memory traffic per rep of a tuning, for bandwidth
+  Index_type getBytesPerRep(VariantID vid, size_t tune_idx) const { return bytes_per_rep - bytes_saved[vid].at(tune_idx); }
+
   void execute(VariantID vid, size_t tune_idx);
 
   void synchronize()
@@ -240,6 +264,24 @@ public:
      getCout() << "\n KernelBase: Unimplemented Kokkos variant id = " << vid << std::endl;
   }
 #endif
+#if defined(RUN_THREADPOOL)
+  virtual void runThreadPoolVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+     getCout() << "\n KernelBase: Unimplemented ThreadPool variant id = " << vid << std::endl;
+  }
+#endif
+#if defined(RUN_STDPAR)
+  virtual void runStdParVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+     getCout() << "\n KernelBase: Unimplemented StdPar variant id = " << vid << std::endl;
+  }
+#endif
+#if defined(RUN_SIMD)
+  virtual void runSIMDVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+     getCout() << "\n KernelBase: Unimplemented SIMD variant id = " << vid << std::endl;
+  }
+#endif
 
 protected:
   const RunParams& run_params;
@@ -247,6 +289,19 @@ protected:
   std::vector<Checksum_type> checksum[NumVariants];
   Checksum_type checksum_scale_factor;
 
+  void recordULPError(VariantID vid, size_t tune_idx, ULPError_type err)
+  {
+    has_ulp_error = true;
+    max_ulp_error[vid].at(tune_idx) =
+        std::max(max_ulp_error[vid].at(tune_idx), err);
+  }
+
+  void recordBytesSaved(VariantID vid, size_t tune_idx, Index_type bytes)
+  {
+    has_bytes_saved = true;
+    bytes_saved[vid].at(tune_idx) = bytes;
+  }
+
 private:
   KernelBase() = delete;
 
@@ -280,6 +335,12 @@ private:
 
   std::vector<int> num_exec[NumVariants];
 
+  bool has_ulp_error;
+  std::vector<ULPError_type> max_ulp_error[NumVariants];
+
+  bool has_bytes_saved;
+  std::vector<Index_type> bytes_saved[NumVariants];
+
   RAJA::Timer timer;
 
   std::vector<RAJA::Timer::ElapsedType> min_time[NumVariants];
@@ -0,0 +1,194 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods and macros for OpenMP kernel tunings.
+///
+/// Schedule tunings: kernels implement runOpenMPVariantImpl<runtime_schedule>.
+/// The "default" tuning runs their loops as before, with no schedule clause
+/// (RAJA::omp_parallel_for_exec in RAJA variants). There is one more tuning per
+/// schedule and chunk size given by the --omp_schedule and --omp_chunk_size
+/// command line options, which runs the loops with 'schedule(runtime)'
+/// (omp_schedule::parallel_for_exec<true> in RAJA variants) with the schedule
+/// set by a RuntimeScheduleScope for the run.
+///
+/// Collapse tunings: kernels with nested loops define omp_collapse_depths_type
+/// and implement runOpenMPVariantImpl<collapse_depth>, one tuning per depth.
+///
+
+#ifndef RAJAPerf_OpenMPUtils_HPP
+#define RAJAPerf_OpenMPUtils_HPP
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/KernelBase.hpp"
+#include "common/RunParams.hpp"
+#include "common/GPUUtils.hpp"
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+#include <omp.h>
+#endif
+
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rajaperf
+{
+
+namespace omp_schedule
+{
+
+/*!
+ * \brief Return (schedule, chunk size) for each non-default schedule tuning;
+ *        chunk size 0 means the OpenMP implementation's default chunk size.
+ */
+inline std::vector<std::pair<std::string, size_t>>
+getSchedules(const RunParams& run_params)
+{
+  std::vector<std::string> schedules = run_params.getOpenMPSchedules();
+  std::vector<size_t> chunk_sizes = run_params.getOpenMPChunkSizes();
+
+  if ( schedules.empty() && !chunk_sizes.empty() ) {
+    schedules = {"static", "dynamic", "guided"};
+  }
+  if ( chunk_sizes.empty() ) {
+    chunk_sizes.push_back(0);
+  }
+
+  std::vector<std::pair<std::string, size_t>> tunings;
+  for (std::string const& schedule : schedules) {
+    for (size_t chunk_size : chunk_sizes) {
+      tunings.emplace_back(schedule, chunk_size);
+    }
+  }
+  return tunings;
+}
+
+inline std::vector<std::string> getTuningNames(const RunParams& run_params)
+{
+  std::vector<std::string> names{KernelBase::getDefaultTuningName()};
+  for (auto const& tuning : getSchedules(run_params)) {
+    names.emplace_back( (tuning.second == 0)
+                        ? tuning.first
+                        : tuning.first + "_" + std::to_string(tuning.second) );
+  }
+  return names;
+}
+
+/*!
+ * \brief Set the schedule of 'schedule(runtime)' loops for a schedule tuning
+ *        (tune_idx > 0) and restore the previous schedule when going out of
+ *        scope, so later kernels and tunings do not inherit it.
+ */
+class RuntimeScheduleScope
+{
+public:
+  RuntimeScheduleScope(const RunParams& run_params, size_t tune_idx)
+  {
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    auto const tuning = getSchedules(run_params).at(tune_idx - 1);
+    omp_sched_t kind = omp_sched_static;
+    if ( tuning.first == "dynamic" ) {
+      kind = omp_sched_dynamic;
+    } else if ( tuning.first == "guided" ) {
+      kind = omp_sched_guided;
+    }
+    setSchedule(kind, static_cast<int>(tuning.second));
+#else
+    RAJAPERF_UNUSED_VAR(run_params);
+    RAJAPERF_UNUSED_VAR(tune_idx);
+#endif
+  }
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  RuntimeScheduleScope(omp_sched_t kind, int chunk_size)
+  {
+    setSchedule(kind, chunk_size);
+  }
+#endif
+
+  ~RuntimeScheduleScope()
+  {
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+    omp_set_schedule(m_prev_kind, m_prev_chunk_size);
+#endif
+  }
+
+  RuntimeScheduleScope(const RuntimeScheduleScope&) = delete;
+  RuntimeScheduleScope& operator=(const RuntimeScheduleScope&) = delete;
+
+private:
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+  void setSchedule(omp_sched_t kind, int chunk_size)
+  {
+    omp_get_schedule(&m_prev_kind, &m_prev_chunk_size);
+    omp_set_schedule(kind, chunk_size);
+  }
+
+  omp_sched_t m_prev_kind;
+  int m_prev_chunk_size;
+#endif
+};
+
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+/*!
+ * \brief RAJA policy of the parallel loops of runOpenMPVariantImpl.
+ */
+template < bool runtime_schedule >
+using parallel_for_exec =
+    typename std::conditional<runtime_schedule,
+                              RAJA::omp_parallel_exec<RAJA::omp_for_runtime_exec>,
+                              RAJA::omp_parallel_for_exec>::type;
+#endif
+
+} // closing brace for omp_schedule namespace
+
+} // closing brace for rajaperf namespace
+
+//
+#define RAJAPERF_OPENMP_SCHEDULE_TUNING_DEFINE_BOILERPLATE(kernel)             \
+  void kernel::runOpenMPVariant(VariantID vid, size_t tune_idx)                \
+  {                                                                            \
+    if ( tune_idx == 0 ) {                                                     \
+      runOpenMPVariantImpl<false>(vid);                                        \
+    } else {                                                                   \
+      omp_schedule::RuntimeScheduleScope schedule(run_params, tune_idx);       \
+      runOpenMPVariantImpl<true>(vid);                                         \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  void kernel::setOpenMPTuningDefinitions(VariantID vid)                       \
+  {                                                                            \
+    for (std::string const& name : omp_schedule::getTuningNames(run_params)) { \
+      addVariantTuningName(vid, name);                                         \
+    }                                                                          \
+  }
+
+//
+#define RAJAPERF_OPENMP_COLLAPSE_TUNING_DEFINE_BOILERPLATE(kernel)             \
+  void kernel::runOpenMPVariant(VariantID vid, size_t tune_idx)                \
+  {                                                                            \
+    size_t t = 0;                                                              \
+    seq_for(omp_collapse_depths_type{}, [&](auto collapse_depth) {             \
+      if (tune_idx == t) {                                                     \
+        runOpenMPVariantImpl<collapse_depth>(vid);                             \
+      }                                                                        \
+      t += 1;                                                                  \
+    });                                                                        \
+  }                                                                            \
+                                                                               \
+  void kernel::setOpenMPTuningDefinitions(VariantID vid)                       \
+  {                                                                            \
+    seq_for(omp_collapse_depths_type{}, [&](auto collapse_depth) {             \
+      addVariantTuningName(vid, "collapse_"+std::to_string(collapse_depth));   \
+    });                                                                        \
+  }
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,184 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods and macros for precision tunings.
+///
+/// The default tuning of a kernel runs in Real_type (fp64 unless the Suite
+/// is built with RP_USE_FLOAT). Kernels with precision tunings also run
+///
+///   fp32  -- data stored and arithmetic done in Float_type
+///   mixed -- data stored in Float_type, arithmetic and accumulation in
+///            Real_type
+///
+/// when they are given with the --precision command line option. These
+/// kernels implement run*VariantImpl<Data_type, Compute_type> with their
+/// arrays bound to Data_type and their scalars to Compute_type. The
+/// Float_type copies of the arrays are made in setUp and converted back
+/// for the checksum, so the checksums of the tunings differ by rounding.
+///
+
+#ifndef RAJAPerf_PrecisionUtils_HPP
+#define RAJAPerf_PrecisionUtils_HPP
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/RPTypes.hpp"
+#include "common/RunParams.hpp"
+#include "common/OpenMPUtils.hpp"
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+
+namespace precision
+{
+
+using Float_type = float;
+using Float_ptr = Float_type*;
+
+/*!
+ * \brief Names of the precision tunings given with --precision, in the
+ *        order fp32, mixed; fp64 is the default tuning.
+ */
+inline std::vector<std::string> getTuningNames(const RunParams& run_params)
+{
+  std::vector<std::string> names;
+  for (const char* name : {"fp32", "mixed"}) {
+    for (std::string const& precision : run_params.getPrecisions()) {
+      if ( precision == name ) {
+        names.emplace_back(name);
+        break;
+      }
+    }
+  }
+  return names;
+}
+
+inline bool isTuning(const std::string& tuning_name)
+{
+  return tuning_name == "fp32" || tuning_name == "mixed";
+}
+
+/*!
+ * \brief Memory traffic per rep a precision tuning saves by storing
+ *        real_bytes_per_rep, the bytes per rep a kernel moves in its
+ *        Real_type arrays, as Float_type.
+ */
+inline Index_type getBytesSaved(Index_type real_bytes_per_rep)
+{
+  return real_bytes_per_rep -
+         real_bytes_per_rep / sizeof(Real_type) * sizeof(Float_type);
+}
+
+/*!
+ * \brief Allocate float_data and copy real_data into it.
+ */
+inline void allocAndCopyData(Float_ptr& float_data, const Real_type* real_data,
+                             Index_type len)
+{
+  float_data =
+    RAJA::allocate_aligned_type<Float_type>(RAJA::DATA_ALIGN,
+                                            len*sizeof(Float_type));
+  for (Index_type i = 0; i < len; ++i) {
+    float_data[i] = static_cast<Float_type>(real_data[i]);
+  }
+}
+
+inline void copyData(Real_type* real_data, const Float_type* float_data,
+                     Index_type len)
+{
+  for (Index_type i = 0; i < len; ++i) {
+    real_data[i] = static_cast<Real_type>(float_data[i]);
+  }
+}
+
+inline void deallocData(Float_ptr& float_data)
+{
+  if (float_data) {
+    RAJA::free_aligned(float_data);
+    float_data = nullptr;
+  }
+}
+
+/*!
+ * \brief The array of a kernel in Data_type, either its Real_type array or
+ *        its Float_type copy.
+ */
+template < typename Data_type >
+Data_type* getData(Real_ptr real_data, Float_ptr float_data);
+
+template < >
+inline Real_type* getData<Real_type>(Real_ptr real_data,
+                                     Float_ptr RAJAPERF_UNUSED_ARG(float_data))
+{
+  return real_data;
+}
+
+template < >
+inline Float_type* getData<Float_type>(Real_ptr RAJAPERF_UNUSED_ARG(real_data),
+                                       Float_ptr float_data)
+{
+  return float_data;
+}
+
+} // closing brace for precision namespace
+
+} // closing brace for rajaperf namespace
+
+//
+// The default and precision tunings of a kernel's Seq variants.
+//
+#define RAJAPERF_SEQ_PRECISION_TUNING_DEFINE_BOILERPLATE(kernel)               \
+  void kernel::runSeqVariant(VariantID vid, size_t tune_idx)                   \
+  {                                                                            \
+    const std::string& tuning_name = getVariantTuningName(vid, tune_idx);      \
+    if ( tuning_name == "fp32" ) {                                             \
+      runSeqVariantImpl<precision::Float_type, precision::Float_type>(vid);    \
+    } else if ( tuning_name == "mixed" ) {                                     \
+      runSeqVariantImpl<precision::Float_type, Real_type>(vid);                \
+    } else {                                                                   \
+      runSeqVariantImpl<Real_type, Real_type>(vid);                            \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  void kernel::setSeqTuningDefinitions(VariantID vid)                          \
+  {                                                                            \
+    addVariantTuningName(vid, getDefaultTuningName());                         \
+    for (std::string const& name : precision::getTuningNames(run_params)) {    \
+      addVariantTuningName(vid, name);                                         \
+    }                                                                          \
+  }
+
+//
+// The default and precision tunings of a kernel's OpenMP variants.
+//
+#define RAJAPERF_OPENMP_PRECISION_TUNING_DEFINE_BOILERPLATE(kernel)            \
+  void kernel::runOpenMPVariant(VariantID vid, size_t tune_idx)                \
+  {                                                                            \
+    const std::string& tuning_name = getVariantTuningName(vid, tune_idx);      \
+    if ( tuning_name == "fp32" ) {                                             \
+      runOpenMPVariantImpl<precision::Float_type, precision::Float_type>(vid); \
+    } else if ( tuning_name == "mixed" ) {                                     \
+      runOpenMPVariantImpl<precision::Float_type, Real_type>(vid);             \
+    } else {                                                                   \
+      runOpenMPVariantImpl<Real_type, Real_type>(vid);                         \
+    }                                                                          \
+  }                                                                            \
+                                                                               \
+  void kernel::setOpenMPTuningDefinitions(VariantID vid)                       \
+  {                                                                            \
+    addVariantTuningName(vid, getDefaultTuningName());                         \
+    for (std::string const& name : precision::getTuningNames(run_params)) {    \
+      addVariantTuningName(vid, name);                                         \
+    }                                                                          \
+  }
+
+#endif  // closing endif for header file include guard
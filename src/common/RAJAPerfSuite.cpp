@@ -17,8 +17,11 @@
 //
 // Basic kernels...
 //
+#include "basic/ATOMIC_CONTENTION.hpp"
 #include "basic/DAXPY.hpp"
 #include "basic/DAXPY_ATOMIC.hpp"
+#include "basic/GATHER.hpp"
+#include "basic/HISTOGRAM.hpp"
 #include "basic/IF_QUAD.hpp"
 #include "basic/INDEXLIST.hpp"
 #include "basic/INDEXLIST_3LOOP.hpp"
@@ -32,6 +35,8 @@
 #include "basic/PI_REDUCE.hpp"
 #include "basic/REDUCE3_INT.hpp"
 #include "basic/REDUCE_STRUCT.hpp"
+#include "basic/SCATTER.hpp"
+#include "basic/SCATTER_ADD.hpp"
 #include "basic/TRAP_INT.hpp"
 
 //
@@ -42,12 +47,16 @@
 #include "lcals/FIRST_DIFF.hpp"
 #include "lcals/FIRST_MIN.hpp"
 #include "lcals/FIRST_SUM.hpp"
+#include "lcals/FIRST_SUM_ORIG.hpp"
+#include "lcals/FUSION_CHAIN.hpp"
 #include "lcals/GEN_LIN_RECUR.hpp"
+#include "lcals/GEN_LIN_RECUR_ORIG.hpp"
 #include "lcals/HYDRO_1D.hpp"
 #include "lcals/HYDRO_2D.hpp"
 #include "lcals/INT_PREDICT.hpp"
 #include "lcals/PLANCKIAN.hpp"
 #include "lcals/TRIDIAG_ELIM.hpp"
+#include "lcals/TRIDIAG_ELIM_ORIG.hpp"
 
 //
 // Polybench kernels...
@@ -80,6 +89,7 @@
 //
 #include "apps/CONVECTION3DPA.hpp"
 #include "apps/WIP-COUPLE.hpp"
+#include "apps/COUPLE_REAL.hpp"
 #include "apps/DEL_DOT_VEC_2D.hpp"
 #include "apps/DIFFUSION3DPA.hpp"
 #include "apps/ENERGY.hpp"
@@ -91,6 +101,8 @@
 #include "apps/MASS3DPA.hpp"
 #include "apps/NODAL_ACCUMULATION_3D.hpp"
 #include "apps/PRESSURE.hpp"
+#include "apps/SPMV.hpp"
+#include "apps/TRIDIAG_BATCH.hpp"
 #include "apps/VOL3D.hpp"
 
 //
@@ -153,8 +165,11 @@ static const std::string KernelNames [] =
 //
 // Basic kernels...
 //
+  std::string("Basic_ATOMIC_CONTENTION"),
   std::string("Basic_DAXPY"),
   std::string("Basic_DAXPY_ATOMIC"),
+  std::string("Basic_GATHER"),
+  std::string("Basic_HISTOGRAM"),
   std::string("Basic_IF_QUAD"),
   std::string("Basic_INDEXLIST"),
   std::string("Basic_INDEXLIST_3LOOP"),
@@ -168,6 +183,8 @@ static const std::string KernelNames [] =
   std::string("Basic_PI_REDUCE"),
   std::string("Basic_REDUCE3_INT"),
   std::string("Basic_REDUCE_STRUCT"),
+  std::string("Basic_SCATTER"),
+  std::string("Basic_SCATTER_ADD"),
   std::string("Basic_TRAP_INT"),
 
 //
@@ -178,12 +195,16 @@ static const std::string KernelNames [] =
   std::string("Lcals_FIRST_DIFF"),
   std::string("Lcals_FIRST_MIN"),
   std::string("Lcals_FIRST_SUM"),
+  std::string("Lcals_FIRST_SUM_ORIG"),
+  std::string("Lcals_FUSION_CHAIN"),
   std::string("Lcals_GEN_LIN_RECUR"),
+  std::string("Lcals_GEN_LIN_RECUR_ORIG"),
   std::string("Lcals_HYDRO_1D"),
   std::string("Lcals_HYDRO_2D"),
   std::string("Lcals_INT_PREDICT"),
   std::string("Lcals_PLANCKIAN"),
   std::string("Lcals_TRIDIAG_ELIM"),
+  std::string("Lcals_TRIDIAG_ELIM_ORIG"),
 
 //
 // Polybench kernels...
@@ -216,6 +237,7 @@ static const std::string KernelNames [] =
 //
   std::string("Apps_CONVECTION3DPA"),
   std::string("Apps_COUPLE"),
+  std::string("Apps_COUPLE_REAL"),
   std::string("Apps_DEL_DOT_VEC_2D"),
   std::string("Apps_DIFFUSION3DPA"),
   std::string("Apps_ENERGY"),
@@ -227,6 +249,8 @@ static const std::string KernelNames [] =
   std::string("Apps_MASS3DPA"),
   std::string("Apps_NODAL_ACCUMULATION_3D"),
   std::string("Apps_PRESSURE"),
+  std::string("Apps_SPMV"),
+  std::string("Apps_TRIDIAG_BATCH"),
   std::string("Apps_VOL3D"),
 
 //
@@ -280,6 +304,15 @@ static const std::string VariantNames [] =
 
   std::string("Kokkos_Lambda"),
 
+  std::string("Base_ThreadPool"),
+  std::string("Lambda_ThreadPool"),
+
+  std::string("Base_StdPar"),
+  std::string("Lambda_StdPar"),
+
+  std::string("Base_SIMD"),
+  std::string("RAJA_SIMD"),
+
   std::string("Unknown Variant")  // Keep this at the end and DO NOT remove....
 
 }; // END VariantNames
@@ -430,6 +463,27 @@ bool isVariantAvailable(VariantID vid)
   }
 #endif
 
+#if defined(RUN_THREADPOOL)
+  if ( vid == Base_ThreadPool ||
+       vid == Lambda_ThreadPool ) {
+    ret_val = true;
+  }
+#endif
+
+#if defined(RUN_STDPAR)
+  if ( vid == Base_StdPar ||
+       vid == Lambda_StdPar ) {
+    ret_val = true;
+  }
+#endif
+
+#if defined(RUN_SIMD)
+  if ( vid == Base_SIMD ||
+       vid == RAJA_SIMD ) {
+    ret_val = true;
+  }
+#endif
+
   return ret_val;
 }
 
@@ -491,6 +545,27 @@ bool isVariantGPU(VariantID vid)
   }
 #endif
 
+#if defined(RUN_THREADPOOL)
+  if ( vid == Base_ThreadPool ||
+       vid == Lambda_ThreadPool ) {
+    ret_val = false;
+  }
+#endif
+
+#if defined(RUN_STDPAR)
+  if ( vid == Base_StdPar ||
+       vid == Lambda_StdPar ) {
+    ret_val = false;
+  }
+#endif
+
+#if defined(RUN_SIMD)
+  if ( vid == Base_SIMD ||
+       vid == RAJA_SIMD ) {
+    ret_val = false;
+  }
+#endif
+
   return ret_val;
 }
 
@@ -523,6 +598,10 @@ KernelBase* getKernelObject(KernelID kid,
     //
     // Basic kernels...
     //
+    case Basic_ATOMIC_CONTENTION : {
+       kernel = new basic::ATOMIC_CONTENTION(run_params);
+       break;
+    }
     case Basic_DAXPY : {
        kernel = new basic::DAXPY(run_params);
        break;
@@ -531,6 +610,14 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new basic::DAXPY_ATOMIC(run_params);
        break;
     }
+    case Basic_GATHER : {
+       kernel = new basic::GATHER(run_params);
+       break;
+    }
+    case Basic_HISTOGRAM : {
+       kernel = new basic::HISTOGRAM(run_params);
+       break;
+    }
     case Basic_IF_QUAD : {
        kernel = new basic::IF_QUAD(run_params);
        break;
@@ -583,6 +670,14 @@ KernelBase* getKernelObject(KernelID kid,
         kernel = new basic::REDUCE_STRUCT(run_params);
         break;
     } 	
+    case Basic_SCATTER : {
+       kernel = new basic::SCATTER(run_params);
+       break;
+    }
+    case Basic_SCATTER_ADD : {
+       kernel = new basic::SCATTER_ADD(run_params);
+       break;
+    }
     case Basic_TRAP_INT : {
        kernel = new basic::TRAP_INT(run_params);
        break;
@@ -611,10 +706,22 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new lcals::FIRST_SUM(run_params);
        break;
     }
+    case Lcals_FIRST_SUM_ORIG : {
+       kernel = new lcals::FIRST_SUM_ORIG(run_params);
+       break;
+    }
+    case Lcals_FUSION_CHAIN : {
+       kernel = new lcals::FUSION_CHAIN(run_params);
+       break;
+    }
     case Lcals_GEN_LIN_RECUR : {
        kernel = new lcals::GEN_LIN_RECUR(run_params);
        break;
     }
+    case Lcals_GEN_LIN_RECUR_ORIG : {
+       kernel = new lcals::GEN_LIN_RECUR_ORIG(run_params);
+       break;
+    }
     case Lcals_HYDRO_1D : {
        kernel = new lcals::HYDRO_1D(run_params);
        break;
@@ -635,6 +742,10 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new lcals::TRIDIAG_ELIM(run_params);
        break;
     }
+    case Lcals_TRIDIAG_ELIM_ORIG : {
+       kernel = new lcals::TRIDIAG_ELIM_ORIG(run_params);
+       break;
+    }
 
 //
 // Polybench kernels...
@@ -727,6 +838,10 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new apps::COUPLE(run_params);
        break;
     }
+    case Apps_COUPLE_REAL : {
+       kernel = new apps::COUPLE_REAL(run_params);
+       break;
+    }
     case Apps_DEL_DOT_VEC_2D : {
        kernel = new apps::DEL_DOT_VEC_2D(run_params);
        break;
@@ -771,6 +886,14 @@ KernelBase* getKernelObject(KernelID kid,
        kernel = new apps::PRESSURE(run_params);
        break;
     }
+    case Apps_SPMV : {
+       kernel = new apps::SPMV(run_params);
+       break;
+    }
+    case Apps_TRIDIAG_BATCH : {
+       kernel = new apps::TRIDIAG_BATCH(run_params);
+       break;
+    }
     case Apps_VOL3D : {
        kernel = new apps::VOL3D(run_params);
        break;
@@ -70,8 +70,11 @@ enum KernelID {
 //
 // Basic kernels...
 //
-  Basic_DAXPY = 0,
+  Basic_ATOMIC_CONTENTION = 0,
+  Basic_DAXPY,
   Basic_DAXPY_ATOMIC,
+  Basic_GATHER,
+  Basic_HISTOGRAM,
   Basic_IF_QUAD,
   Basic_INDEXLIST,
   Basic_INDEXLIST_3LOOP,
@@ -85,6 +88,8 @@ enum KernelID {
   Basic_PI_REDUCE,
   Basic_REDUCE3_INT,
   Basic_REDUCE_STRUCT,
+  Basic_SCATTER,
+  Basic_SCATTER_ADD,
   Basic_TRAP_INT,
 
 //
@@ -95,12 +100,16 @@ enum KernelID {
   Lcals_FIRST_DIFF,
   Lcals_FIRST_MIN,
   Lcals_FIRST_SUM,
+  Lcals_FIRST_SUM_ORIG,
+  Lcals_FUSION_CHAIN,
   Lcals_GEN_LIN_RECUR,
+  Lcals_GEN_LIN_RECUR_ORIG,
   Lcals_HYDRO_1D,
   Lcals_HYDRO_2D,
   Lcals_INT_PREDICT,
   Lcals_PLANCKIAN,
   Lcals_TRIDIAG_ELIM,
+  Lcals_TRIDIAG_ELIM_ORIG,
 
 //
 // Polybench kernels...
@@ -133,6 +142,7 @@ enum KernelID {
 //
   Apps_CONVECTION3DPA,
   Apps_COUPLE,
+  Apps_COUPLE_REAL,
   Apps_DEL_DOT_VEC_2D,
   Apps_DIFFUSION3DPA,
   Apps_ENERGY,
@@ -144,6 +154,8 @@ enum KernelID {
   Apps_MASS3DPA,
   Apps_NODAL_ACCUMULATION_3D,
   Apps_PRESSURE,
+  Apps_SPMV,
+  Apps_TRIDIAG_BATCH,
   Apps_VOL3D,
 
 //
@@ -196,6 +208,15 @@ enum VariantID {
 
   Kokkos_Lambda,
 
+  Base_ThreadPool,
+  Lambda_ThreadPool,
+
+  Base_StdPar,
+  Lambda_StdPar,
+
+  Base_SIMD,
+  RAJA_SIMD,
+
   NumVariants // Keep this one last and NEVER comment out (!!)
 
 };
@@ -85,6 +85,16 @@ using Checksum_type = long double;
 #define Checksum_MPI_type MPI_LONG_DOUBLE
 
 
+/*!
+ ******************************************************************************
+ *
+ * \brief Type used for errors in units in the last place (ULPs).
+ *
+ ******************************************************************************
+ */
+using ULPError_type = double;
+
+
 /*!
  ******************************************************************************
  *
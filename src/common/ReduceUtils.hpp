@@ -0,0 +1,81 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Methods for the 'reproducible' reduction tunings.
+///
+/// The iteration space is split into blocks of a fixed number of
+/// iterations, independent of the number of threads and the schedule. Each
+/// block is reduced in iteration order into its own partial result, and the
+/// partial results are combined by a fixed pairwise tree. Every step is in
+/// an order set by the problem size alone, so floating point sums are
+/// bitwise the same for any thread count, schedule, or back-end that
+/// follows the same blocking.
+///
+
+#ifndef RAJAPerf_ReduceUtils_HPP
+#define RAJAPerf_ReduceUtils_HPP
+
+#include "RPTypes.hpp"
+
+#include <algorithm>
+
+namespace rajaperf
+{
+
+namespace reproducible
+{
+
+/*!
+ * \brief Number of iterations reduced in order into each partial result.
+ */
+constexpr Index_type block_size = 1024;
+
+inline Index_type getNumBlocks(Index_type len)
+{
+  return (len + block_size - 1) / block_size;
+}
+
+/*!
+ * \brief Combine partials[0, num) pairwise: first 0+1, 2+3, ..., then the
+ *        pair sums pairwise, and so on. Overwrites partials.
+ */
+template < typename T, typename Combine >
+inline T treeReduce(T* partials, Index_type num, Combine combine)
+{
+  for (Index_type stride = 1; stride < num; stride *= 2) {
+    for (Index_type b = 0; b + stride < num; b += 2*stride) {
+      partials[b] = combine(partials[b], partials[b + stride]);
+    }
+  }
+  return partials[0];
+}
+
+template < typename T >
+inline T treeSum(T* partials, Index_type num)
+{
+  return treeReduce(partials, num, [](T a, T b) { return a + b; });
+}
+
+template < typename T >
+inline T treeMin(T* partials, Index_type num)
+{
+  return treeReduce(partials, num, [](T a, T b) { return std::min(a, b); });
+}
+
+template < typename T >
+inline T treeMax(T* partials, Index_type num)
+{
+  return treeReduce(partials, num, [](T a, T b) { return std::max(a, b); });
+}
+
+} // closing brace for reproducible namespace
+
+} // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
@@ -10,6 +10,8 @@
 
 #include "KernelBase.hpp"
 
+#include "polybench/PolybenchData.hpp"
+
 #include <cstdlib>
 #include <cstdio>
 #include <iostream>
@@ -35,7 +37,28 @@ RunParams::RunParams(int argc, char** argv)
    size(0.0),
    size_factor(0.0),
    gpu_block_sizes(),
+   threadpool_threads(0),
+   omp_schedules(),
+   omp_chunk_sizes(),
+   indexlist_selectivity(0.5),
+   indexlist_pattern("uniform"),
+   if_quad_complex_fraction(-1.0),
+   if_quad_pattern("uniform"),
+   indirect_index_pattern("random"),
+   spmv_stencil(7),
+   spmv_ordering("natural"),
+   histogram_bins(1024),
+   histogram_distribution("uniform"),
+   tridiag_system_size(64),
+   first_min_loc(0.5),
+   first_min_ties(1),
+   fusion_chain(),
+   precisions(),
+   index_types(),
+   polybench_dataset(),
+   polybench_dims(),
    pf_tol(0.1),
+   peak_gflops(0.0),
    checkrun_reps(1),
    reference_variant(),
    kernel_input(),
@@ -102,7 +125,46 @@ void RunParams::print(std::ostream& str) const
   for (size_t j = 0; j < gpu_block_sizes.size(); ++j) {
     str << "\n\t" << gpu_block_sizes[j];
   }
+  str << "\n threadpool_threads = " << threadpool_threads;
+  str << "\n omp_schedules = ";
+  for (size_t j = 0; j < omp_schedules.size(); ++j) {
+    str << "\n\t" << omp_schedules[j];
+  }
+  str << "\n omp_chunk_sizes = ";
+  for (size_t j = 0; j < omp_chunk_sizes.size(); ++j) {
+    str << "\n\t" << omp_chunk_sizes[j];
+  }
+  str << "\n indexlist_selectivity = " << indexlist_selectivity;
+  str << "\n indexlist_pattern = " << indexlist_pattern;
+  str << "\n if_quad_complex_fraction = " << if_quad_complex_fraction;
+  str << "\n if_quad_pattern = " << if_quad_pattern;
+  str << "\n indirect_index_pattern = " << indirect_index_pattern;
+  str << "\n spmv_stencil = " << spmv_stencil;
+  str << "\n spmv_ordering = " << spmv_ordering;
+  str << "\n histogram_bins = " << histogram_bins;
+  str << "\n histogram_distribution = " << histogram_distribution;
+  str << "\n tridiag_system_size = " << tridiag_system_size;
+  str << "\n first_min_loc = " << first_min_loc;
+  str << "\n first_min_ties = " << first_min_ties;
+  str << "\n fusion_chain = ";
+  for (size_t j = 0; j < fusion_chain.size(); ++j) {
+    str << "\n\t" << fusion_chain[j];
+  }
+  str << "\n precisions = ";
+  for (size_t j = 0; j < precisions.size(); ++j) {
+    str << "\n\t" << precisions[j];
+  }
+  str << "\n index_types = ";
+  for (size_t j = 0; j < index_types.size(); ++j) {
+    str << "\n\t" << index_types[j];
+  }
+  str << "\n polybench_dataset = " << polybench_dataset;
+  str << "\n polybench_dims = ";
+  for (size_t j = 0; j < polybench_dims.size(); ++j) {
+    str << "\n\t" << polybench_dims[j];
+  }
   str << "\n pf_tol = " << pf_tol;
+  str << "\n peak_gflops = " << peak_gflops;
   str << "\n checkrun_reps = " << checkrun_reps;
   str << "\n reference_variant = " << reference_variant;
   str << "\n outdir = " << outdir;
@@ -347,6 +409,484 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         input_state = BadInput;
       }
 
+    } else if ( opt == std::string("--threadpool_threads") ) {
+
+      i++;
+      if ( i < argc ) {
+        threadpool_threads = ::atoi( argv[i] );
+        if ( threadpool_threads < 0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --threadpool_threads a non-negative value (int)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --threadpool_threads a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--omp_schedule") ) {
+
+      bool got_someting = false;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          got_someting = true;
+          if ( opt == std::string("static") ||
+               opt == std::string("dynamic") ||
+               opt == std::string("guided") ) {
+            omp_schedules.push_back(opt);
+          } else {
+            getCout() << "\nBad input:"
+                      << " must give --omp_schedule values static, dynamic, or guided"
+                      << std::endl;
+            input_state = BadInput;
+          }
+          ++i;
+        }
+      }
+      if (!got_someting) {
+        getCout() << "\nBad input:"
+                  << " must give --omp_schedule one or more values"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--omp_chunk_size") ) {
+
+      bool got_someting = false;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          got_someting = true;
+          int omp_chunk_size = ::atoi( opt.c_str() );
+          if ( omp_chunk_size <= 0 ) {
+            getCout() << "\nBad input:"
+                      << " must give --omp_chunk_size POSITIVE values (int)"
+                      << std::endl;
+            input_state = BadInput;
+          } else {
+            omp_chunk_sizes.push_back(omp_chunk_size);
+          }
+          ++i;
+        }
+      }
+      if (!got_someting) {
+        getCout() << "\nBad input:"
+                  << " must give --omp_chunk_size one or more values (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--indexlist_selectivity") ) {
+
+      i++;
+      if ( i < argc ) {
+        indexlist_selectivity = ::atof( argv[i] );
+        if ( indexlist_selectivity < 0.0 || indexlist_selectivity > 1.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --indexlist_selectivity a value in [0.0, 1.0] (fp)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --indexlist_selectivity a value (fp)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--indexlist_pattern") ) {
+
+      i++;
+      if ( i < argc ) {
+        indexlist_pattern = std::string( argv[i] );
+        if ( indexlist_pattern != std::string("uniform") &&
+             indexlist_pattern != std::string("clustered") ) {
+          getCout() << "\nBad input:"
+                    << " must give --indexlist_pattern value uniform or clustered"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --indexlist_pattern a value (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--if_quad_complex_fraction") ) {
+
+      i++;
+      if ( i < argc ) {
+        if_quad_complex_fraction = ::atof( argv[i] );
+        if ( if_quad_complex_fraction < 0.0 || if_quad_complex_fraction > 1.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --if_quad_complex_fraction a value in [0.0, 1.0] (fp)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --if_quad_complex_fraction a value (fp)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--if_quad_pattern") ) {
+
+      i++;
+      if ( i < argc ) {
+        if_quad_pattern = std::string( argv[i] );
+        if ( if_quad_pattern != std::string("uniform") &&
+             if_quad_pattern != std::string("clustered") ) {
+          getCout() << "\nBad input:"
+                    << " must give --if_quad_pattern value uniform or clustered"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --if_quad_pattern a value (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--indirect_index_pattern") ) {
+
+      i++;
+      if ( i < argc ) {
+        indirect_index_pattern = std::string( argv[i] );
+        if ( indirect_index_pattern != std::string("identity") &&
+             indirect_index_pattern != std::string("strided") &&
+             indirect_index_pattern != std::string("blocked_random") &&
+             indirect_index_pattern != std::string("random") &&
+             indirect_index_pattern != std::string("zipf") ) {
+          getCout() << "\nBad input:"
+                    << " must give --indirect_index_pattern value identity,"
+                    << " strided, blocked_random, random, or zipf"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --indirect_index_pattern a value (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--spmv_stencil") ) {
+
+      i++;
+      if ( i < argc ) {
+        spmv_stencil = ::atoi( argv[i] );
+        if ( spmv_stencil != 7 && spmv_stencil != 27 ) {
+          getCout() << "\nBad input:"
+                    << " must give --spmv_stencil value 7 or 27"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --spmv_stencil a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--spmv_ordering") ) {
+
+      i++;
+      if ( i < argc ) {
+        spmv_ordering = std::string( argv[i] );
+        if ( spmv_ordering != std::string("natural") &&
+             spmv_ordering != std::string("random") ) {
+          getCout() << "\nBad input:"
+                    << " must give --spmv_ordering value natural or random"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --spmv_ordering a value (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--histogram_bins") ) {
+
+      i++;
+      if ( i < argc ) {
+        histogram_bins = ::atoi( argv[i] );
+        if ( histogram_bins < 1 ) {
+          getCout() << "\nBad input:"
+                    << " must give --histogram_bins a value of at least 1"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --histogram_bins a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--histogram_distribution") ) {
+
+      i++;
+      if ( i < argc ) {
+        histogram_distribution = std::string( argv[i] );
+        if ( histogram_distribution != std::string("uniform") &&
+             histogram_distribution != std::string("normal") &&
+             histogram_distribution != std::string("zipf") ) {
+          getCout() << "\nBad input:"
+                    << " must give --histogram_distribution value uniform,"
+                    << " normal, or zipf"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --histogram_distribution a value (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--tridiag_system_size") ) {
+
+      i++;
+      if ( i < argc ) {
+        tridiag_system_size = ::atoi( argv[i] );
+        if ( tridiag_system_size < 1 ) {
+          getCout() << "\nBad input:"
+                    << " must give --tridiag_system_size a value of at least 1"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --tridiag_system_size a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--first_min_loc") ) {
+
+      i++;
+      if ( i < argc ) {
+        first_min_loc = ::atof( argv[i] );
+        if ( first_min_loc < 0.0 || first_min_loc > 1.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --first_min_loc a value in [0.0, 1.0] (fp)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --first_min_loc a value (fp)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--first_min_ties") ) {
+
+      i++;
+      if ( i < argc ) {
+        first_min_ties = ::atoi( argv[i] );
+        if ( first_min_ties < 1 ) {
+          getCout() << "\nBad input:"
+                    << " must give --first_min_ties a value of at least 1"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --first_min_ties a value (int)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--fusion_chain") ) {
+
+      bool got_someting = false;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          got_someting = true;
+          if ( opt == std::string("HYDRO_1D") ||
+               opt == std::string("FIRST_DIFF") ||
+               opt == std::string("EOS") ) {
+            fusion_chain.push_back(opt);
+          } else {
+            getCout() << "\nBad input:"
+                      << " must give --fusion_chain values HYDRO_1D, FIRST_DIFF, or EOS"
+                      << std::endl;
+            input_state = BadInput;
+          }
+          ++i;
+        }
+      }
+      if (!got_someting) {
+        getCout() << "\nBad input:"
+                  << " must give --fusion_chain one or more values"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--precision") ) {
+
+      bool got_someting = false;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          got_someting = true;
+          if ( opt == std::string("fp64") ||
+               opt == std::string("fp32") ||
+               opt == std::string("mixed") ) {
+            precisions.push_back(opt);
+          } else {
+            getCout() << "\nBad input:"
+                      << " must give --precision values fp64, fp32, or mixed"
+                      << std::endl;
+            input_state = BadInput;
+          }
+          ++i;
+        }
+      }
+      if (!got_someting) {
+        getCout() << "\nBad input:"
+                  << " must give --precision one or more values"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--index_type") ) {
+
+      bool got_someting = false;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          got_someting = true;
+          if ( opt == std::string("int64") ||
+               opt == std::string("int32") ) {
+            index_types.push_back(opt);
+          } else {
+            getCout() << "\nBad input:"
+                      << " must give --index_type values int64 or int32"
+                      << std::endl;
+            input_state = BadInput;
+          }
+          ++i;
+        }
+      }
+      if (!got_someting) {
+        getCout() << "\nBad input:"
+                  << " must give --index_type one or more values"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--polybench_dataset") ) {
+
+      i++;
+      if ( i < argc ) {
+        polybench_dataset = std::string( argv[i] );
+        if ( polybench_dataset != std::string("MINI") &&
+             polybench_dataset != std::string("SMALL") &&
+             polybench_dataset != std::string("MEDIUM") &&
+             polybench_dataset != std::string("LARGE") &&
+             polybench_dataset != std::string("EXTRALARGE") ) {
+          getCout() << "\nBad input:"
+                    << " must give --polybench_dataset value MINI, SMALL,"
+                    << " MEDIUM, LARGE, or EXTRALARGE"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --polybench_dataset a value (string)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
+    } else if ( opt == std::string("--polybench_dims") ) {
+
+      bool got_someting = false;
+      bool done = false;
+      i++;
+      while ( i < argc && !done ) {
+        opt = std::string(argv[i]);
+        if ( opt.at(0) == '-' ) {
+          i--;
+          done = true;
+        } else {
+          got_someting = true;
+          size_t eq = opt.find('=');
+          size_t colon = opt.find(':');
+          if ( colon != std::string::npos && colon > eq ) {
+            colon = std::string::npos;
+          }
+          const size_t dim_begin = ( colon == std::string::npos ? 0 : colon+1 );
+          if ( eq == std::string::npos ||
+               eq == dim_begin ||
+               ::atoi( opt.substr(eq+1).c_str() ) <= 0 ) {
+            getCout() << "\nBad input:"
+                      << " must give --polybench_dims values [KERNEL:]dim=value"
+                      << " with POSITIVE values (int)"
+                      << std::endl;
+            input_state = BadInput;
+          } else {
+            const std::string kernel_name =
+              ( colon == std::string::npos ? std::string() : opt.substr(0, colon) );
+            const std::string dim = opt.substr(dim_begin, eq - dim_begin);
+            if ( !polybench::isPolybenchDim(kernel_name, dim) ) {
+              getCout() << "\nBad input:"
+                        << " --polybench_dims value " << opt << " does not name"
+                        << ( kernel_name.empty() ? " a dimension of a Polybench kernel"
+                                                 : " a Polybench kernel and its dimension" )
+                        << " (e.g. GEMM:ni=100)"
+                        << std::endl;
+              input_state = BadInput;
+            } else {
+              polybench_dims.push_back(opt);
+            }
+          }
+          ++i;
+        }
+      }
+      if (!got_someting) {
+        getCout() << "\nBad input:"
+                  << " must give --polybench_dims one or more values"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
     } else if ( opt == std::string("--pass-fail-tol") ||
                 opt == std::string("-pftol") ) {
 
@@ -360,6 +900,24 @@ void RunParams::parseCommandLineOptions(int argc, char** argv)
         input_state = BadInput;
       }
 
+    } else if ( opt == std::string("--peak_gflops") ) {
+
+      i++;
+      if ( i < argc ) {
+        peak_gflops = ::atof( argv[i] );
+        if ( peak_gflops <= 0.0 ) {
+          getCout() << "\nBad input:"
+                    << " must give --peak_gflops a POSITIVE value (double)"
+                    << std::endl;
+          input_state = BadInput;
+        }
+      } else {
+        getCout() << "\nBad input:"
+                  << " must give --peak_gflops a value (double)"
+                  << std::endl;
+        input_state = BadInput;
+      }
+
     } else if ( opt == std::string("--kernels") ||
                 opt == std::string("-k") ) {
 
@@ -597,11 +1155,156 @@ void RunParams::printHelpMessage(std::ostream& str) const
   str << "\t\t Example...\n"
       << "\t\t --gpu_block_size 128 256 512 (runs kernels with gpu_block_size 128, 256, and 512)\n\n";
 
+  str << "\t --threadpool_threads <int> [default is 0]\n"
+      << "\t      (num threads used by ThreadPool variants, including main thread)\n"
+      << "\t      (0 means use hardware concurrency)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --threadpool_threads 16 (run ThreadPool variants with 16 threads)\n\n";
+
+  str << "\t --omp_schedule <space-separated strings> [no default]\n"
+      << "\t      (OpenMP loop schedules to run as tunings of OpenMP kernels supporting them)\n"
+      << "\t      (valid values are static, dynamic, and guided)\n"
+      << "\t      (the default tuning, with no schedule clause, is always run)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --omp_schedule dynamic guided (adds dynamic and guided schedule tunings)\n\n";
+
+  str << "\t --omp_chunk_size <space-separated ints> [no default]\n"
+      << "\t      (chunk sizes to run with each OpenMP schedule tuning)\n"
+      << "\t      (if no --omp_schedule is given, static, dynamic, and guided are all run)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --omp_schedule dynamic --omp_chunk_size 16 256 (adds tunings dynamic_16 and dynamic_256)\n\n";
+
+  str << "\t --indexlist_selectivity <double> [default is 0.5]\n"
+      << "\t      (fraction of entries selected by INDEXLIST and INDEXLIST_3LOOP)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --indexlist_selectivity 0.01 (select 1% of entries)\n\n";
+
+  str << "\t --indexlist_pattern <string> [default is uniform]\n"
+      << "\t      (placement of entries selected by INDEXLIST and INDEXLIST_3LOOP)\n"
+      << "\t      (uniform: each entry selected at random, clustered: one run of\n"
+      << "\t       selected entries at the start of each block of 1024 entries)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --indexlist_pattern clustered\n\n";
+
+  str << "\t --if_quad_complex_fraction <double> [no default]\n"
+      << "\t      (fraction of IF_QUAD entries with a negative discriminant)\n"
+      << "\t      (if not given, IF_QUAD uses its default data)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --if_quad_complex_fraction 0.1 (10% of entries take the complex roots branch)\n\n";
+
+  str << "\t --if_quad_pattern <string> [default is uniform]\n"
+      << "\t      (placement of IF_QUAD entries with a negative discriminant)\n"
+      << "\t      (uniform: each entry chosen at random, clustered: one run of\n"
+      << "\t       entries at the start of each block of 1024 entries)\n"
+      << "\t      (without --if_quad_complex_fraction, applies to the default data)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --if_quad_complex_fraction 0.5 --if_quad_pattern clustered\n\n";
+
+  str << "\t --indirect_index_pattern <string> [default is random]\n"
+      << "\t      (indices used by GATHER, SCATTER, and SCATTER_ADD)\n"
+      << "\t      (identity: idx[i] = i, strided: stride 16 permutation,\n"
+      << "\t       blocked_random: blocks of 64 indices in random order,\n"
+      << "\t       random: random permutation, zipf: repeated indices from\n"
+      << "\t       a Zipf distribution, most uses go to a small hot set)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --indirect_index_pattern blocked_random\n\n";
+
+  str << "\t --spmv_stencil <int> [default is 7]\n"
+      << "\t      (7 or 27 point 3D Laplacian matrix used by SPMV)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --spmv_stencil 27\n\n";
+
+  str << "\t --spmv_ordering <string> [default is natural]\n"
+      << "\t      (row ordering of the SPMV matrix, natural grid ordering or\n"
+      << "\t       a random symmetric permutation of it)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --spmv_ordering random\n\n";
+
+  str << "\t --histogram_bins <int> [default is 1024]\n"
+      << "\t      (number of bins in HISTOGRAM, e.g., 16 to 1048576)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --histogram_bins 65536\n\n";
+
+  str << "\t --histogram_distribution <string> [default is uniform]\n"
+      << "\t      (distribution of the HISTOGRAM samples over the bins,\n"
+      << "\t       uniform, normal: bell curve around the middle bin, or\n"
+      << "\t       zipf: bin b has probability about 1/(b+1))\n";
+  str << "\t\t Example...\n"
+      << "\t\t --histogram_distribution zipf\n\n";
+
+  str << "\t --tridiag_system_size <int> [default is 64]\n"
+      << "\t      (number of equations in each TRIDIAG_BATCH system, the\n"
+      << "\t       number of systems is the problem size divided by this)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --tridiag_system_size 1024\n\n";
+
+  str << "\t --first_min_loc <double> [default is 0.5]\n"
+      << "\t      (position of the first minimum in FIRST_MIN as a fraction\n"
+      << "\t       of the problem size)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --first_min_loc 0.99 (minimum near the end)\n\n";
+
+  str << "\t --first_min_ties <int> [default is 1]\n"
+      << "\t      (number of elements equal to the minimum in FIRST_MIN,\n"
+      << "\t       spread evenly from the first minimum to the end; values\n"
+      << "\t       above 1 skip the variants that do not break ties on\n"
+      << "\t       location)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --first_min_ties 100\n\n";
+
+  str << "\t --fusion_chain <space-separated strings> [default is HYDRO_1D FIRST_DIFF EOS]\n"
+      << "\t      (Lcals kernel bodies run in order by FUSION_CHAIN, each reading\n"
+      << "\t       the array the one before it writes; valid values are\n"
+      << "\t       HYDRO_1D, FIRST_DIFF, and EOS, and may repeat)\n";
+  str << "\t\t Examples...\n"
+      << "\t\t --fusion_chain FIRST_DIFF FIRST_DIFF FIRST_DIFF\n"
+      << "\t\t --fusion_chain EOS HYDRO_1D\n\n";
+
+  str << "\t --precision <space-separated strings> [default is fp64]\n"
+      << "\t      (precisions to run kernels that have precision tunings in;\n"
+      << "\t       fp64 is the default tuning and always run, fp32 and mixed\n"
+      << "\t       add 'fp32' tunings, with fp32 data and arithmetic, and\n"
+      << "\t       'mixed' tunings, with fp32 data and fp64 arithmetic and\n"
+      << "\t       accumulation)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --precision fp64 fp32 mixed\n\n";
+
+  str << "\t --index_type <space-separated strings> [default is int64]\n"
+      << "\t      (loop index types to run kernels that have index type\n"
+      << "\t       tunings with; int64 is the default tuning and always run,\n"
+      << "\t       int32 adds 'int32' tunings, with 32-bit loop indices and\n"
+      << "\t       index lists)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --index_type int64 int32\n\n";
+
+  str << "\t --polybench_dataset <string> [default is none]\n"
+      << "\t      (Polybench dataset preset MINI, SMALL, MEDIUM, LARGE, or\n"
+      << "\t       EXTRALARGE giving the dimensions of the Polybench kernels;\n"
+      << "\t       without it the dimensions follow the problem size)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --polybench_dataset LARGE\n\n";
+
+  str << "\t --polybench_dims <space-separated strings> [default is none]\n"
+      << "\t      ([KERNEL:]dim=value dimensions of the Polybench kernels,\n"
+      << "\t       e.g. ni, nj, nk, nl, nm, nx, ny, n, or tsteps; these override\n"
+      << "\t       the dataset preset, and KERNEL:dim=value overrides dim=value\n"
+      << "\t       for that kernel)\n";
+  str << "\t\t Examples...\n"
+      << "\t\t --polybench_dims ni=4000 nj=64 nk=4000\n"
+      << "\t\t --polybench_dims GEMM:nj=64 tsteps=10\n\n";
+
   str << "\t --pass-fail-tol, -pftol <double> [default is 0.1; i.e., 10%]\n"
       << "\t      (slowdown tolerance for RAJA vs. Base variants in FOM report)\n";
   str << "\t\t Example...\n"
       << "\t\t -pftol 0.2 (RAJA kernel variants that run 20% or more slower than Base variants will be reported as OVER_TOL in FOM report)\n\n";
 
+  str << "\t --peak_gflops <double> [no default]\n"
+      << "\t      (peak FLOP rate of the machine in GFLOP/s, e.g., cores * FMA units *\n"
+      << "\t       2 * SIMD width * clock in GHz; adds a report of the fraction of peak\n"
+      << "\t       reached by each kernel variant tuning)\n";
+  str << "\t\t Example...\n"
+      << "\t\t --peak_gflops 3072\n\n";
+
   str << "\t --kernels, -k <space-separated strings> [Default is run all]\n"
       << "\t      (names of individual kernels and/or groups of kernels to run)\n";
   str << "\t\t Examples...\n"
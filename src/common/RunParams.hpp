@@ -136,8 +136,56 @@ public:
     return false;
   }
 
+  int getNumThreadPoolThreads() const { return threadpool_threads; }
+
+  std::vector<std::string> const& getOpenMPSchedules() const
+  { return omp_schedules; }
+  std::vector<size_t> const& getOpenMPChunkSizes() const
+  { return omp_chunk_sizes; }
+
+  double getIndexListSelectivity() const { return indexlist_selectivity; }
+  bool getIndexListClustered() const
+  { return indexlist_pattern == std::string("clustered"); }
+
+  double getIfQuadComplexFraction() const { return if_quad_complex_fraction; }
+  bool getIfQuadClustered() const
+  { return if_quad_pattern == std::string("clustered"); }
+
+  const std::string& getIndirectIndexPattern() const
+  { return indirect_index_pattern; }
+
+  int getSpMVStencil() const { return spmv_stencil; }
+  bool getSpMVRandomOrdering() const
+  { return spmv_ordering == std::string("random"); }
+
+  int getHistogramBins() const { return histogram_bins; }
+  const std::string& getHistogramDistribution() const
+  { return histogram_distribution; }
+
+  int getTridiagSystemSize() const { return tridiag_system_size; }
+
+  double getFirstMinLoc() const { return first_min_loc; }
+  int getFirstMinTies() const { return first_min_ties; }
+
+  std::vector<std::string> const& getFusionChain() const
+  { return fusion_chain; }
+
+  std::vector<std::string> const& getPrecisions() const
+  { return precisions; }
+
+  std::vector<std::string> const& getIndexTypes() const
+  { return index_types; }
+
+  const std::string& getPolybenchDataset() const
+  { return polybench_dataset; }
+
+  std::vector<std::string> const& getPolybenchDims() const
+  { return polybench_dims; }
+
   double getPFTolerance() const { return pf_tol; }
 
+  double getPeakGFLOPs() const { return peak_gflops; }
+
   int getCheckRunReps() const { return checkrun_reps; }
 
   const std::string& getReferenceVariant() const { return reference_variant; }
@@ -233,10 +281,40 @@ private:
   double size;           /*!< kernel size to run (input option) */
   double size_factor;    /*!< default kernel size multipier (input option) */
   std::vector<size_t> gpu_block_sizes; /*!< Block sizes for gpu tunings to run (input option) */
+  int threadpool_threads; /*!< Num threads in pool for ThreadPool variants,
+                               0 -> hardware concurrency (input option) */
+  std::vector<std::string> omp_schedules; /*!< Schedules for OpenMP tunings to run (input option) */
+  std::vector<size_t> omp_chunk_sizes; /*!< Chunk sizes for OpenMP tunings to run (input option) */
+  double indexlist_selectivity; /*!< fraction of entries selected by INDEXLIST kernels (input option) */
+  std::string indexlist_pattern; /*!< uniform or clustered selected entries in INDEXLIST kernels (input option) */
+  double if_quad_complex_fraction; /*!< fraction of IF_QUAD entries with complex roots,
+                                        < 0 -> default data (input option) */
+  std::string if_quad_pattern; /*!< uniform or clustered complex roots in IF_QUAD (input option) */
+  std::string indirect_index_pattern; /*!< index pattern of GATHER and SCATTER kernels (input option) */
+  int spmv_stencil; /*!< 7 or 27 point Laplacian matrix in SPMV (input option) */
+  std::string spmv_ordering; /*!< natural or random row ordering in SPMV (input option) */
+  int histogram_bins; /*!< number of bins in HISTOGRAM (input option) */
+  std::string histogram_distribution; /*!< distribution of HISTOGRAM samples (input option) */
+  int tridiag_system_size; /*!< equations per system in TRIDIAG_BATCH (input option) */
+  double first_min_loc; /*!< position of the minimum in FIRST_MIN as a fraction of the problem size (input option) */
+  int first_min_ties; /*!< number of elements equal to the minimum in FIRST_MIN (input option) */
+  std::vector<std::string> fusion_chain; /*!< Lcals kernel bodies run in order by FUSION_CHAIN,
+                                              empty -> default chain (input option) */
+  std::vector<std::string> precisions; /*!< Precisions for precision tunings to run,
+                                            fp64 is the default tuning (input option) */
+  std::vector<std::string> index_types; /*!< Loop index types for index type tunings to run,
+                                             int64 is the default tuning (input option) */
+  std::string polybench_dataset; /*!< Polybench dataset preset of the Polybench kernels,
+                                      empty -> dimensions from problem size (input option) */
+  std::vector<std::string> polybench_dims; /*!< [KERNEL:]dim=value dimensions of the
+                                                Polybench kernels (input option) */
 
   double pf_tol;         /*!< pct RAJA variant run time can exceed base for
                               each PM case to pass/fail acceptance */
 
+  double peak_gflops;    /*!< peak FLOP rate of the machine for the FLOP
+                              rate report, 0 -> not given (input option) */
+
   int checkrun_reps;     /*!< Num reps each kernel is run in check run */
 
   std::string reference_variant;   /*!< Name of reference variant for speedup
@@ -0,0 +1,45 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Definitions used by the SIMD kernel variants.
+///
+/// Base_SIMD variants mark their innermost loops with
+///
+///   #pragma omp simd simdlen(RAJAPERF_SIMD_WIDTH)
+///
+/// so the compiler must vectorize them (or report why not) instead of
+/// leaving it to the auto-vectorizer. RAJA_SIMD variants use
+/// RAJA::simd_exec for the same loops.
+///
+/// The vector register size in bytes is set by the build via
+/// RAJA_PERFSUITE_SIMD_ISA; otherwise it is taken from the instruction
+/// set the compiler is targeting.
+///
+
+#ifndef RAJAPerf_SIMDUtils_HPP
+#define RAJAPerf_SIMDUtils_HPP
+
+#include "RPTypes.hpp"
+
+#if !defined(RAJAPERF_SIMD_BYTES)
+#if defined(__AVX512F__)
+#define RAJAPERF_SIMD_BYTES 64
+#elif defined(__AVX__)
+#define RAJAPERF_SIMD_BYTES 32
+#else
+#define RAJAPERF_SIMD_BYTES 16
+#endif
+#endif
+
+///
+/// Number of Real_type values in a vector register.
+///
+#define RAJAPERF_SIMD_WIDTH (RAJAPERF_SIMD_BYTES / sizeof(rajaperf::Real_type))
+
+#endif  // closing endif for header file include guard
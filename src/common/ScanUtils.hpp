@@ -0,0 +1,142 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Macros for the parallel scan tunings of first order linear recurrences
+///
+///   x_i = a_i * x_{i-1} + b_i,  i in [ibegin, iend), x_{ibegin-1} given.
+///
+/// Composing the affine maps x -> a_i * x + b_i is associative, so the
+/// recurrence is a scan. The iterations are split into blocks of a fixed
+/// number of iterations; c is the block index.
+///
+///   1. Each block composes the maps of its iterations into (p, q), in
+///      parallel over blocks (AFFINE_SCAN_REDUCE_BODY). The 'simd' form
+///      also keeps the composition up to each iteration in scan_p and
+///      scan_q (AFFINE_SCAN_PREFIX_BODY).
+///   2. A serial pass over the blocks gives the value before each block
+///      in block_x (AFFINE_SCAN_BLOCKS).
+///   3. In parallel over blocks, either rerun the recurrence from that
+///      value (AFFINE_SCAN_RECOMPUTE_BODY) or, in the 'simd' form, compute
+///      each value directly from it, with no dependence between iterations
+///      so the block loop vectorizes (AFFINE_SCAN_APPLY_BODY).
+///
+/// Kernels provide three macros in terms of the iteration i, the previous
+/// value xold and the new value xnew:
+///   coefs -- define 'const Real_type a' and 'const Real_type b'
+///   step  -- define 'const Real_type xnew' from xold exactly as the
+///            serial kernel does, so the recompute form matches it
+///   store -- write the outputs of iteration i
+///
+
+#ifndef RAJAPerf_ScanUtils_HPP
+#define RAJAPerf_ScanUtils_HPP
+
+#include "RPTypes.hpp"
+
+#include <vector>
+
+namespace rajaperf
+{
+
+namespace affine_scan
+{
+
+/*!
+ * \brief Number of iterations in each block of the scan.
+ */
+constexpr Index_type block_size = 4096;
+
+inline Index_type getNumBlocks(Index_type len)
+{
+  return (len + block_size - 1) / block_size;
+}
+
+/*!
+ * \brief Bytes the 'simd' form moves through scan_p and scan_q for a scan
+ *        of len iterations, each written once and read once.
+ */
+inline Index_type getSimdScratchBytes(Index_type len)
+{
+  return (2*sizeof(Real_type) + 2*sizeof(Real_type)) * len;
+}
+
+} // closing brace for affine_scan namespace
+
+} // closing brace for rajaperf namespace
+
+#define AFFINE_SCAN_DATA_SETUP \
+  const Index_type nblocks = affine_scan::getNumBlocks(iend - ibegin); \
+  std::vector<Real_type> block_data(3*nblocks + 1); \
+  Real_ptr block_p = block_data.data(); \
+  Real_ptr block_q = block_p + nblocks; \
+  Real_ptr block_x = block_q + nblocks;
+
+#define AFFINE_SCAN_SIMD_DATA_SETUP \
+  AFFINE_SCAN_DATA_SETUP; \
+  std::vector<Real_type> scan_data(2*(iend - ibegin)); \
+  Real_ptr scan_p = scan_data.data(); \
+  Real_ptr scan_q = scan_p + (iend - ibegin);
+
+#define AFFINE_SCAN_BLOCK_RANGE \
+  const Index_type bbegin = ibegin + c * affine_scan::block_size; \
+  const Index_type bend = RAJA_MIN(bbegin + affine_scan::block_size, iend);
+
+#define AFFINE_SCAN_REDUCE_BODY(coefs) \
+  AFFINE_SCAN_BLOCK_RANGE; \
+  Real_type p = 1.0; \
+  Real_type q = 0.0; \
+  for (Index_type i = bbegin; i < bend; ++i ) { \
+    coefs; \
+    p = a * p; \
+    q = a * q + b; \
+  } \
+  block_p[c] = p; \
+  block_q[c] = q;
+
+#define AFFINE_SCAN_PREFIX_BODY(coefs) \
+  AFFINE_SCAN_BLOCK_RANGE; \
+  Real_type p = 1.0; \
+  Real_type q = 0.0; \
+  for (Index_type i = bbegin; i < bend; ++i ) { \
+    coefs; \
+    p = a * p; \
+    q = a * q + b; \
+    scan_p[i - ibegin] = p; \
+    scan_q[i - ibegin] = q; \
+  } \
+  block_p[c] = p; \
+  block_q[c] = q;
+
+// block_x[nblocks] is the value after the last iteration
+#define AFFINE_SCAN_BLOCKS(x0) \
+  block_x[0] = (x0); \
+  for (Index_type c = 0; c < nblocks; ++c ) { \
+    block_x[c+1] = block_p[c] * block_x[c] + block_q[c]; \
+  }
+
+#define AFFINE_SCAN_RECOMPUTE_BODY(step, store) \
+  AFFINE_SCAN_BLOCK_RANGE; \
+  Real_type xprev = block_x[c]; \
+  for (Index_type i = bbegin; i < bend; ++i ) { \
+    const Real_type xold = xprev; \
+    step; \
+    store; \
+    xprev = xnew; \
+  }
+
+// the body of a loop over i in [bbegin, bend) with xs = block_x[c]
+#define AFFINE_SCAN_APPLY_BODY(store) \
+  const Real_type xold = (i == bbegin) ? xs \
+                      : scan_p[i-1 - ibegin] * xs + scan_q[i-1 - ibegin]; \
+  const Real_type xnew = scan_p[i - ibegin] * xs + scan_q[i - ibegin]; \
+  store; \
+  (void) xold; \
+  (void) xnew;
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,96 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Helpers used by the StdPar kernel variants, which are written with
+/// C++17 parallel algorithms and std::execution::par_unseq.
+///
+/// C++17 has no iterator over a range of integers, so loops over an index
+/// range are expressed with a counting_iterator, e.g.,
+///
+///   std::for_each( std::execution::par_unseq,
+///                  stdpar::counting_iterator(ibegin),
+///                  stdpar::counting_iterator(iend),
+///                  [=](Index_type i) { ... } );
+///
+
+#ifndef RAJAPerf_StdParUtils_HPP
+#define RAJAPerf_StdParUtils_HPP
+
+#if defined(RUN_STDPAR)
+
+#include "RPTypes.hpp"
+
+#include <algorithm>
+#include <execution>
+#include <iterator>
+#include <numeric>
+
+namespace rajaperf
+{
+namespace stdpar
+{
+
+/*!
+ * \brief Random access iterator whose value is its position.
+ */
+class counting_iterator
+{
+public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = Index_type;
+  using difference_type = Index_type;
+  using pointer = const Index_type*;
+  using reference = Index_type;
+
+  counting_iterator() : m_val(0) { }
+  explicit counting_iterator(Index_type val) : m_val(val) { }
+
+  reference operator*() const { return m_val; }
+  reference operator[](difference_type n) const { return m_val + n; }
+
+  counting_iterator& operator++() { ++m_val; return *this; }
+  counting_iterator operator++(int) { counting_iterator t(*this); ++m_val; return t; }
+  counting_iterator& operator--() { --m_val; return *this; }
+  counting_iterator operator--(int) { counting_iterator t(*this); --m_val; return t; }
+
+  counting_iterator& operator+=(difference_type n) { m_val += n; return *this; }
+  counting_iterator& operator-=(difference_type n) { m_val -= n; return *this; }
+
+  friend counting_iterator operator+(counting_iterator it, difference_type n)
+  { return counting_iterator(it.m_val + n); }
+  friend counting_iterator operator+(difference_type n, counting_iterator it)
+  { return counting_iterator(it.m_val + n); }
+  friend counting_iterator operator-(counting_iterator it, difference_type n)
+  { return counting_iterator(it.m_val - n); }
+  friend difference_type operator-(counting_iterator a, counting_iterator b)
+  { return a.m_val - b.m_val; }
+
+  friend bool operator==(counting_iterator a, counting_iterator b)
+  { return a.m_val == b.m_val; }
+  friend bool operator!=(counting_iterator a, counting_iterator b)
+  { return a.m_val != b.m_val; }
+  friend bool operator<(counting_iterator a, counting_iterator b)
+  { return a.m_val < b.m_val; }
+  friend bool operator>(counting_iterator a, counting_iterator b)
+  { return a.m_val > b.m_val; }
+  friend bool operator<=(counting_iterator a, counting_iterator b)
+  { return a.m_val <= b.m_val; }
+  friend bool operator>=(counting_iterator a, counting_iterator b)
+  { return a.m_val >= b.m_val; }
+
+private:
+  Index_type m_val;
+};
+
+} // closing brace for stdpar namespace
+} // closing brace for rajaperf namespace
+
+#endif  // RUN_STDPAR
+
+#endif  // closing endif for header file include guard
@@ -0,0 +1,259 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "ThreadPool.hpp"
+
+#if defined(RUN_THREADPOOL)
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace rajaperf
+{
+namespace threadpool
+{
+
+namespace
+{
+
+//
+// Number of times an idle worker polls for new work before it sleeps.
+//
+constexpr int idle_spin_count = 4096;
+
+//
+// True on pool threads and on a caller while it runs chunks; nested
+// parallel calls made from a chunk body run serially.
+//
+thread_local bool in_parallel_region = false;
+
+//
+// Block of chunks owned by one thread: [lo, hi). The owner takes chunks
+// from the front; thieves take chunks from the back. The function and
+// context are stored with the block so that a chunk is always paired with
+// the loop it belongs to.
+//
+struct WorkQueue
+{
+  std::mutex mtx;
+  size_t lo = 0;
+  size_t hi = 0;
+  ChunkFn fn = nullptr;
+  const void* ctx = nullptr;
+  char pad[64];  // keep queues of different threads on different lines
+};
+
+class Pool
+{
+public:
+  explicit Pool(int nthreads);
+  ~Pool();
+
+  int numThreads() const { return m_nthreads; }
+
+  void run(size_t nchunks, ChunkFn fn, const void* ctx);
+
+private:
+  bool popFront(int tid, ChunkFn& fn, const void*& ctx, size_t& c);
+  bool stealBack(int tid, ChunkFn& fn, const void*& ctx, size_t& c);
+  void drain(int tid);
+  void workerLoop(int tid);
+
+  int m_nthreads;
+  std::unique_ptr<WorkQueue[]> m_queues;
+  std::vector<std::thread> m_workers;
+
+  std::atomic<size_t> m_remaining;
+  std::atomic<unsigned long> m_epoch;
+
+  std::mutex m_wake_mtx;
+  std::condition_variable m_wake_cv;
+  std::atomic<bool> m_stop;
+};
+
+Pool::Pool(int nthreads)
+  : m_nthreads(nthreads > 0 ? nthreads : 1),
+    m_queues(new WorkQueue[m_nthreads]),
+    m_workers(),
+    m_remaining(0),
+    m_epoch(0),
+    m_stop(false)
+{
+  for (int tid = 1; tid < m_nthreads; ++tid) {
+    m_workers.emplace_back(&Pool::workerLoop, this, tid);
+  }
+}
+
+Pool::~Pool()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_wake_mtx);
+    m_stop.store(true, std::memory_order_release);
+    m_epoch.fetch_add(1, std::memory_order_release);
+  }
+  m_wake_cv.notify_all();
+  for (std::thread& worker : m_workers) {
+    worker.join();
+  }
+}
+
+bool Pool::popFront(int tid, ChunkFn& fn, const void*& ctx, size_t& c)
+{
+  WorkQueue& q = m_queues[tid];
+  std::lock_guard<std::mutex> lock(q.mtx);
+  if ( q.lo < q.hi ) {
+    fn = q.fn;
+    ctx = q.ctx;
+    c = q.lo++;
+    return true;
+  }
+  return false;
+}
+
+bool Pool::stealBack(int tid, ChunkFn& fn, const void*& ctx, size_t& c)
+{
+  for (int v = 1; v < m_nthreads; ++v) {
+    WorkQueue& q = m_queues[(tid + v) % m_nthreads];
+    std::lock_guard<std::mutex> lock(q.mtx);
+    if ( q.lo < q.hi ) {
+      fn = q.fn;
+      ctx = q.ctx;
+      c = --q.hi;
+      return true;
+    }
+  }
+  return false;
+}
+
+void Pool::drain(int tid)
+{
+  ChunkFn fn = nullptr;
+  const void* ctx = nullptr;
+  size_t c = 0;
+  while ( popFront(tid, fn, ctx, c) || stealBack(tid, fn, ctx, c) ) {
+    fn(ctx, c);
+    m_remaining.fetch_sub(1, std::memory_order_acq_rel);
+  }
+}
+
+void Pool::workerLoop(int tid)
+{
+  in_parallel_region = true;
+
+  unsigned long seen = 0;
+  for (;;) {
+
+    unsigned long epoch = m_epoch.load(std::memory_order_acquire);
+    for (int spin = 0; epoch == seen && spin < idle_spin_count; ++spin) {
+      std::this_thread::yield();
+      epoch = m_epoch.load(std::memory_order_acquire);
+    }
+
+    if ( epoch == seen ) {
+      std::unique_lock<std::mutex> lock(m_wake_mtx);
+      m_wake_cv.wait(lock, [&]() {
+        return m_stop.load(std::memory_order_acquire) ||
+               m_epoch.load(std::memory_order_acquire) != seen;
+      });
+      epoch = m_epoch.load(std::memory_order_acquire);
+    }
+
+    if ( m_stop.load(std::memory_order_acquire) ) return;
+
+    seen = epoch;
+    drain(tid);
+  }
+}
+
+void Pool::run(size_t nchunks, ChunkFn fn, const void* ctx)
+{
+  if ( nchunks == 0 ) return;
+
+  if ( m_nthreads == 1 || nchunks == 1 || in_parallel_region ) {
+    for (size_t c = 0; c < nchunks; ++c) {
+      fn(ctx, c);
+    }
+    return;
+  }
+
+  m_remaining.store(nchunks, std::memory_order_relaxed);
+
+  const size_t nthreads = static_cast<size_t>(m_nthreads);
+  for (size_t tid = 0; tid < nthreads; ++tid) {
+    WorkQueue& q = m_queues[tid];
+    std::lock_guard<std::mutex> lock(q.mtx);
+    q.lo = (nchunks * tid) / nthreads;
+    q.hi = (nchunks * (tid + 1)) / nthreads;
+    q.fn = fn;
+    q.ctx = ctx;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_wake_mtx);
+    m_epoch.fetch_add(1, std::memory_order_release);
+  }
+  m_wake_cv.notify_all();
+
+  in_parallel_region = true;
+  drain(0);
+  in_parallel_region = false;
+
+  while ( m_remaining.load(std::memory_order_acquire) != 0 ) {
+    std::this_thread::yield();
+  }
+}
+
+std::unique_ptr<Pool> s_pool;
+
+Pool& getPool()
+{
+  if ( !s_pool ) {
+    initialize(0);
+  }
+  return *s_pool;
+}
+
+} // closing brace for anonymous namespace
+
+
+void initialize(int nthreads)
+{
+  if ( nthreads <= 0 ) {
+    nthreads = static_cast<int>(std::thread::hardware_concurrency());
+  }
+  s_pool.reset();
+  s_pool.reset(new Pool(nthreads));
+}
+
+void finalize()
+{
+  s_pool.reset();
+}
+
+int getNumThreads()
+{
+  return getPool().numThreads();
+}
+
+namespace detail
+{
+
+void run(size_t nchunks, ChunkFn fn, const void* ctx)
+{
+  getPool().run(nchunks, fn, ctx);
+}
+
+} // closing brace for detail namespace
+
+} // closing brace for threadpool namespace
+} // closing brace for rajaperf namespace
+
+#endif  // RUN_THREADPOOL
@@ -0,0 +1,229 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// Work-stealing std::thread pool and chunked parallel loop methods used
+/// by the ThreadPool kernel variants.
+///
+/// An iteration range is split into contiguous chunks. Each thread in the
+/// pool (including the calling thread) is handed a contiguous block of
+/// chunks and, once it has run out of its own work, steals chunks from the
+/// back of other threads' blocks. Calls block until all chunks have run.
+///
+/// Reductions and scans combine per-chunk partial results in chunk order,
+/// so results do not depend on which thread ran which chunk.
+///
+/// Calls made from inside a chunk body run serially on the calling thread.
+///
+
+#ifndef RAJAPerf_ThreadPool_HPP
+#define RAJAPerf_ThreadPool_HPP
+
+#include "RPTypes.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+namespace rajaperf
+{
+namespace threadpool
+{
+
+/*!
+ * \brief Create the pool with given number of threads (including the
+ *        calling thread); nthreads <= 0 means use hardware concurrency.
+ *
+ * Replaces an existing pool. If not called, the pool is created with the
+ * default number of threads the first time it is used.
+ */
+void initialize(int nthreads);
+
+/*!
+ * \brief Join pool threads and destroy the pool.
+ */
+void finalize();
+
+/*!
+ * \brief Return number of threads in the pool (including calling thread).
+ */
+int getNumThreads();
+
+/*!
+ * \brief Type of type-erased function that runs one chunk of a loop.
+ */
+using ChunkFn = void (*)(const void* ctx, size_t chunk);
+
+namespace detail
+{
+
+/*!
+ * \brief Run fn(ctx, c) for each c in [0, nchunks) on the pool and
+ *        return when all chunks are done.
+ */
+void run(size_t nchunks, ChunkFn fn, const void* ctx);
+
+/*!
+ * \brief Partition of [begin, end) into nchunks contiguous chunks.
+ *
+ * Default is 4 chunks per pool thread so that stealing can balance
+ * uneven chunk run times.
+ */
+struct Chunking
+{
+  Chunking(Index_type begin_, Index_type end_)
+    : begin(begin_), end(end_), chunk_size(1), nchunks(0)
+  {
+    const Index_type len = end - begin;
+    if ( len > 0 ) {
+      const Index_type target = 4 * static_cast<Index_type>(getNumThreads());
+      chunk_size = (len + target - 1) / target;
+      nchunks = static_cast<size_t>((len + chunk_size - 1) / chunk_size);
+    }
+  }
+
+  Index_type chunkBegin(size_t c) const
+  { return begin + static_cast<Index_type>(c) * chunk_size; }
+  Index_type chunkEnd(size_t c) const
+  {
+    const Index_type e = chunkBegin(c) + chunk_size;
+    return e < end ? e : end;
+  }
+
+  Index_type begin;
+  Index_type end;
+  Index_type chunk_size;
+  size_t nchunks;
+};
+
+} // closing brace for detail namespace
+
+
+/*!
+ * \brief Call body(cbegin, cend) on each chunk of [begin, end).
+ */
+template < typename Body >
+inline void parallel_for(Index_type begin, Index_type end, Body&& body)
+{
+  using body_type = typename std::remove_reference<Body>::type;
+  struct Context {
+    const detail::Chunking* chunks;
+    body_type* body;
+  };
+
+  const detail::Chunking chunks(begin, end);
+  const Context ctx{&chunks, &body};
+
+  detail::run(chunks.nchunks, [](const void* vctx, size_t c) {
+    const Context* ctx = static_cast<const Context*>(vctx);
+    (*ctx->body)(ctx->chunks->chunkBegin(c), ctx->chunks->chunkEnd(c));
+  }, &ctx);
+}
+
+/*!
+ * \brief Call body(i) for each i in [begin, end).
+ */
+template < typename Body >
+inline void forall(Index_type begin, Index_type end, Body&& body)
+{
+  parallel_for(begin, end, [&](Index_type cbegin, Index_type cend) {
+    for (Index_type i = cbegin; i < cend; ++i) {
+      body(i);
+    }
+  });
+}
+
+/*!
+ * \brief Reduce over [begin, end) and return result.
+ *
+ * body(cbegin, cend, val) accumulates a chunk into val, which starts each
+ * chunk equal to identity. Chunk results are combined in chunk order
+ * with combine(lhs, rhs), e.g., std::plus<T>(), starting from identity.
+ */
+template < typename T, typename Body, typename Combine >
+inline T parallel_reduce(Index_type begin, Index_type end, T identity,
+                         Body&& body, Combine&& combine)
+{
+  using body_type = typename std::remove_reference<Body>::type;
+  struct Context {
+    const detail::Chunking* chunks;
+    body_type* body;
+    const T* identity;
+    T* partials;
+  };
+
+  const detail::Chunking chunks(begin, end);
+  std::vector<T> partials(chunks.nchunks, identity);
+  const Context ctx{&chunks, &body, &identity, partials.data()};
+
+  detail::run(chunks.nchunks, [](const void* vctx, size_t c) {
+    const Context* ctx = static_cast<const Context*>(vctx);
+    T val = *ctx->identity;
+    (*ctx->body)(ctx->chunks->chunkBegin(c), ctx->chunks->chunkEnd(c), val);
+    ctx->partials[c] = val;
+  }, &ctx);
+
+  T result = identity;
+  for (size_t c = 0; c < chunks.nchunks; ++c) {
+    result = combine(result, partials[c]);
+  }
+  return result;
+}
+
+/*!
+ * \brief Two-pass exclusive scan over [begin, end); return total.
+ *
+ * reduce(cbegin, cend) returns the total of a chunk. Chunk totals are
+ * exclusive-scanned in chunk order with combine, starting from identity,
+ * then scan(cbegin, cend, prefix) is called on each chunk with the
+ * combined total of all preceding chunks.
+ */
+template < typename T, typename Reduce, typename Scan, typename Combine >
+inline T parallel_scan(Index_type begin, Index_type end, T identity,
+                       Reduce&& reduce, Scan&& scan, Combine&& combine)
+{
+  using reduce_type = typename std::remove_reference<Reduce>::type;
+  using scan_type = typename std::remove_reference<Scan>::type;
+  struct Context {
+    const detail::Chunking* chunks;
+    reduce_type* reduce;
+    scan_type* scan;
+    T* partials;
+  };
+
+  const detail::Chunking chunks(begin, end);
+  std::vector<T> partials(chunks.nchunks, identity);
+  const Context ctx{&chunks, &reduce, &scan, partials.data()};
+
+  detail::run(chunks.nchunks, [](const void* vctx, size_t c) {
+    const Context* ctx = static_cast<const Context*>(vctx);
+    ctx->partials[c] =
+      (*ctx->reduce)(ctx->chunks->chunkBegin(c), ctx->chunks->chunkEnd(c));
+  }, &ctx);
+
+  T total = identity;
+  for (size_t c = 0; c < chunks.nchunks; ++c) {
+    const T chunk_total = partials[c];
+    partials[c] = total;
+    total = combine(total, chunk_total);
+  }
+
+  detail::run(chunks.nchunks, [](const void* vctx, size_t c) {
+    const Context* ctx = static_cast<const Context*>(vctx);
+    (*ctx->scan)(ctx->chunks->chunkBegin(c), ctx->chunks->chunkEnd(c),
+                 ctx->partials[c]);
+  }, &ctx);
+
+  return total;
+}
+
+} // closing brace for threadpool namespace
+} // closing brace for rajaperf namespace
+
+#endif  // closing endif for header file include guard
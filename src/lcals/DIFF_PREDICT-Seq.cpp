@@ -18,7 +18,7 @@ namespace lcals
 {
 
 
-void DIFF_PREDICT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DIFF_PREDICT::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -86,5 +86,100 @@ void DIFF_PREDICT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 
 }
 
+template < size_t aosoa_width >
+void DIFF_PREDICT::runSeqVariantAoSoA(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  DIFF_PREDICT_DATA_SETUP;
+  DIFF_PREDICT_AOSOA_DATA_SETUP;
+
+  auto diffpredict_aosoa_lam = [=](Index_type blk) {
+                           DIFF_PREDICT_AOSOA_BODY;
+                         };
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type blk = 0; blk < nblocks; ++blk ) {
+          DIFF_PREDICT_AOSOA_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type blk = 0; blk < nblocks; ++blk ) {
+          diffpredict_aosoa_lam(blk);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nblocks), diffpredict_aosoa_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  DIFF_PREDICT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void DIFF_PREDICT::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runSeqVariantDefault(vid);
+  }
+
+  t += 1;
+
+  seq_for(aosoa_widths_type{}, [&](auto aosoa_width) {
+    if (tune_idx == t) {
+      runSeqVariantAoSoA<aosoa_width>(vid);
+    }
+    t += 1;
+  });
+}
+
+void DIFF_PREDICT::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  seq_for(aosoa_widths_type{}, [&](auto aosoa_width) {
+    addVariantTuningName(vid, getLayoutTuningName(aosoa_width));
+  });
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
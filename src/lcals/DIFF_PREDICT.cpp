@@ -11,6 +11,9 @@
 #include "RAJA/RAJA.hpp"
 
 #include "common/DataUtils.hpp"
+
+#include <vector>
+
 namespace rajaperf
 {
 namespace lcals
@@ -51,24 +54,78 @@ DIFF_PREDICT::DIFF_PREDICT(const RunParams& params)
   setVariantDefined( RAJA_HIP );
 
   setVariantDefined( Kokkos_Lambda );
+
+  setVariantDefined( Base_ThreadPool );
+  setVariantDefined( Lambda_ThreadPool );
+
+  setVariantDefined( Base_StdPar );
+  setVariantDefined( Lambda_StdPar );
+
+  setVariantDefined( Base_SIMD );
+  setVariantDefined( RAJA_SIMD );
 }
 
 DIFF_PREDICT::~DIFF_PREDICT()
 {
 }
 
-void DIFF_PREDICT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+Index_type DIFF_PREDICT::getLayoutWidth(VariantID vid, size_t tune_idx) const
 {
-  m_array_length = getActualProblemSize() * 14;
-  m_offset = getActualProblemSize();
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+
+  // struct of arrays, one block of the whole problem size
+  Index_type width = getActualProblemSize();
+
+  seq_for(aosoa_widths_type{}, [&](auto aosoa_width) {
+    if ( tuning_name == getLayoutTuningName(aosoa_width) ) {
+      width = aosoa_width;
+    }
+  });
+
+  return width;
+}
+
+void DIFF_PREDICT::setUp(VariantID vid, size_t tune_idx)
+{
+  const Index_type len = getActualProblemSize();
+
+  m_offset = len;
+  m_layout_width = getLayoutWidth(vid, tune_idx);
+  m_array_length = 14 * m_layout_width *
+                   ( (len + m_layout_width - 1) / m_layout_width );
 
   allocAndInitDataConst(m_px, m_array_length, 0.0, vid);
-  allocAndInitData(m_cx, m_array_length, vid);
+
+  if ( m_layout_width == len ) {
+    allocAndInitData(m_cx, m_array_length, vid);
+  } else {
+    Real_ptr cx_soa;
+    allocAndInitData(cx_soa, 14 * len, vid);
+    allocAndInitDataConst(m_cx, m_array_length, 0.0, vid);
+    for (Index_type i = 0; i < len; ++i) {
+      for (Index_type k = 0; k < 14; ++k) {
+        m_cx[getLayoutIndex(i, k)] = cx_soa[i + len * k];
+      }
+    }
+    deallocData(cx_soa);
+  }
 }
 
 void DIFF_PREDICT::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_px, m_array_length);
+  const Index_type len = getActualProblemSize();
+
+  if ( m_layout_width == len ) {
+    checksum[vid][tune_idx] += calcChecksum(m_px, m_array_length);
+  } else {
+    std::vector<Real_type> px(14 * len);
+    for (Index_type i = 0; i < len; ++i) {
+      for (Index_type k = 0; k < 14; ++k) {
+        px[i + len * k] = m_px[getLayoutIndex(i, k)];
+      }
+    }
+    checksum[vid][tune_idx] += calcChecksum(px.data(), 14 * len);
+  }
 }
 
 void DIFF_PREDICT::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
@@ -33,6 +33,15 @@
 ///   px[i + offset * 12] = cr;
 /// }
 ///
+/// The 14 planes of px and cx are offset apart, a struct of arrays layout
+/// that reads and writes 11 streams at once. Seq and OpenMP variants have
+/// tunings that store them instead as an array of structs, px[i*14 + k]
+/// ('aos'), or as an array of structs of arrays holding blocks of a SIMD
+/// width of elements ('aosoa_<width>'). Data are generated and checksums
+/// computed in the struct of arrays layout, so the checksums of all
+/// tunings agree; arrays in the AoSoA layout are padded to whole blocks
+/// and the padding is computed on but left out of the checksum.
+///
 
 #ifndef RAJAPerf_Lcals_DIFF_PREDICT_HPP
 #define RAJAPerf_Lcals_DIFF_PREDICT_HPP
@@ -43,28 +52,51 @@
   Real_ptr cx = m_cx; \
   const Index_type offset = m_offset;
 
-#define DIFF_PREDICT_BODY  \
+//
+// Index of plane k of element i in each layout. The AoSoA layout stores
+// blocks of width elements, each block holding its 14 planes one after
+// another; blk_offset is the start of the block and lane is the position
+// of the element in it. With width 1 it is the array of structs layout.
+//
+#define DIFF_PREDICT_SOA_IDX(k)  (i + offset * (k))
+#define DIFF_PREDICT_AOSOA_IDX(k)  (blk_offset + (k) * width + lane)
+
+#define DIFF_PREDICT_BODY_LAYOUT(idx)  \
   Real_type ar, br, cr; \
 \
-  ar                  = cx[i + offset * 4];       \
-  br                  = ar - px[i + offset * 4];  \
-  px[i + offset * 4]  = ar;                       \
-  cr                  = br - px[i + offset * 5];  \
-  px[i + offset * 5]  = br;                       \
-  ar                  = cr - px[i + offset * 6];  \
-  px[i + offset * 6]  = cr;                       \
-  br                  = ar - px[i + offset * 7];  \
-  px[i + offset * 7]  = ar;                       \
-  cr                  = br - px[i + offset * 8];  \
-  px[i + offset * 8]  = br;                       \
-  ar                  = cr - px[i + offset * 9];  \
-  px[i + offset * 9]  = cr;                       \
-  br                  = ar - px[i + offset * 10]; \
-  px[i + offset * 10] = ar;                       \
-  cr                  = br - px[i + offset * 11]; \
-  px[i + offset * 11] = br;                       \
-  px[i + offset * 13] = cr - px[i + offset * 12]; \
-  px[i + offset * 12] = cr;
+  ar            = cx[idx(4)];       \
+  br            = ar - px[idx(4)];  \
+  px[idx(4)]    = ar;               \
+  cr            = br - px[idx(5)];  \
+  px[idx(5)]    = br;               \
+  ar            = cr - px[idx(6)];  \
+  px[idx(6)]    = cr;               \
+  br            = ar - px[idx(7)];  \
+  px[idx(7)]    = ar;               \
+  cr            = br - px[idx(8)];  \
+  px[idx(8)]    = br;               \
+  ar            = cr - px[idx(9)];  \
+  px[idx(9)]    = cr;               \
+  br            = ar - px[idx(10)]; \
+  px[idx(10)]   = ar;               \
+  cr            = br - px[idx(11)]; \
+  px[idx(11)]   = br;               \
+  px[idx(13)]   = cr - px[idx(12)]; \
+  px[idx(12)]   = cr;
+
+#define DIFF_PREDICT_BODY  \
+  DIFF_PREDICT_BODY_LAYOUT(DIFF_PREDICT_SOA_IDX)
+
+// nblocks blocks of width elements cover the offset elements of a plane
+#define DIFF_PREDICT_AOSOA_DATA_SETUP \
+  const Index_type width = aosoa_width; \
+  const Index_type nblocks = (offset + width - 1) / width;
+
+#define DIFF_PREDICT_AOSOA_BODY  \
+  const Index_type blk_offset = blk * 14 * width; \
+  for (Index_type lane = 0; lane < width; ++lane ) { \
+    DIFF_PREDICT_BODY_LAYOUT(DIFF_PREDICT_AOSOA_IDX); \
+  }
 
 
 #include "common/KernelBase.hpp"
@@ -94,6 +126,19 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
+  void runThreadPoolVariant(VariantID vid, size_t tune_idx);
+  void runStdParVariant(VariantID vid, size_t tune_idx);
+  void runSIMDVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  template < size_t aosoa_width >
+  void runSeqVariantAoSoA(VariantID vid);
+
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < size_t aosoa_width >
+  void runOpenMPVariantAoSoA(VariantID vid);
 
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
@@ -106,11 +151,32 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  //
+  // Block widths of the AoSoA layout tunings; a block width of 1 is the
+  // array of structs layout.
+  //
+  using aosoa_widths_type = camp::int_seq<size_t, 1, 4, 8>;
+
+  static std::string getLayoutTuningName(size_t aosoa_width)
+  {
+    return (aosoa_width == 1) ? std::string("aos")
+                              : "aosoa_" + std::to_string(aosoa_width);
+  }
+
+  Index_type getLayoutWidth(VariantID vid, size_t tune_idx) const;
+
+  Index_type getLayoutIndex(Index_type i, Index_type k) const
+  {
+    return (i / m_layout_width) * 14 * m_layout_width +
+           k * m_layout_width + i % m_layout_width;
+  }
+
   Real_ptr m_px;
   Real_ptr m_cx;
 
   Index_type m_array_length;
   Index_type m_offset;
+  Index_type m_layout_width;
 };
 
 } // end namespace lcals
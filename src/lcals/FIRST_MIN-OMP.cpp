@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/SIMDUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -19,7 +21,7 @@ namespace lcals
 
 FIRST_MIN_MINLOC_COMPARE;
 
-void FIRST_MIN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void FIRST_MIN::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -116,5 +118,152 @@ void FIRST_MIN::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_
 #endif
 }
 
+void FIRST_MIN::runOpenMPVariantSIMD(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FIRST_MIN_DATA_SETUP;
+
+  constexpr Index_type simd_width = RAJAPERF_SIMD_WIDTH;
+  const Index_type ivec_end = iend - (iend - ibegin) % simd_width;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        FIRST_MIN_MINLOC_INIT;
+
+        // copied before any thread combines its result into mymin
+        MyMinLoc thread_min = mymin;
+
+        #pragma omp parallel firstprivate(thread_min)
+        {
+          FIRST_MIN_SIMD_LANES_INIT(thread_min);
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = ibegin; i < ivec_end; i += simd_width ) {
+            #pragma omp simd simdlen(RAJAPERF_SIMD_WIDTH)
+            for (Index_type l = 0; l < simd_width; ++l) {
+              FIRST_MIN_SIMD_LANE_BODY(x[i + l]);
+            }
+          }
+
+          FIRST_MIN_SIMD_LANES_COMBINE(thread_min);
+
+          #pragma omp critical
+          {
+            mymin = MinLoc_compare(mymin, thread_min);
+          }
+        }
+
+        for (Index_type i = ivec_end; i < iend; ++i ) {
+          FIRST_MIN_BODY;
+        }
+
+        m_minloc = RAJA_MAX(m_minloc, mymin.loc);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      auto firstmin_base_lam = [=](Index_type i) -> Real_type {
+                                 return x[i];
+                               };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        FIRST_MIN_MINLOC_INIT;
+
+        // copied before any thread combines its result into mymin
+        MyMinLoc thread_min = mymin;
+
+        #pragma omp parallel firstprivate(thread_min)
+        {
+          FIRST_MIN_SIMD_LANES_INIT(thread_min);
+
+          #pragma omp for schedule(static) nowait
+          for (Index_type i = ibegin; i < ivec_end; i += simd_width ) {
+            #pragma omp simd simdlen(RAJAPERF_SIMD_WIDTH)
+            for (Index_type l = 0; l < simd_width; ++l) {
+              FIRST_MIN_SIMD_LANE_BODY(firstmin_base_lam(i + l));
+            }
+          }
+
+          FIRST_MIN_SIMD_LANES_COMBINE(thread_min);
+
+          #pragma omp critical
+          {
+            mymin = MinLoc_compare(mymin, thread_min);
+          }
+        }
+
+        for (Index_type i = ivec_end; i < iend; ++i ) {
+          if ( firstmin_base_lam(i) < mymin.val ) {
+            mymin.val = x[i];
+            mymin.loc = i;
+          }
+        }
+
+        m_minloc = RAJA_MAX(m_minloc, mymin.loc);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FIRST_MIN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void FIRST_MIN::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if ( tune_idx == t ) {
+    runOpenMPVariantDefault(vid);
+  }
+
+  t += 1;
+
+  if ( vid == Base_OpenMP || vid == Lambda_OpenMP ) {
+
+    if ( tune_idx == t ) {
+      runOpenMPVariantSIMD(vid);
+    }
+
+    t += 1;
+
+  }
+}
+
+void FIRST_MIN::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_OpenMP || vid == Lambda_OpenMP ) {
+    addVariantTuningName(vid, "simd");
+  }
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
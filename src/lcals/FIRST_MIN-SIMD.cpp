@@ -0,0 +1,101 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FIRST_MIN.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/SIMDUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+void FIRST_MIN::runSIMDVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+#if defined(RUN_SIMD)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FIRST_MIN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_SIMD : {
+
+      constexpr Index_type simd_width = RAJAPERF_SIMD_WIDTH;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        FIRST_MIN_MINLOC_INIT;
+
+        FIRST_MIN_SIMD_LANES_INIT(mymin);
+
+        Index_type i = ibegin;
+        for ( ; i + simd_width <= iend; i += simd_width ) {
+          #pragma omp simd simdlen(RAJAPERF_SIMD_WIDTH)
+          for (Index_type l = 0; l < simd_width; ++l) {
+            FIRST_MIN_SIMD_LANE_BODY(x[i + l]);
+          }
+        }
+
+        FIRST_MIN_SIMD_LANES_COMBINE(mymin);
+
+        for ( ; i < iend; ++i ) {
+          FIRST_MIN_BODY;
+        }
+
+        m_minloc = RAJA_MAX(m_minloc, mymin.loc);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_SIMD : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::ReduceMinLoc<RAJA::seq_reduce, Real_type, Index_type> loc(
+                                                        m_xmin_init, m_initloc);
+
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          FIRST_MIN_BODY_RAJA;
+        });
+
+        m_minloc = RAJA_MAX(m_minloc, loc.getLoc());
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FIRST_MIN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
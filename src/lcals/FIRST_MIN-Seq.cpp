@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/SIMDUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +20,7 @@ namespace lcals
 {
 
 
-void FIRST_MIN::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void FIRST_MIN::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type ibegin = 0;
@@ -104,5 +106,125 @@ void FIRST_MIN::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx
 
 }
 
+void FIRST_MIN::runSeqVariantSIMD(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FIRST_MIN_DATA_SETUP;
+
+  constexpr Index_type simd_width = RAJAPERF_SIMD_WIDTH;
+  const Index_type ivec_end = iend - (iend - ibegin) % simd_width;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        FIRST_MIN_MINLOC_INIT;
+
+        FIRST_MIN_SIMD_LANES_INIT(mymin);
+
+        for (Index_type i = ibegin; i < ivec_end; i += simd_width ) {
+          #pragma omp simd simdlen(RAJAPERF_SIMD_WIDTH)
+          for (Index_type l = 0; l < simd_width; ++l) {
+            FIRST_MIN_SIMD_LANE_BODY(x[i + l]);
+          }
+        }
+
+        FIRST_MIN_SIMD_LANES_COMBINE(mymin);
+
+        for (Index_type i = ivec_end; i < iend; ++i ) {
+          FIRST_MIN_BODY;
+        }
+
+        m_minloc = RAJA_MAX(m_minloc, mymin.loc);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto firstmin_base_lam = [=](Index_type i) -> Real_type {
+                                 return x[i];
+                               };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        FIRST_MIN_MINLOC_INIT;
+
+        FIRST_MIN_SIMD_LANES_INIT(mymin);
+
+        for (Index_type i = ibegin; i < ivec_end; i += simd_width ) {
+          #pragma omp simd simdlen(RAJAPERF_SIMD_WIDTH)
+          for (Index_type l = 0; l < simd_width; ++l) {
+            FIRST_MIN_SIMD_LANE_BODY(firstmin_base_lam(i + l));
+          }
+        }
+
+        FIRST_MIN_SIMD_LANES_COMBINE(mymin);
+
+        for (Index_type i = ivec_end; i < iend; ++i ) {
+          if ( firstmin_base_lam(i) < mymin.val ) {
+            mymin.val = x[i];
+            mymin.loc = i;
+          }
+        }
+
+        m_minloc = RAJA_MAX(m_minloc, mymin.loc);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  FIRST_MIN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void FIRST_MIN::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if ( tune_idx == t ) {
+    runSeqVariantDefault(vid);
+  }
+
+  t += 1;
+
+  if ( vid == Base_Seq || vid == Lambda_Seq ) {
+
+    if ( tune_idx == t ) {
+      runSeqVariantSIMD(vid);
+    }
+
+    t += 1;
+
+  }
+}
+
+void FIRST_MIN::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  if ( vid == Base_Seq || vid == Lambda_Seq ) {
+    addVariantTuningName(vid, "simd");
+  }
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -0,0 +1,112 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FIRST_MIN.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/StdParUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+void FIRST_MIN::runStdParVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+#if defined(RUN_STDPAR)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FIRST_MIN_DATA_SETUP;
+
+  //
+  // transform_reduce may combine partial results in any order, so ties
+  // are broken on location to return the first location of the minimum.
+  //
+  auto firstmin_combine = [](const MyMinLoc& a, const MyMinLoc& b) {
+                            if ( b.val < a.val ||
+                                 ( b.val == a.val && b.loc < a.loc ) ) {
+                              return b;
+                            }
+                            return a;
+                          };
+
+  switch ( vid ) {
+
+    case Base_StdPar : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        FIRST_MIN_MINLOC_INIT;
+
+        mymin = std::transform_reduce( std::execution::par_unseq,
+                                       stdpar::counting_iterator(ibegin),
+                                       stdpar::counting_iterator(iend),
+                                       mymin,
+                                       firstmin_combine,
+                                       [=](Index_type i) {
+          return MyMinLoc{x[i], i};
+        });
+
+        m_minloc = RAJA_MAX(m_minloc, mymin.loc);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_StdPar : {
+
+      auto firstmin_base_lam = [=](Index_type i) -> MyMinLoc {
+                                 MyMinLoc val;
+                                 val.val = x[i];
+                                 val.loc = i;
+                                 return val;
+                               };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        FIRST_MIN_MINLOC_INIT;
+
+        mymin = std::transform_reduce( std::execution::par_unseq,
+                                       stdpar::counting_iterator(ibegin),
+                                       stdpar::counting_iterator(iend),
+                                       mymin,
+                                       firstmin_combine,
+                                       firstmin_base_lam );
+
+        m_minloc = RAJA_MAX(m_minloc, mymin.loc);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FIRST_MIN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
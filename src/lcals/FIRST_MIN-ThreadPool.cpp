@@ -0,0 +1,106 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FIRST_MIN.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/ThreadPool.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+void FIRST_MIN::runThreadPoolVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+#if defined(RUN_THREADPOOL)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = getActualProblemSize();
+
+  FIRST_MIN_DATA_SETUP;
+
+  //
+  // Chunks are combined in order, so keeping the left operand on ties
+  // returns the first location of the minimum.
+  //
+  auto firstmin_combine = [](const MyMinLoc& a, const MyMinLoc& b) {
+                            return b.val < a.val ? b : a;
+                          };
+
+  switch ( vid ) {
+
+    case Base_ThreadPool : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        FIRST_MIN_MINLOC_INIT;
+
+        mymin = threadpool::parallel_reduce(ibegin, iend, mymin,
+          [=](Index_type cbegin, Index_type cend, MyMinLoc& mymin) {
+          for (Index_type i = cbegin; i < cend; ++i ) {
+            FIRST_MIN_BODY;
+          }
+        }, firstmin_combine);
+
+        m_minloc = RAJA_MAX(m_minloc, mymin.loc);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_ThreadPool : {
+
+      auto firstmin_base_lam = [=](Index_type i) -> Real_type {
+                                 return x[i];
+                               };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        FIRST_MIN_MINLOC_INIT;
+
+        mymin = threadpool::parallel_reduce(ibegin, iend, mymin,
+          [=](Index_type cbegin, Index_type cend, MyMinLoc& mymin) {
+          for (Index_type i = cbegin; i < cend; ++i ) {
+            if ( firstmin_base_lam(i) < mymin.val ) {
+              mymin.val = x[i];
+              mymin.loc = i;
+            }
+          }
+        }, firstmin_combine);
+
+        m_minloc = RAJA_MAX(m_minloc, mymin.loc);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FIRST_MIN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
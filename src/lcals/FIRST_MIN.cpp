@@ -12,6 +12,8 @@
 
 #include "common/DataUtils.hpp"
 
+#include <algorithm>
+
 namespace rajaperf
 {
 namespace lcals
@@ -31,6 +33,9 @@ FIRST_MIN::FIRST_MIN(const RunParams& params)
 
   m_N = getActualProblemSize();
 
+  m_loc_fraction = params.getFirstMinLoc();
+  m_num_ties = params.getFirstMinTies();
+
   setItsPerRep( getActualProblemSize() );
   setKernelsPerRep(1);
   setBytesPerRep( (1*sizeof(Real_type ) + 1*sizeof(Real_type )) +
@@ -47,18 +52,35 @@ FIRST_MIN::FIRST_MIN(const RunParams& params)
 
   setVariantDefined( Base_OpenMP );
   setVariantDefined( Lambda_OpenMP );
-  setVariantDefined( RAJA_OpenMP );
 
   setVariantDefined( Base_OpenMPTarget );
-  setVariantDefined( RAJA_OpenMPTarget );
 
-  setVariantDefined( Base_CUDA );
-  setVariantDefined( RAJA_CUDA );
+  // these variants reduce with min-loc operations that do not break ties
+  // on location, so they are only run when the minimum is unique
+  if ( m_num_ties == 1 ) {
+
+    setVariantDefined( RAJA_OpenMP );
+
+    setVariantDefined( RAJA_OpenMPTarget );
+
+    setVariantDefined( Base_CUDA );
+    setVariantDefined( RAJA_CUDA );
 
-  setVariantDefined( Base_HIP );
-  setVariantDefined( RAJA_HIP );
+    setVariantDefined( Base_HIP );
+    setVariantDefined( RAJA_HIP );
 
-  setVariantDefined( Kokkos_Lambda );
+    setVariantDefined( Kokkos_Lambda );
+
+  }
+
+  setVariantDefined( Base_ThreadPool );
+  setVariantDefined( Lambda_ThreadPool );
+
+  setVariantDefined( Base_StdPar );
+  setVariantDefined( Lambda_StdPar );
+
+  setVariantDefined( Base_SIMD );
+  setVariantDefined( RAJA_SIMD );
 }
 
 FIRST_MIN::~FIRST_MIN()
@@ -68,7 +90,14 @@ FIRST_MIN::~FIRST_MIN()
 void FIRST_MIN::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   allocAndInitDataConst(m_x, m_N, 0.0, vid);
-  m_x[ m_N / 2 ] = -1.0e+10;
+
+  const Index_type loc = std::min(static_cast<Index_type>(m_loc_fraction * m_N),
+                                  m_N - 1);
+  const Index_type stride = std::max(static_cast<Index_type>(1),
+                                     (m_N - loc) / m_num_ties);
+  for (Index_type t = 0; t < m_num_ties && loc + t * stride < m_N; ++t) {
+    m_x[ loc + t * stride ] = -1.0e+10;
+  }
   m_xmin_init = m_x[0];
   m_initloc = 0;
   m_minloc = -1;
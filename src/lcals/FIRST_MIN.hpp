@@ -17,6 +17,22 @@
 ///   if ( x[i] < x[loc] ) loc = i;
 /// }
 ///
+/// The position of the minimum, N/2 above, is set with --first_min_loc as
+/// a fraction of N. --first_min_ties sets how many elements equal the
+/// minimum; they are spread evenly from the first one to the end of x.
+/// The Seq, Base and Lambda OpenMP, Base_OpenMPTarget, ThreadPool, StdPar
+/// and SIMD variants break ties on location and find the first. The RAJA
+/// OpenMP, OpenMPTarget, CUDA and HIP variants, the Base CUDA and HIP
+/// variants and the Kokkos variant use min-loc reductions that may return
+/// any of them, so they are not run when --first_min_ties is more than 1.
+///
+/// Base and Lambda variants of Seq and OpenMP have a 'simd' tuning, a
+/// vector minloc: each vector lane keeps the minimum of the elements it
+/// sees and blends in their location with the same compare, then the
+/// lanes are combined breaking ties on location so the first minimum is
+/// kept. OpenMP threads each do this over their part of x and combine
+/// their results the same way.
+///
 
 #ifndef RAJAPerf_Lcals_FIRST_MIN_HPP
 #define RAJAPerf_Lcals_FIRST_MIN_HPP
@@ -45,7 +61,7 @@ struct MyMinLoc {
 
 #define FIRST_MIN_MINLOC_COMPARE \
 MyMinLoc MinLoc_compare(MyMinLoc a, MyMinLoc b) { \
-  return a.val < b.val ? a : b ; \
+  return ( a.val < b.val || ( a.val == b.val && a.loc < b.loc ) ) ? a : b ; \
 }
 
 #define FIRST_MIN_MINLOC_INIT \
@@ -53,6 +69,33 @@ MyMinLoc MinLoc_compare(MyMinLoc a, MyMinLoc b) { \
   mymin.val = m_xmin_init; \
   mymin.loc = m_initloc;
 
+//
+// Vector minloc of the 'simd' tunings, simd_width lanes starting from
+// minloc m. The lane body takes the value of element i + l.
+//
+#define FIRST_MIN_SIMD_LANES_INIT(m) \
+  alignas(RAJAPERF_SIMD_BYTES) Real_type lane_val[simd_width]; \
+  alignas(RAJAPERF_SIMD_BYTES) Index_type lane_loc[simd_width]; \
+  for (Index_type l = 0; l < simd_width; ++l) { \
+    lane_val[l] = (m).val; \
+    lane_loc[l] = (m).loc; \
+  }
+
+#define FIRST_MIN_SIMD_LANE_BODY(xval) \
+  const Real_type val = (xval); \
+  const bool less = val < lane_val[l]; \
+  lane_val[l] = less ? val : lane_val[l]; \
+  lane_loc[l] = less ? i + l : lane_loc[l];
+
+#define FIRST_MIN_SIMD_LANES_COMBINE(m) \
+  for (Index_type l = 0; l < simd_width; ++l) { \
+    if ( lane_val[l] < (m).val || \
+         ( lane_val[l] == (m).val && lane_loc[l] < (m).loc ) ) { \
+      (m).val = lane_val[l]; \
+      (m).loc = lane_loc[l]; \
+    } \
+  }
+
 
 
 #include "common/KernelBase.hpp"
@@ -82,6 +125,17 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
+  void runThreadPoolVariant(VariantID vid, size_t tune_idx);
+  void runStdParVariant(VariantID vid, size_t tune_idx);
+  void runSIMDVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantSIMD(VariantID vid);
+
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantSIMD(VariantID vid);
 
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
@@ -100,6 +154,8 @@ private:
   Index_type m_minloc;
 
   Index_type m_N;
+  Real_type m_loc_fraction;
+  Index_type m_num_ties;
 };
 
 } // end namespace lcals
@@ -0,0 +1,192 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FIRST_SUM_ORIG.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+void FIRST_SUM_ORIG::runOpenMPVariantScan(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 1;
+  const Index_type iend = m_N;
+
+  FIRST_SUM_ORIG_DATA_SETUP;
+  AFFINE_SCAN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          #pragma omp for
+          for (Index_type c = 0; c < nblocks; ++c ) {
+            AFFINE_SCAN_REDUCE_BODY(FIRST_SUM_ORIG_COEFS);
+          }
+          #pragma omp single
+          {
+            AFFINE_SCAN_BLOCKS(x[ibegin-1]);
+          }
+          #pragma omp for
+          for (Index_type c = 0; c < nblocks; ++c ) {
+            AFFINE_SCAN_RECOMPUTE_BODY(FIRST_SUM_ORIG_STEP, FIRST_SUM_ORIG_STORE);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      auto firstsum_reduce_lam = [=](Index_type c) {
+        AFFINE_SCAN_REDUCE_BODY(FIRST_SUM_ORIG_COEFS);
+      };
+      auto firstsum_recompute_lam = [=](Index_type c) {
+        AFFINE_SCAN_RECOMPUTE_BODY(FIRST_SUM_ORIG_STEP, FIRST_SUM_ORIG_STORE);
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nblocks), firstsum_reduce_lam);
+        AFFINE_SCAN_BLOCKS(x[ibegin-1]);
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nblocks), firstsum_recompute_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FIRST_SUM_ORIG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void FIRST_SUM_ORIG::runOpenMPVariantScanSimd(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 1;
+  const Index_type iend = m_N;
+
+  FIRST_SUM_ORIG_DATA_SETUP;
+  AFFINE_SCAN_SIMD_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          #pragma omp for
+          for (Index_type c = 0; c < nblocks; ++c ) {
+            AFFINE_SCAN_PREFIX_BODY(FIRST_SUM_ORIG_COEFS);
+          }
+          #pragma omp single
+          {
+            AFFINE_SCAN_BLOCKS(x[ibegin-1]);
+          }
+          #pragma omp for
+          for (Index_type c = 0; c < nblocks; ++c ) {
+            AFFINE_SCAN_BLOCK_RANGE;
+            const Real_type xs = block_x[c];
+            #pragma omp simd
+            for (Index_type i = bbegin; i < bend; ++i ) {
+              AFFINE_SCAN_APPLY_BODY(FIRST_SUM_ORIG_STORE);
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      auto firstsum_prefix_lam = [=](Index_type c) {
+        AFFINE_SCAN_PREFIX_BODY(FIRST_SUM_ORIG_COEFS);
+      };
+      auto firstsum_apply_lam = [=](Index_type c) {
+        AFFINE_SCAN_BLOCK_RANGE;
+        const Real_type xs = block_x[c];
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(bbegin, bend), [=](Index_type i) {
+          AFFINE_SCAN_APPLY_BODY(FIRST_SUM_ORIG_STORE);
+        });
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nblocks), firstsum_prefix_lam);
+        AFFINE_SCAN_BLOCKS(x[ibegin-1]);
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nblocks), firstsum_apply_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FIRST_SUM_ORIG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void FIRST_SUM_ORIG::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  if ( tune_idx == 0 ) {
+    runOpenMPVariantScan(vid);
+  } else {
+    runOpenMPVariantScanSimd(vid);
+  }
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
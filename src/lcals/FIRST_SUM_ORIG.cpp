@@ -0,0 +1,87 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FIRST_SUM_ORIG.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+FIRST_SUM_ORIG::FIRST_SUM_ORIG(const RunParams& params)
+  : KernelBase(rajaperf::Lcals_FIRST_SUM_ORIG, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(2000);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_N = getActualProblemSize();
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(1);
+  // scan_simd tunings also move the scan_p, scan_q scratch, see setUp
+  setBytesPerRep( (1*sizeof(Real_type ) + 1*sizeof(Real_type )) * (m_N-1) +
+                  affine_scan::getSimdScratchBytes(m_N-1) );
+  setFLOPsPerRep(1 * (getActualProblemSize()-1));
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+FIRST_SUM_ORIG::~FIRST_SUM_ORIG()
+{
+}
+
+void FIRST_SUM_ORIG::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "serial");
+  addVariantTuningName(vid, "scan");
+  addVariantTuningName(vid, "scan_simd");
+}
+
+void FIRST_SUM_ORIG::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "scan");
+  addVariantTuningName(vid, "scan_simd");
+}
+
+void FIRST_SUM_ORIG::setUp(VariantID vid, size_t tune_idx)
+{
+  if ( getVariantTuningName(vid, tune_idx) != "scan_simd" ) {
+    recordBytesSaved(vid, tune_idx, affine_scan::getSimdScratchBytes(m_N-1));
+  }
+
+  allocAndInitData(m_x, m_N, vid);
+  allocAndInitData(m_y, m_N, vid);
+}
+
+void FIRST_SUM_ORIG::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_x, getActualProblemSize());
+}
+
+void FIRST_SUM_ORIG::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_x);
+  deallocData(m_y);
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
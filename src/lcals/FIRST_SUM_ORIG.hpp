@@ -0,0 +1,108 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// FIRST_SUM_ORIG kernel reference implementation:
+///
+/// The original, loop-carried form of FIRST_SUM:
+///
+/// for (Index_type i = 1; i < N; ++i ) {
+///   x[i] = x[i-1] + y[i];
+/// }
+///
+/// Tunings:
+///   serial    -- Seq only, the loop above
+///   scan      -- the recurrence as a parallel affine scan over blocks of
+///                iterations, each block reruns the loop from its first value
+///   scan_simd -- the same, but each value is computed directly from the
+///                value before its block, vectorizable within blocks
+/// (see common/ScanUtils.hpp). The scan tunings reassociate the arithmetic
+/// so they match the serial tuning to rounding only.
+///
+
+#ifndef RAJAPerf_Lcals_FIRST_SUM_ORIG_HPP
+#define RAJAPerf_Lcals_FIRST_SUM_ORIG_HPP
+
+
+#define FIRST_SUM_ORIG_DATA_SETUP \
+  Real_ptr x = m_x; \
+  Real_ptr y = m_y;
+
+#define FIRST_SUM_ORIG_BODY  \
+  x[i] = x[i-1] + y[i];
+
+// x[i] = a * x[i-1] + b, and the body as a step from xold = x[i-1]
+#define FIRST_SUM_ORIG_COEFS  \
+  const Real_type a = 1.0; \
+  const Real_type b = y[i];
+
+#define FIRST_SUM_ORIG_STEP  \
+  const Real_type xnew = xold + y[i];
+
+#define FIRST_SUM_ORIG_STORE  \
+  x[i] = xnew;
+
+
+#include "common/KernelBase.hpp"
+#include "common/ScanUtils.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace lcals
+{
+
+class FIRST_SUM_ORIG : public KernelBase
+{
+public:
+
+  FIRST_SUM_ORIG(const RunParams& params);
+
+  ~FIRST_SUM_ORIG();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  FIRST_SUM_ORIG : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  FIRST_SUM_ORIG : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  FIRST_SUM_ORIG : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+
+  void runSeqVariantSerial(VariantID vid);
+  void runSeqVariantScan(VariantID vid);
+  void runSeqVariantScanSimd(VariantID vid);
+
+  void runOpenMPVariantScan(VariantID vid);
+  void runOpenMPVariantScanSimd(VariantID vid);
+
+private:
+  Real_ptr m_x;
+  Real_ptr m_y;
+
+  Index_type m_N;
+};
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
@@ -0,0 +1,207 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FUSION_CHAIN.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+void FUSION_CHAIN::runOpenMPVariantDefault(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  FUSION_CHAIN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        // one parallel region for the chain, each stage a worksharing loop
+        // whose implicit barrier orders it before the next stage
+        #pragma omp parallel
+        {
+          for (Index_type s = 0; s < nstages; ++s) {
+            Real_ptr in = chain[s];
+            Real_ptr out = chain[s+1];
+            const Index_type slen = FUSION_CHAIN_STAGE_LEN(s);
+
+            switch ( stages[s] ) {
+              case FusionHydro1D : {
+                #pragma omp for
+                for (Index_type i = 0; i < slen; ++i ) {
+                  FUSION_CHAIN_HYDRO_1D_BODY(in, out, side_z);
+                }
+                break;
+              }
+              case FusionFirstDiff : {
+                #pragma omp for
+                for (Index_type i = 0; i < slen; ++i ) {
+                  FUSION_CHAIN_FIRST_DIFF_BODY(in, out);
+                }
+                break;
+              }
+              default : {
+                #pragma omp for
+                for (Index_type i = 0; i < slen; ++i ) {
+                  FUSION_CHAIN_EOS_BODY(in, out, side_y, side_z);
+                }
+                break;
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type s = 0; s < nstages; ++s) {
+          Real_ptr in = chain[s];
+          Real_ptr out = chain[s+1];
+          const Index_type iend = FUSION_CHAIN_STAGE_LEN(s);
+          FUSION_CHAIN_RAJA_STAGE_LOOP(RAJA::omp_parallel_for_exec, stages[s],
+                                       in, out, side_y, side_z, 0, iend);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FUSION_CHAIN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+template < size_t block_size >
+void FUSION_CHAIN::runOpenMPVariantBlocked(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  FUSION_CHAIN_DATA_SETUP;
+  FUSION_CHAIN_BLOCK_DATA_SETUP;
+
+  // two scratch buffers for each thread
+  const int num_threads = omp_get_max_threads();
+  std::vector<Real_type> buf_vec(num_threads * 2 * buf_len);
+  Real_ptr bufs = buf_vec.data();
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel
+        {
+          Real_ptr buf0 = bufs + omp_get_thread_num() * 2 * buf_len;
+          Real_ptr buf1 = buf0 + buf_len;
+
+          #pragma omp for
+          for (Index_type blk = 0; blk < nblocks; ++blk ) {
+            FUSION_CHAIN_BLOCK_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      auto fusionchain_block_lam = [=](Index_type blk) {
+                                     Real_ptr buf0 = bufs + omp_get_thread_num() * 2 * buf_len;
+                                     Real_ptr buf1 = buf0 + buf_len;
+                                     FUSION_CHAIN_BLOCK_BODY;
+                                   };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nblocks), fusionchain_block_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  FUSION_CHAIN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void FUSION_CHAIN::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runOpenMPVariantDefault(vid);
+  }
+
+  t += 1;
+
+  seq_for(block_sizes_type{}, [&](auto block_size) {
+    if (tune_idx == t) {
+      runOpenMPVariantBlocked<block_size>(vid);
+    }
+    t += 1;
+  });
+}
+
+void FUSION_CHAIN::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  seq_for(block_sizes_type{}, [&](auto block_size) {
+    addVariantTuningName(vid, "fused_block_"+std::to_string(block_size));
+  });
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
@@ -0,0 +1,225 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FUSION_CHAIN.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+void FUSION_CHAIN::runSeqVariantDefault(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  FUSION_CHAIN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type s = 0; s < nstages; ++s) {
+          Real_ptr in = chain[s];
+          Real_ptr out = chain[s+1];
+          const Index_type iend = FUSION_CHAIN_STAGE_LEN(s);
+          FUSION_CHAIN_STAGE_LOOP(stages[s], in, out, side_y, side_z, 0, iend);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type s = 0; s < nstages; ++s) {
+          Real_ptr in = chain[s];
+          Real_ptr out = chain[s+1];
+          const Index_type iend = FUSION_CHAIN_STAGE_LEN(s);
+          FUSION_CHAIN_RAJA_STAGE_LOOP(RAJA::simd_exec, stages[s],
+                                       in, out, side_y, side_z, 0, iend);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  FUSION_CHAIN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void FUSION_CHAIN::runSeqVariantFused(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  FUSION_CHAIN_DATA_SETUP;
+
+  const Index_type jbegin = 0;
+  const Index_type jend = FUSION_CHAIN_STAGE_LEN(0);
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type j = jbegin; j < jend; ++j ) {
+          FUSION_CHAIN_FUSED_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      auto fusionchain_fused_lam = [=](Index_type j) {
+                                     FUSION_CHAIN_FUSED_BODY;
+                                   };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(jbegin, jend), fusionchain_fused_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  FUSION_CHAIN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+template < size_t block_size >
+void FUSION_CHAIN::runSeqVariantBlocked(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+
+  FUSION_CHAIN_DATA_SETUP;
+  FUSION_CHAIN_BLOCK_DATA_SETUP;
+
+  std::vector<Real_type> buf_vec(2 * buf_len);
+  Real_ptr buf0 = buf_vec.data();
+  Real_ptr buf1 = buf_vec.data() + buf_len;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type blk = 0; blk < nblocks; ++blk ) {
+          FUSION_CHAIN_BLOCK_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      auto fusionchain_block_lam = [=](Index_type blk) {
+                                     FUSION_CHAIN_BLOCK_BODY;
+                                   };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(0, nblocks), fusionchain_block_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  FUSION_CHAIN : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void FUSION_CHAIN::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runSeqVariantDefault(vid);
+  }
+
+  t += 1;
+
+  if (tune_idx == t) {
+    runSeqVariantFused(vid);
+  }
+
+  t += 1;
+
+  seq_for(block_sizes_type{}, [&](auto block_size) {
+    if (tune_idx == t) {
+      runSeqVariantBlocked<block_size>(vid);
+    }
+    t += 1;
+  });
+}
+
+void FUSION_CHAIN::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  addVariantTuningName(vid, "fused");
+
+  seq_for(block_sizes_type{}, [&](auto block_size) {
+    addVariantTuningName(vid, "fused_block_"+std::to_string(block_size));
+  });
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
@@ -0,0 +1,168 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "FUSION_CHAIN.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+FUSION_CHAIN::FUSION_CHAIN(const RunParams& params)
+  : KernelBase(rajaperf::Lcals_FUSION_CHAIN, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(500);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_len = getActualProblemSize();
+
+  for (const std::string& name : params.getFusionChain()) {
+    if ( name == std::string("HYDRO_1D") ) {
+      m_stages.push_back(FusionHydro1D);
+    } else if ( name == std::string("FIRST_DIFF") ) {
+      m_stages.push_back(FusionFirstDiff);
+    } else {
+      m_stages.push_back(FusionEOS);
+    }
+  }
+  if ( m_stages.empty() ) {
+    m_stages = { FusionHydro1D, FusionFirstDiff, FusionEOS };
+  }
+
+  const Index_type nstages = m_stages.size();
+
+  m_skew.resize(nstages, 0);
+  for (Index_type s = 1; s < nstages; ++s) {
+    m_skew[s] = m_skew[s-1] + getStageLead(m_stages[s]);
+  }
+  const Index_type halo = m_skew[nstages-1];
+
+  // HYDRO_1D reads side_z 11 past i
+  m_array_length = m_len + halo + getStageLead(m_stages[0]) + 12;
+
+  //
+  // Each stage's bytes and FLOPs as its kernel declares them, for its len[s]
+  //
+  Index_type its = 0;
+  Index_type bytes = 0;
+  Index_type flops = 0;
+  m_intermediate_bytes = 0;
+  for (Index_type s = 0; s < nstages; ++s) {
+    const Index_type slen = m_len + halo - m_skew[s];
+    const Index_type lead = getStageLead(m_stages[s]);
+    its += slen;
+    bytes += (1*sizeof(Real_type) + 0*sizeof(Real_type)) * slen +
+             (0*sizeof(Real_type) + 1*sizeof(Real_type)) * (slen + lead);
+    switch ( m_stages[s] ) {
+      case FusionHydro1D : {
+        bytes += (0*sizeof(Real_type) + 1*sizeof(Real_type)) * (slen+1);
+        flops += 5 * slen;
+        break;
+      }
+      case FusionFirstDiff : {
+        flops += 1 * slen;
+        break;
+      }
+      default : {
+        bytes += (0*sizeof(Real_type) + 2*sizeof(Real_type)) * slen;
+        flops += 16 * slen;
+        break;
+      }
+    }
+    if ( s > 0 ) {
+      m_intermediate_bytes += (0*sizeof(Real_type) + 1*sizeof(Real_type)) * (slen + lead);
+    }
+  }
+
+  setItsPerRep( its );
+  setKernelsPerRep( nstages );
+  setBytesPerRep( bytes );
+  setFLOPsPerRep( flops );
+
+  checksum_scale_factor = 0.001 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+FUSION_CHAIN::~FUSION_CHAIN()
+{
+}
+
+Index_type FUSION_CHAIN::getStageLead(FusionStage stage)
+{
+  switch ( stage ) {
+    case FusionHydro1D : return 0;
+    case FusionFirstDiff : return 1;
+    default : return 6;
+  }
+}
+
+void FUSION_CHAIN::setUp(VariantID vid, size_t tune_idx)
+{
+  const Index_type nstages = m_stages.size();
+
+  m_chain.resize(nstages+1, nullptr);
+  allocAndInitData(m_chain[0], m_array_length, vid);
+  for (Index_type s = 1; s <= nstages; ++s) {
+    allocAndInitDataConst(m_chain[s], m_array_length, 0.0, vid);
+  }
+  allocAndInitData(m_side_y, m_array_length, vid);
+  allocAndInitData(m_side_z, m_array_length, vid);
+
+  initData(m_q, vid);
+  initData(m_r, vid);
+  initData(m_t, vid);
+
+  //
+  // fused keeps the intermediate arrays in cache between the stage that
+  // writes them and the ones that read them, the blocked tunings do not
+  // use them
+  //
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+  Index_type bytes_saved = 0;
+  if ( tuning_name == "fused" ) {
+    bytes_saved = m_intermediate_bytes;
+  } else if ( tuning_name.find("fused_block_") == 0 ) {
+    bytes_saved = 2 * m_intermediate_bytes;
+  }
+  recordBytesSaved(vid, tune_idx, bytes_saved);
+}
+
+void FUSION_CHAIN::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_chain[m_stages.size()], m_len,
+                                          checksum_scale_factor );
+}
+
+void FUSION_CHAIN::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  for (Real_ptr& a : m_chain) {
+    deallocData(a);
+  }
+  deallocData(m_side_y);
+  deallocData(m_side_z);
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
@@ -0,0 +1,271 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// FUSION_CHAIN kernel reference implementation:
+///
+/// A chain of Lcals kernel bodies (--fusion_chain, default
+/// HYDRO_1D FIRST_DIFF EOS), each reading the array the one before it
+/// writes:
+///
+/// for (Index_type s = 0; s < nstages; ++s) {
+///   for (Index_type i = 0; i < len[s]; ++i ) {
+///     <body of stage s, chain input chain[s], output chain[s+1]>
+///   }
+/// }
+///
+/// The stages are the kernels' own bodies:
+///   HYDRO_1D   -- x = chain[s+1], y = chain[s], z = side_z
+///   FIRST_DIFF -- x = chain[s+1], y = chain[s]
+///   EOS        -- x = chain[s+1], u = chain[s], y = side_y, z = side_z
+/// Stage s reads chain[s] up to lead[s] = 0, 1 or 6 past i. It runs
+/// skew[s] = lead[1] + ... + lead[s] behind the first stage, and
+/// len[s] = N + skew[nstages-1] - skew[s] so the last stage writes N results.
+///
+/// Tunings:
+///   default         -- unfused, one loop per stage as above
+///   fused           -- Seq only, one loop over j running stage s at
+///                      i = j - skew[s], so what a stage reads was written a
+///                      few iterations before; intermediate arrays are still
+///                      written
+///   fused_block_<B> -- for each block of B results, each stage runs over the
+///                      block and the halo the later stages read past it,
+///                      into two scratch buffers that stay in cache; the halo
+///                      is recomputed by the next block
+///
+/// Bytes per rep are the sum of the stages' bytes as the kernels declare
+/// them. Each tuning records the traffic it avoids for the bytes saved
+/// report: the reads of the intermediate arrays for fused, and their reads
+/// and writes for fused_block_<B>.
+///
+
+#ifndef RAJAPerf_Lcals_FUSION_CHAIN_HPP
+#define RAJAPerf_Lcals_FUSION_CHAIN_HPP
+
+
+#define FUSION_CHAIN_DATA_SETUP \
+  Real_ptr side_y = m_side_y; \
+  Real_ptr side_z = m_side_z; \
+\
+  const Real_type q = m_q; \
+  const Real_type r = m_r; \
+  const Real_type t = m_t; \
+\
+  const Index_type nstages = m_stages.size(); \
+  const FusionStage* stages = m_stages.data(); \
+  const Index_type* skew = m_skew.data(); \
+  Real_ptr const* chain = m_chain.data(); \
+  const Index_type len = m_len;
+
+// len[s], the number of values stage s writes
+#define FUSION_CHAIN_STAGE_LEN(s) \
+  ( len + skew[nstages-1] - skew[(s)] )
+
+#define FUSION_CHAIN_HYDRO_1D_BODY(in, out, sz) \
+  { \
+    Real_ptr x = out; \
+    Real_ptr y = in; \
+    Real_ptr z = sz; \
+    HYDRO_1D_BODY; \
+  }
+
+#define FUSION_CHAIN_FIRST_DIFF_BODY(in, out) \
+  { \
+    Real_ptr x = out; \
+    Real_ptr y = in; \
+    FIRST_DIFF_BODY; \
+  }
+
+#define FUSION_CHAIN_EOS_BODY(in, out, sy, sz) \
+  { \
+    Real_ptr x = out; \
+    Real_ptr y = sy; \
+    Real_ptr z = sz; \
+    Real_ptr u = in; \
+    EOS_BODY; \
+  }
+
+// one iteration of a stage, for loops that run different stages
+#define FUSION_CHAIN_STAGE_BODY(stage, in, out, sy, sz) \
+  switch ( stage ) { \
+    case FusionHydro1D : \
+      FUSION_CHAIN_HYDRO_1D_BODY(in, out, sz); \
+      break; \
+    case FusionFirstDiff : \
+      FUSION_CHAIN_FIRST_DIFF_BODY(in, out); \
+      break; \
+    default : \
+      FUSION_CHAIN_EOS_BODY(in, out, sy, sz); \
+      break; \
+  }
+
+// a loop over [ibeg, iend) of a stage, with the stage chosen outside it
+#define FUSION_CHAIN_STAGE_LOOP(stage, in, out, sy, sz, ibeg, iend) \
+  switch ( stage ) { \
+    case FusionHydro1D : \
+      for (Index_type i = ibeg; i < iend; ++i ) { \
+        FUSION_CHAIN_HYDRO_1D_BODY(in, out, sz); \
+      } \
+      break; \
+    case FusionFirstDiff : \
+      for (Index_type i = ibeg; i < iend; ++i ) { \
+        FUSION_CHAIN_FIRST_DIFF_BODY(in, out); \
+      } \
+      break; \
+    default : \
+      for (Index_type i = ibeg; i < iend; ++i ) { \
+        FUSION_CHAIN_EOS_BODY(in, out, sy, sz); \
+      } \
+      break; \
+  }
+
+#define FUSION_CHAIN_RAJA_STAGE_LOOP(exec_policy, stage, in, out, sy, sz, ibeg, iend) \
+  switch ( stage ) { \
+    case FusionHydro1D : \
+      RAJA::forall< exec_policy >( \
+        RAJA::RangeSegment(ibeg, iend), [=](Index_type i) { \
+        FUSION_CHAIN_HYDRO_1D_BODY(in, out, sz); \
+      }); \
+      break; \
+    case FusionFirstDiff : \
+      RAJA::forall< exec_policy >( \
+        RAJA::RangeSegment(ibeg, iend), [=](Index_type i) { \
+        FUSION_CHAIN_FIRST_DIFF_BODY(in, out); \
+      }); \
+      break; \
+    default : \
+      RAJA::forall< exec_policy >( \
+        RAJA::RangeSegment(ibeg, iend), [=](Index_type i) { \
+        FUSION_CHAIN_EOS_BODY(in, out, sy, sz); \
+      }); \
+      break; \
+  }
+
+// iteration j of the fused loop
+#define FUSION_CHAIN_FUSED_BODY \
+  for (Index_type s = 0; s < nstages; ++s) { \
+    const Index_type i = j - skew[s]; \
+    if ( i >= 0 ) { \
+      FUSION_CHAIN_STAGE_BODY(stages[s], chain[s], chain[s+1], side_y, side_z); \
+    } \
+  }
+
+//
+// Block blk of the results, [ib, ib + nb). Stage s runs over
+// [0, nb + halo - skew[s]) relative to ib, reading the first stage's input
+// and writing the last stage's output in place, and otherwise the scratch
+// buffers buf0 and buf1, of bsize + halo values each, in turn.
+//
+#define FUSION_CHAIN_BLOCK_DATA_SETUP \
+  const Index_type bsize = block_size; \
+  const Index_type halo = skew[nstages-1]; \
+  const Index_type nblocks = (len + bsize - 1) / bsize; \
+  const Index_type buf_len = bsize + halo;
+
+#define FUSION_CHAIN_BLOCK_BODY \
+  const Index_type ib = blk * bsize; \
+  const Index_type nb = std::min(ib + bsize, len) - ib; \
+  for (Index_type s = 0; s < nstages; ++s) { \
+    Real_ptr bin = (s == 0) ? chain[0] + ib : \
+                   ( (s % 2 == 1) ? buf0 : buf1 ); \
+    Real_ptr bout = (s == nstages-1) ? chain[nstages] + ib : \
+                    ( (s % 2 == 0) ? buf0 : buf1 ); \
+    Real_ptr bside_y = side_y + ib; \
+    Real_ptr bside_z = side_z + ib; \
+    const Index_type bend = nb + halo - skew[s]; \
+    FUSION_CHAIN_STAGE_LOOP(stages[s], bin, bout, bside_y, bside_z, 0, bend); \
+  }
+
+
+#include "common/KernelBase.hpp"
+
+#include "HYDRO_1D.hpp"
+#include "FIRST_DIFF.hpp"
+#include "EOS.hpp"
+
+#include <string>
+#include <vector>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace lcals
+{
+
+enum FusionStage {
+  FusionHydro1D,
+  FusionFirstDiff,
+  FusionEOS
+};
+
+class FUSION_CHAIN : public KernelBase
+{
+public:
+
+  FUSION_CHAIN(const RunParams& params);
+
+  ~FUSION_CHAIN();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  FUSION_CHAIN : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  FUSION_CHAIN : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  FUSION_CHAIN : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantFused(VariantID vid);
+  template < size_t block_size >
+  void runSeqVariantBlocked(VariantID vid);
+
+  void runOpenMPVariantDefault(VariantID vid);
+  template < size_t block_size >
+  void runOpenMPVariantBlocked(VariantID vid);
+
+private:
+  using block_sizes_type = camp::int_seq<size_t, 512, 4096>;
+
+  static Index_type getStageLead(FusionStage stage);
+
+  std::vector<FusionStage> m_stages;
+  std::vector<Index_type> m_skew;
+
+  std::vector<Real_ptr> m_chain;
+  Real_ptr m_side_y;
+  Real_ptr m_side_z;
+
+  Real_type m_q;
+  Real_type m_r;
+  Real_type m_t;
+
+  Index_type m_len;
+  Index_type m_array_length;
+
+  Index_type m_intermediate_bytes;
+};
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
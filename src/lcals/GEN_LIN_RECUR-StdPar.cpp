@@ -0,0 +1,98 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "GEN_LIN_RECUR.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/StdParUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+void GEN_LIN_RECUR::runStdParVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+#if defined(RUN_STDPAR)
+
+  const Index_type run_reps = getRunReps();
+
+  GEN_LIN_RECUR_DATA_SETUP;
+
+  auto genlinrecur_lam1 = [=](Index_type k) {
+                            GEN_LIN_RECUR_BODY1;
+                          };
+  auto genlinrecur_lam2 = [=](Index_type i) {
+                            GEN_LIN_RECUR_BODY2;
+                          };
+
+  switch ( vid ) {
+
+    case Base_StdPar : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        std::for_each( std::execution::par_unseq,
+                       stdpar::counting_iterator(0),
+                       stdpar::counting_iterator(N),
+                       [=](Index_type k) {
+          GEN_LIN_RECUR_BODY1;
+        });
+
+        std::for_each( std::execution::par_unseq,
+                       stdpar::counting_iterator(1),
+                       stdpar::counting_iterator(N+1),
+                       [=](Index_type i) {
+          GEN_LIN_RECUR_BODY2;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_StdPar : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        std::for_each( std::execution::par_unseq,
+                       stdpar::counting_iterator(0),
+                       stdpar::counting_iterator(N),
+                       genlinrecur_lam1 );
+
+        std::for_each( std::execution::par_unseq,
+                       stdpar::counting_iterator(1),
+                       stdpar::counting_iterator(N+1),
+                       genlinrecur_lam2 );
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  GEN_LIN_RECUR : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
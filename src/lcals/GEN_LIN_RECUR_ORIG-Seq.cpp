@@ -0,0 +1,340 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "GEN_LIN_RECUR_ORIG.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+void GEN_LIN_RECUR_ORIG::runSeqVariantSerial(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_N;
+
+  GEN_LIN_RECUR_ORIG_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        stb5 = stb5_init;
+        {
+          const Index_type kfirst = 0;
+          const Index_type kstride = 1;
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            GEN_LIN_RECUR_ORIG_BODY;
+          }
+        }
+        {
+          const Index_type kfirst = N-1;
+          const Index_type kstride = -1;
+          for (Index_type i = ibegin; i < iend; ++i ) {
+            GEN_LIN_RECUR_ORIG_BODY;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        stb5 = stb5_init;
+        {
+          const Index_type kfirst = 0;
+          const Index_type kstride = 1;
+          RAJA::forall<RAJA::seq_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=, &stb5](Index_type i) {
+            GEN_LIN_RECUR_ORIG_BODY;
+          });
+        }
+        {
+          const Index_type kfirst = N-1;
+          const Index_type kstride = -1;
+          RAJA::forall<RAJA::seq_exec>(
+            RAJA::RangeSegment(ibegin, iend), [=, &stb5](Index_type i) {
+            GEN_LIN_RECUR_ORIG_BODY;
+          });
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  GEN_LIN_RECUR_ORIG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  m_stb5 = stb5;
+
+}
+
+void GEN_LIN_RECUR_ORIG::runSeqVariantScan(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_N;
+
+  GEN_LIN_RECUR_ORIG_DATA_SETUP;
+  AFFINE_SCAN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        stb5 = stb5_init;
+        {
+          const Index_type kfirst = 0;
+          const Index_type kstride = 1;
+          for (Index_type c = 0; c < nblocks; ++c ) {
+            AFFINE_SCAN_REDUCE_BODY(GEN_LIN_RECUR_ORIG_COEFS);
+          }
+          AFFINE_SCAN_BLOCKS(stb5);
+          for (Index_type c = 0; c < nblocks; ++c ) {
+            AFFINE_SCAN_RECOMPUTE_BODY(GEN_LIN_RECUR_ORIG_STEP, GEN_LIN_RECUR_ORIG_STORE);
+          }
+        }
+        {
+          const Index_type kfirst = N-1;
+          const Index_type kstride = -1;
+          for (Index_type c = 0; c < nblocks; ++c ) {
+            AFFINE_SCAN_REDUCE_BODY(GEN_LIN_RECUR_ORIG_COEFS);
+          }
+          AFFINE_SCAN_BLOCKS(block_x[nblocks]);
+          for (Index_type c = 0; c < nblocks; ++c ) {
+            AFFINE_SCAN_RECOMPUTE_BODY(GEN_LIN_RECUR_ORIG_STEP, GEN_LIN_RECUR_ORIG_STORE);
+          }
+        }
+        stb5 = block_x[nblocks];
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        stb5 = stb5_init;
+        {
+          const Index_type kfirst = 0;
+          const Index_type kstride = 1;
+          auto genlinrecur_reduce_lam = [=](Index_type c) {
+            AFFINE_SCAN_REDUCE_BODY(GEN_LIN_RECUR_ORIG_COEFS);
+          };
+          auto genlinrecur_recompute_lam = [=](Index_type c) {
+            AFFINE_SCAN_RECOMPUTE_BODY(GEN_LIN_RECUR_ORIG_STEP, GEN_LIN_RECUR_ORIG_STORE);
+          };
+
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(0, nblocks), genlinrecur_reduce_lam);
+          AFFINE_SCAN_BLOCKS(stb5);
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(0, nblocks), genlinrecur_recompute_lam);
+        }
+        {
+          const Index_type kfirst = N-1;
+          const Index_type kstride = -1;
+          auto genlinrecur_reduce_lam = [=](Index_type c) {
+            AFFINE_SCAN_REDUCE_BODY(GEN_LIN_RECUR_ORIG_COEFS);
+          };
+          auto genlinrecur_recompute_lam = [=](Index_type c) {
+            AFFINE_SCAN_RECOMPUTE_BODY(GEN_LIN_RECUR_ORIG_STEP, GEN_LIN_RECUR_ORIG_STORE);
+          };
+
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(0, nblocks), genlinrecur_reduce_lam);
+          AFFINE_SCAN_BLOCKS(block_x[nblocks]);
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(0, nblocks), genlinrecur_recompute_lam);
+        }
+        stb5 = block_x[nblocks];
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  GEN_LIN_RECUR_ORIG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  m_stb5 = stb5;
+
+}
+
+void GEN_LIN_RECUR_ORIG::runSeqVariantScanSimd(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 0;
+  const Index_type iend = m_N;
+
+  GEN_LIN_RECUR_ORIG_DATA_SETUP;
+  AFFINE_SCAN_SIMD_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        stb5 = stb5_init;
+        {
+          const Index_type kfirst = 0;
+          const Index_type kstride = 1;
+          for (Index_type c = 0; c < nblocks; ++c ) {
+            AFFINE_SCAN_PREFIX_BODY(GEN_LIN_RECUR_ORIG_COEFS);
+          }
+          AFFINE_SCAN_BLOCKS(stb5);
+          for (Index_type c = 0; c < nblocks; ++c ) {
+            AFFINE_SCAN_BLOCK_RANGE;
+            const Real_type xs = block_x[c];
+            for (Index_type i = bbegin; i < bend; ++i ) {
+              AFFINE_SCAN_APPLY_BODY(GEN_LIN_RECUR_ORIG_STORE);
+            }
+          }
+        }
+        {
+          const Index_type kfirst = N-1;
+          const Index_type kstride = -1;
+          for (Index_type c = 0; c < nblocks; ++c ) {
+            AFFINE_SCAN_PREFIX_BODY(GEN_LIN_RECUR_ORIG_COEFS);
+          }
+          AFFINE_SCAN_BLOCKS(block_x[nblocks]);
+          for (Index_type c = 0; c < nblocks; ++c ) {
+            AFFINE_SCAN_BLOCK_RANGE;
+            const Real_type xs = block_x[c];
+            for (Index_type i = bbegin; i < bend; ++i ) {
+              AFFINE_SCAN_APPLY_BODY(GEN_LIN_RECUR_ORIG_STORE);
+            }
+          }
+        }
+        stb5 = block_x[nblocks];
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        stb5 = stb5_init;
+        {
+          const Index_type kfirst = 0;
+          const Index_type kstride = 1;
+          auto genlinrecur_prefix_lam = [=](Index_type c) {
+            AFFINE_SCAN_PREFIX_BODY(GEN_LIN_RECUR_ORIG_COEFS);
+          };
+          auto genlinrecur_apply_lam = [=](Index_type c) {
+            AFFINE_SCAN_BLOCK_RANGE;
+            const Real_type xs = block_x[c];
+            RAJA::forall<RAJA::simd_exec>(
+              RAJA::RangeSegment(bbegin, bend), [=](Index_type i) {
+              AFFINE_SCAN_APPLY_BODY(GEN_LIN_RECUR_ORIG_STORE);
+            });
+          };
+
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(0, nblocks), genlinrecur_prefix_lam);
+          AFFINE_SCAN_BLOCKS(stb5);
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(0, nblocks), genlinrecur_apply_lam);
+        }
+        {
+          const Index_type kfirst = N-1;
+          const Index_type kstride = -1;
+          auto genlinrecur_prefix_lam = [=](Index_type c) {
+            AFFINE_SCAN_PREFIX_BODY(GEN_LIN_RECUR_ORIG_COEFS);
+          };
+          auto genlinrecur_apply_lam = [=](Index_type c) {
+            AFFINE_SCAN_BLOCK_RANGE;
+            const Real_type xs = block_x[c];
+            RAJA::forall<RAJA::simd_exec>(
+              RAJA::RangeSegment(bbegin, bend), [=](Index_type i) {
+              AFFINE_SCAN_APPLY_BODY(GEN_LIN_RECUR_ORIG_STORE);
+            });
+          };
+
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(0, nblocks), genlinrecur_prefix_lam);
+          AFFINE_SCAN_BLOCKS(block_x[nblocks]);
+          RAJA::forall<RAJA::loop_exec>(
+            RAJA::RangeSegment(0, nblocks), genlinrecur_apply_lam);
+        }
+        stb5 = block_x[nblocks];
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  GEN_LIN_RECUR_ORIG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+  m_stb5 = stb5;
+
+}
+
+void GEN_LIN_RECUR_ORIG::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  if ( tune_idx == 0 ) {
+    runSeqVariantSerial(vid);
+  } else if ( tune_idx == 1 ) {
+    runSeqVariantScan(vid);
+  } else {
+    runSeqVariantScanSimd(vid);
+  }
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
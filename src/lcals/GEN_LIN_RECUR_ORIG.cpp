@@ -0,0 +1,100 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "GEN_LIN_RECUR_ORIG.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/DataUtils.hpp"
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+GEN_LIN_RECUR_ORIG::GEN_LIN_RECUR_ORIG(const RunParams& params)
+  : KernelBase(rajaperf::Lcals_GEN_LIN_RECUR_ORIG, params)
+{
+  setDefaultProblemSize(1000000);
+  setDefaultReps(500);
+
+  setActualProblemSize( getTargetProblemSize() );
+
+  m_N = getActualProblemSize();
+
+  setItsPerRep( getActualProblemSize() );
+  setKernelsPerRep(2);
+  // scan_simd tunings also move the scan_p, scan_q scratch in both scans,
+  // see setUp
+  setBytesPerRep( (1*sizeof(Real_type ) + 2*sizeof(Real_type )) * m_N +
+                  (1*sizeof(Real_type ) + 2*sizeof(Real_type )) * m_N +
+                  2 * affine_scan::getSimdScratchBytes(m_N) );
+  setFLOPsPerRep((3 +
+                  3 ) * getActualProblemSize());
+
+  checksum_scale_factor = 0.01 *
+              ( static_cast<Checksum_type>(getDefaultProblemSize()) /
+                                           getActualProblemSize() );
+
+  setUsesFeature(Forall);
+
+  setVariantDefined( Base_Seq );
+  setVariantDefined( RAJA_Seq );
+
+  setVariantDefined( Base_OpenMP );
+  setVariantDefined( RAJA_OpenMP );
+}
+
+GEN_LIN_RECUR_ORIG::~GEN_LIN_RECUR_ORIG()
+{
+}
+
+void GEN_LIN_RECUR_ORIG::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "serial");
+  addVariantTuningName(vid, "scan");
+  addVariantTuningName(vid, "scan_simd");
+}
+
+void GEN_LIN_RECUR_ORIG::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, "scan");
+  addVariantTuningName(vid, "scan_simd");
+}
+
+void GEN_LIN_RECUR_ORIG::setUp(VariantID vid, size_t tune_idx)
+{
+  if ( getVariantTuningName(vid, tune_idx) != "scan_simd" ) {
+    recordBytesSaved(vid, tune_idx, 2 * affine_scan::getSimdScratchBytes(m_N));
+  }
+
+  m_stb5_init = 0.1;
+  m_stb5 = m_stb5_init;
+
+  allocAndInitDataConst(m_b5, m_N, 0.0, vid);
+  allocAndInitData(m_sa, m_N, vid);
+  allocAndInitData(m_sb, m_N, vid);
+}
+
+void GEN_LIN_RECUR_ORIG::updateChecksum(VariantID vid, size_t tune_idx)
+{
+  checksum[vid][tune_idx] += calcChecksum(m_b5, getActualProblemSize(), checksum_scale_factor );
+  checksum[vid][tune_idx] += m_stb5;
+}
+
+void GEN_LIN_RECUR_ORIG::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+  (void) vid;
+  deallocData(m_b5);
+  deallocData(m_sa);
+  deallocData(m_sb);
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
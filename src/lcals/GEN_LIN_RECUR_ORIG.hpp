@@ -0,0 +1,131 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+///
+/// GEN_LIN_RECUR_ORIG kernel reference implementation:
+///
+/// The original form of GEN_LIN_RECUR, with stb5 a scalar carried from
+/// each iteration to the next and through both loops:
+///
+/// for (Index_type k = 0; k < N; ++k ) {
+///   b5[k] = sa[k] + stb5*sb[k];
+///   stb5 = b5[k] - stb5;
+/// }
+///
+/// for (Index_type i = 1; i < N+1; ++i ) {
+///   Index_type k = N - i ;
+///   b5[k] = sa[k] + stb5*sb[k];
+///   stb5 = b5[k] - stb5;
+/// }
+///
+/// Both loops are written below as k = kfirst + kstride*i, i in [0, N).
+/// stb5 starts from the same value in every repetition.
+///
+/// Tunings:
+///   serial    -- Seq only, the loop above
+///   scan      -- the recurrence as a parallel affine scan over blocks of
+///                iterations, each block reruns the loop from its first value
+///   scan_simd -- the same, but each value is computed directly from the
+///                value before its block, vectorizable within blocks
+/// (see common/ScanUtils.hpp). The scan tunings reassociate the arithmetic
+/// so they match the serial tuning to rounding only.
+///
+
+#ifndef RAJAPerf_Lcals_GEN_LIN_RECUR_ORIG_HPP
+#define RAJAPerf_Lcals_GEN_LIN_RECUR_ORIG_HPP
+
+
+#define GEN_LIN_RECUR_ORIG_DATA_SETUP \
+  Real_ptr b5 = m_b5; \
+  Real_ptr sa = m_sa; \
+  Real_ptr sb = m_sb; \
+  const Real_type stb5_init = m_stb5_init; \
+  Real_type stb5 = stb5_init; \
+\
+  Index_type N = m_N;
+
+#define GEN_LIN_RECUR_ORIG_K  (kfirst + kstride*i)
+
+#define GEN_LIN_RECUR_ORIG_BODY  \
+  b5[GEN_LIN_RECUR_ORIG_K] = sa[GEN_LIN_RECUR_ORIG_K] + stb5*sb[GEN_LIN_RECUR_ORIG_K]; \
+  stb5 = b5[GEN_LIN_RECUR_ORIG_K] - stb5;
+
+// stb5 = a * stb5 + b, and the body as a step from xold = stb5
+#define GEN_LIN_RECUR_ORIG_COEFS  \
+  const Real_type a = sb[GEN_LIN_RECUR_ORIG_K] - 1.0; \
+  const Real_type b = sa[GEN_LIN_RECUR_ORIG_K];
+
+#define GEN_LIN_RECUR_ORIG_STEP  \
+  const Real_type xnew = ( sa[GEN_LIN_RECUR_ORIG_K] + xold*sb[GEN_LIN_RECUR_ORIG_K] ) - xold;
+
+#define GEN_LIN_RECUR_ORIG_STORE  \
+  b5[GEN_LIN_RECUR_ORIG_K] = sa[GEN_LIN_RECUR_ORIG_K] + xold*sb[GEN_LIN_RECUR_ORIG_K];
+
+
+#include "common/KernelBase.hpp"
+#include "common/ScanUtils.hpp"
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace lcals
+{
+
+class GEN_LIN_RECUR_ORIG : public KernelBase
+{
+public:
+
+  GEN_LIN_RECUR_ORIG(const RunParams& params);
+
+  ~GEN_LIN_RECUR_ORIG();
+
+  void setUp(VariantID vid, size_t tune_idx);
+  void updateChecksum(VariantID vid, size_t tune_idx);
+  void tearDown(VariantID vid, size_t tune_idx);
+
+  void runSeqVariant(VariantID vid, size_t tune_idx);
+  void runOpenMPVariant(VariantID vid, size_t tune_idx);
+  void runCudaVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  GEN_LIN_RECUR_ORIG : Unknown Cuda variant id = " << vid << std::endl;
+  }
+  void runHipVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  GEN_LIN_RECUR_ORIG : Unknown Hip variant id = " << vid << std::endl;
+  }
+  void runOpenMPTargetVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+  {
+    getCout() << "\n  GEN_LIN_RECUR_ORIG : Unknown OMP Target variant id = " << vid << std::endl;
+  }
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+
+  void runSeqVariantSerial(VariantID vid);
+  void runSeqVariantScan(VariantID vid);
+  void runSeqVariantScanSimd(VariantID vid);
+
+  void runOpenMPVariantScan(VariantID vid);
+  void runOpenMPVariantScanSimd(VariantID vid);
+
+private:
+  Real_ptr m_b5;
+  Real_ptr m_sa;
+  Real_ptr m_sb;
+
+  Real_type m_stb5_init;
+  Real_type m_stb5;
+
+  Index_type m_N;
+};
+
+} // end namespace lcals
+} // end namespace rajaperf
+
+#endif // closing endif for header file include guard
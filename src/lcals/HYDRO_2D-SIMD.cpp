@@ -0,0 +1,128 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "HYDRO_2D.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include "common/SIMDUtils.hpp"
+
+#include <iostream>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+void HYDRO_2D::runSIMDVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+{
+#if defined(RUN_SIMD)
+
+  const Index_type run_reps = getRunReps();
+  const Index_type kbeg = 1;
+  const Index_type kend = m_kn - 1;
+  const Index_type jbeg = 1;
+  const Index_type jend = m_jn - 1;
+
+  HYDRO_2D_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_SIMD : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = kbeg; k < kend; ++k ) {
+          #pragma omp simd simdlen(RAJAPERF_SIMD_WIDTH)
+          for (Index_type j = jbeg; j < jend; ++j ) {
+            HYDRO_2D_BODY1;
+          }
+        }
+
+        for (Index_type k = kbeg; k < kend; ++k ) {
+          #pragma omp simd simdlen(RAJAPERF_SIMD_WIDTH)
+          for (Index_type j = jbeg; j < jend; ++j ) {
+            HYDRO_2D_BODY2;
+          }
+        }
+
+        for (Index_type k = kbeg; k < kend; ++k ) {
+          #pragma omp simd simdlen(RAJAPERF_SIMD_WIDTH)
+          for (Index_type j = jbeg; j < jend; ++j ) {
+            HYDRO_2D_BODY3;
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_SIMD : {
+
+      HYDRO_2D_VIEWS_RAJA;
+
+      auto hydro2d_lam1 = [=] (Index_type k, Index_type j) {
+                            HYDRO_2D_BODY1_RAJA;
+                          };
+      auto hydro2d_lam2 = [=] (Index_type k, Index_type j) {
+                            HYDRO_2D_BODY2_RAJA;
+                          };
+      auto hydro2d_lam3 = [=] (Index_type k, Index_type j) {
+                            HYDRO_2D_BODY3_RAJA;
+                          };
+
+      using EXECPOL =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<0, RAJA::loop_exec,  // k
+            RAJA::statement::For<1, RAJA::simd_exec,  // j
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXECPOL>(
+                     RAJA::make_tuple( RAJA::RangeSegment(kbeg, kend),
+                                       RAJA::RangeSegment(jbeg, jend)),
+                     hydro2d_lam1);
+
+        RAJA::kernel<EXECPOL>(
+                     RAJA::make_tuple( RAJA::RangeSegment(kbeg, kend),
+                                       RAJA::RangeSegment(jbeg, jend)),
+                     hydro2d_lam2);
+
+        RAJA::kernel<EXECPOL>(
+                     RAJA::make_tuple( RAJA::RangeSegment(kbeg, kend),
+                                       RAJA::RangeSegment(jbeg, jend)),
+                     hydro2d_lam3);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  HYDRO_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
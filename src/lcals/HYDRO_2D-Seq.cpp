@@ -10,6 +10,7 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include <algorithm>
 #include <iostream>
 
 namespace rajaperf
@@ -18,7 +19,7 @@ namespace lcals
 {
 
 
-void HYDRO_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void HYDRO_2D::runSeqVariantDefault(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
   const Index_type kbeg = 1;
@@ -155,5 +156,433 @@ void HYDRO_2D::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx)
 
 }
 
+
+#if defined(RUN_RAJA_SEQ)
+//
+// RAJA kernel policies for the tiled and fused tunings, k is argument 0
+// and j is argument 1.
+//
+template < size_t tile_size >
+using Hydro2DSeqTilePolicy =
+  RAJA::KernelPolicy<
+    RAJA::statement::Tile<0, RAJA::tile_fixed<tile_size>, RAJA::loop_exec,
+      RAJA::statement::Tile<1, RAJA::tile_fixed<tile_size>, RAJA::loop_exec,
+        RAJA::statement::For<0, RAJA::loop_exec,                         // k
+          RAJA::statement::For<1, RAJA::loop_exec,                       // j
+            RAJA::statement::Lambda<0>
+          >
+        >
+      >
+    >
+  >;
+
+//
+// The first nest skips the first row of each tile, param 0 is the row
+// within the tile, which is computed before the tiles run.
+//
+template < size_t tile_size >
+using Hydro2DSeqFusedPolicy =
+  RAJA::KernelPolicy<
+    RAJA::statement::Tile<0, RAJA::tile_fixed<tile_size>, RAJA::loop_exec,
+      RAJA::statement::Tile<1, RAJA::tile_fixed<tile_size>, RAJA::loop_exec,
+        RAJA::statement::ForICount<0, RAJA::statement::Param<0>,
+                                   RAJA::loop_exec,                      // k
+          RAJA::statement::For<1, RAJA::loop_exec,                       // j
+            RAJA::statement::Lambda<0, RAJA::Segs<0,1>, RAJA::Params<0>>
+          >
+        >,
+        RAJA::statement::For<0, RAJA::loop_exec,                         // k
+          RAJA::statement::For<1, RAJA::loop_exec,                       // j
+            RAJA::statement::Lambda<1, RAJA::Segs<0,1>>
+          >
+        >,
+        RAJA::statement::For<0, RAJA::loop_exec,                         // k
+          RAJA::statement::For<1, RAJA::loop_exec,                       // j
+            RAJA::statement::Lambda<2, RAJA::Segs<0,1>>
+          >
+        >
+      >
+    >
+  >;
+#endif // RUN_RAJA_SEQ
+
+
+template < size_t tile_size >
+void HYDRO_2D::runSeqVariantTiled(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type kbeg = 1;
+  const Index_type kend = m_kn - 1;
+  const Index_type jbeg = 1;
+  const Index_type jend = m_jn - 1;
+
+  HYDRO_2D_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type kk = kbeg; kk < kend; kk += tile_size ) {
+          const Index_type ktile_end = std::min(kk + Index_type(tile_size), kend);
+          for (Index_type jj = jbeg; jj < jend; jj += tile_size ) {
+            const Index_type jtile_end = std::min(jj + Index_type(tile_size), jend);
+            for (Index_type k = kk; k < ktile_end; ++k ) {
+              for (Index_type j = jj; j < jtile_end; ++j ) {
+                HYDRO_2D_BODY1;
+              }
+            }
+          }
+        }
+
+        for (Index_type kk = kbeg; kk < kend; kk += tile_size ) {
+          const Index_type ktile_end = std::min(kk + Index_type(tile_size), kend);
+          for (Index_type jj = jbeg; jj < jend; jj += tile_size ) {
+            const Index_type jtile_end = std::min(jj + Index_type(tile_size), jend);
+            for (Index_type k = kk; k < ktile_end; ++k ) {
+              for (Index_type j = jj; j < jtile_end; ++j ) {
+                HYDRO_2D_BODY2;
+              }
+            }
+          }
+        }
+
+        for (Index_type kk = kbeg; kk < kend; kk += tile_size ) {
+          const Index_type ktile_end = std::min(kk + Index_type(tile_size), kend);
+          for (Index_type jj = jbeg; jj < jend; jj += tile_size ) {
+            const Index_type jtile_end = std::min(jj + Index_type(tile_size), jend);
+            for (Index_type k = kk; k < ktile_end; ++k ) {
+              for (Index_type j = jj; j < jtile_end; ++j ) {
+                HYDRO_2D_BODY3;
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto hydro2d_base_lam1 = [=] (Index_type k, Index_type j) {
+                                 HYDRO_2D_BODY1;
+                               };
+      auto hydro2d_base_lam2 = [=] (Index_type k, Index_type j) {
+                                 HYDRO_2D_BODY2;
+                               };
+      auto hydro2d_base_lam3 = [=] (Index_type k, Index_type j) {
+                                 HYDRO_2D_BODY3;
+                               };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type kk = kbeg; kk < kend; kk += tile_size ) {
+          const Index_type ktile_end = std::min(kk + Index_type(tile_size), kend);
+          for (Index_type jj = jbeg; jj < jend; jj += tile_size ) {
+            const Index_type jtile_end = std::min(jj + Index_type(tile_size), jend);
+            for (Index_type k = kk; k < ktile_end; ++k ) {
+              for (Index_type j = jj; j < jtile_end; ++j ) {
+                hydro2d_base_lam1(k, j);
+              }
+            }
+          }
+        }
+
+        for (Index_type kk = kbeg; kk < kend; kk += tile_size ) {
+          const Index_type ktile_end = std::min(kk + Index_type(tile_size), kend);
+          for (Index_type jj = jbeg; jj < jend; jj += tile_size ) {
+            const Index_type jtile_end = std::min(jj + Index_type(tile_size), jend);
+            for (Index_type k = kk; k < ktile_end; ++k ) {
+              for (Index_type j = jj; j < jtile_end; ++j ) {
+                hydro2d_base_lam2(k, j);
+              }
+            }
+          }
+        }
+
+        for (Index_type kk = kbeg; kk < kend; kk += tile_size ) {
+          const Index_type ktile_end = std::min(kk + Index_type(tile_size), kend);
+          for (Index_type jj = jbeg; jj < jend; jj += tile_size ) {
+            const Index_type jtile_end = std::min(jj + Index_type(tile_size), jend);
+            for (Index_type k = kk; k < ktile_end; ++k ) {
+              for (Index_type j = jj; j < jtile_end; ++j ) {
+                hydro2d_base_lam3(k, j);
+              }
+            }
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      HYDRO_2D_VIEWS_RAJA;
+
+      auto hydro2d_lam1 = [=] (Index_type k, Index_type j) {
+                            HYDRO_2D_BODY1_RAJA;
+                          };
+      auto hydro2d_lam2 = [=] (Index_type k, Index_type j) {
+                            HYDRO_2D_BODY2_RAJA;
+                          };
+      auto hydro2d_lam3 = [=] (Index_type k, Index_type j) {
+                            HYDRO_2D_BODY3_RAJA;
+                          };
+
+      using EXECPOL = Hydro2DSeqTilePolicy<tile_size>;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXECPOL>(
+                     RAJA::make_tuple( RAJA::RangeSegment(kbeg, kend),
+                                       RAJA::RangeSegment(jbeg, jend)),
+                     hydro2d_lam1);
+
+        RAJA::kernel<EXECPOL>(
+                     RAJA::make_tuple( RAJA::RangeSegment(kbeg, kend),
+                                       RAJA::RangeSegment(jbeg, jend)),
+                     hydro2d_lam2);
+
+        RAJA::kernel<EXECPOL>(
+                     RAJA::make_tuple( RAJA::RangeSegment(kbeg, kend),
+                                       RAJA::RangeSegment(jbeg, jend)),
+                     hydro2d_lam3);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  HYDRO_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+template < size_t tile_size >
+void HYDRO_2D::runSeqVariantFused(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type kbeg = 1;
+  const Index_type kend = m_kn - 1;
+  const Index_type jbeg = 1;
+  const Index_type jend = m_jn - 1;
+
+  HYDRO_2D_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = kbeg; k < kend; k += tile_size ) {
+          for (Index_type j = jbeg; j < jend; ++j ) {
+            HYDRO_2D_BODY1;
+          }
+        }
+
+        for (Index_type kk = kbeg; kk < kend; kk += tile_size ) {
+          const Index_type ktile_end = std::min(kk + Index_type(tile_size), kend);
+          for (Index_type jj = jbeg; jj < jend; jj += tile_size ) {
+            const Index_type jtile_end = std::min(jj + Index_type(tile_size), jend);
+
+            for (Index_type k = kk + 1; k < ktile_end; ++k ) {
+              for (Index_type j = jj; j < jtile_end; ++j ) {
+                HYDRO_2D_BODY1;
+              }
+            }
+
+            for (Index_type k = kk; k < ktile_end; ++k ) {
+              for (Index_type j = jj; j < jtile_end; ++j ) {
+                HYDRO_2D_BODY2;
+              }
+            }
+
+            for (Index_type k = kk; k < ktile_end; ++k ) {
+              for (Index_type j = jj; j < jtile_end; ++j ) {
+                HYDRO_2D_BODY3;
+              }
+            }
+
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case Lambda_Seq : {
+
+      auto hydro2d_base_lam1 = [=] (Index_type k, Index_type j) {
+                                 HYDRO_2D_BODY1;
+                               };
+      auto hydro2d_base_lam2 = [=] (Index_type k, Index_type j) {
+                                 HYDRO_2D_BODY2;
+                               };
+      auto hydro2d_base_lam3 = [=] (Index_type k, Index_type j) {
+                                 HYDRO_2D_BODY3;
+                               };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type k = kbeg; k < kend; k += tile_size ) {
+          for (Index_type j = jbeg; j < jend; ++j ) {
+            hydro2d_base_lam1(k, j);
+          }
+        }
+
+        for (Index_type kk = kbeg; kk < kend; kk += tile_size ) {
+          const Index_type ktile_end = std::min(kk + Index_type(tile_size), kend);
+          for (Index_type jj = jbeg; jj < jend; jj += tile_size ) {
+            const Index_type jtile_end = std::min(jj + Index_type(tile_size), jend);
+
+            for (Index_type k = kk + 1; k < ktile_end; ++k ) {
+              for (Index_type j = jj; j < jtile_end; ++j ) {
+                hydro2d_base_lam1(k, j);
+              }
+            }
+
+            for (Index_type k = kk; k < ktile_end; ++k ) {
+              for (Index_type j = jj; j < jtile_end; ++j ) {
+                hydro2d_base_lam2(k, j);
+              }
+            }
+
+            for (Index_type k = kk; k < ktile_end; ++k ) {
+              for (Index_type j = jj; j < jtile_end; ++j ) {
+                hydro2d_base_lam3(k, j);
+              }
+            }
+
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_Seq : {
+
+      HYDRO_2D_VIEWS_RAJA;
+
+      auto hydro2d_lam1 = [=] (Index_type k, Index_type j) {
+                            HYDRO_2D_BODY1_RAJA;
+                          };
+      auto hydro2d_fused_lam1 = [=] (Index_type k, Index_type j,
+                                     Index_type k_in_tile) {
+                                  if (k_in_tile > 0) {
+                                    HYDRO_2D_BODY1_RAJA;
+                                  }
+                                };
+      auto hydro2d_lam2 = [=] (Index_type k, Index_type j) {
+                            HYDRO_2D_BODY2_RAJA;
+                          };
+      auto hydro2d_lam3 = [=] (Index_type k, Index_type j) {
+                            HYDRO_2D_BODY3_RAJA;
+                          };
+
+      using EXECPOL_ROWS =
+        RAJA::KernelPolicy<
+          RAJA::statement::For<0, RAJA::loop_exec,  // k
+            RAJA::statement::For<1, RAJA::loop_exec,  // j
+              RAJA::statement::Lambda<0>
+            >
+          >
+        >;
+
+      using EXECPOL = Hydro2DSeqFusedPolicy<tile_size>;
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::kernel<EXECPOL_ROWS>(
+                     RAJA::make_tuple( RAJA::RangeStrideSegment(kbeg, kend, tile_size),
+                                       RAJA::RangeSegment(jbeg, jend)),
+                     hydro2d_lam1);
+
+        RAJA::kernel_param<EXECPOL>(
+                     RAJA::make_tuple( RAJA::RangeSegment(kbeg, kend),
+                                       RAJA::RangeSegment(jbeg, jend)),
+                     RAJA::make_tuple(static_cast<Index_type>(0)),
+                     hydro2d_fused_lam1,
+                     hydro2d_lam2,
+                     hydro2d_lam3);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  HYDRO_2D : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void HYDRO_2D::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runSeqVariantDefault(vid);
+  }
+
+  t += 1;
+
+  seq_for(tile_sizes_type{}, [&](auto tile_size) {
+    if (tune_idx == t) {
+      runSeqVariantTiled<tile_size>(vid);
+    }
+    t += 1;
+  });
+
+  seq_for(tile_sizes_type{}, [&](auto tile_size) {
+    if (tune_idx == t) {
+      runSeqVariantFused<tile_size>(vid);
+    }
+    t += 1;
+  });
+}
+
+void HYDRO_2D::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  seq_for(tile_sizes_type{}, [&](auto tile_size) {
+    addVariantTuningName(vid, "tiled_"+std::to_string(tile_size));
+  });
+
+  seq_for(tile_sizes_type{}, [&](auto tile_size) {
+    addVariantTuningName(vid, "fused_"+std::to_string(tile_size));
+  });
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -38,6 +38,24 @@
 ///   }
 /// }
 ///
+/// Seq and OpenMP variants have tunings that tile the k, j space with
+/// square tiles so the working set of a tile fits in cache:
+///
+/// tiled_<size> -- each of the three loop nests runs tile by tile, still
+///                 streaming all arrays through memory once per nest.
+///
+/// fused_<size> -- the three loop nests are fused tile by tile, so za, zb,
+///                 zu and zv are read back from cache by the next nest.
+///                 The second nest at (k,j) reads za at (k,j-1) and zb at
+///                 (k+1,j): the j halo comes from the previous tile in the
+///                 same row of tiles, which the same thread runs first, and
+///                 the k halo is the first row of the next row of tiles.
+///                 Those first rows are computed by the first nest before
+///                 the tiles run, so tiles running concurrently never write
+///                 the same points and results match the default tuning.
+///
+/// The RAJA variants express the tiling with RAJA::statement::Tile.
+///
 
 #ifndef RAJAPerf_Lcals_HYDRO_2D_HPP
 #define RAJAPerf_Lcals_HYDRO_2D_HPP
@@ -154,6 +172,23 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
+  void runThreadPoolVariant(VariantID vid, size_t tune_idx);
+  void runStdParVariant(VariantID vid, size_t tune_idx);
+  void runSIMDVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  template < size_t tile_size >
+  void runSeqVariantTiled(VariantID vid);
+  template < size_t tile_size >
+  void runSeqVariantFused(VariantID vid);
+
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < size_t tile_size >
+  void runOpenMPVariantTiled(VariantID vid);
+  template < size_t tile_size >
+  void runOpenMPVariantFused(VariantID vid);
 
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
@@ -167,6 +202,12 @@ private:
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size,
                                                          gpu_block_size::MultipleOf<32>>;
 
+  //
+  // Tile edge lengths; a 32x32 tile of the eleven arrays fits in L1 or L2
+  // and a 128x128 tile in a large L2.
+  //
+  using tile_sizes_type = camp::int_seq<size_t, 32, 128>;
+
   Real_ptr m_za;
   Real_ptr m_zb;
   Real_ptr m_zm;
@@ -18,7 +18,7 @@ namespace lcals
 {
 
 
-void INT_PREDICT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void INT_PREDICT::runOpenMPVariantDefault(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -91,5 +91,105 @@ void INT_PREDICT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tun
 #endif
 }
 
+template < size_t aosoa_width >
+void INT_PREDICT::runOpenMPVariantAoSoA(VariantID vid)
+{
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+  const Index_type run_reps = getRunReps();
+
+  INT_PREDICT_DATA_SETUP;
+  INT_PREDICT_AOSOA_DATA_SETUP;
+
+  auto intpredict_aosoa_lam = [=](Index_type blk) {
+                          INT_PREDICT_AOSOA_BODY;
+                        };
+
+  switch ( vid ) {
+
+    case Base_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type blk = 0; blk < nblocks; ++blk ) {
+          INT_PREDICT_AOSOA_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case Lambda_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        #pragma omp parallel for
+        for (Index_type blk = 0; blk < nblocks; ++blk ) {
+          intpredict_aosoa_lam(blk);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    case RAJA_OpenMP : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::omp_parallel_for_exec>(
+          RAJA::RangeSegment(0, nblocks), intpredict_aosoa_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+    default : {
+      getCout() << "\n  INT_PREDICT : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+#else
+  RAJA_UNUSED_VAR(vid);
+#endif
+}
+
+void INT_PREDICT::runOpenMPVariant(VariantID vid, size_t tune_idx)
+{
+  size_t t = 0;
+
+  if (tune_idx == t) {
+    runOpenMPVariantDefault(vid);
+  }
+
+  t += 1;
+
+  seq_for(aosoa_widths_type{}, [&](auto aosoa_width) {
+    if (tune_idx == t) {
+      runOpenMPVariantAoSoA<aosoa_width>(vid);
+    }
+    t += 1;
+  });
+}
+
+void INT_PREDICT::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+
+  seq_for(aosoa_widths_type{}, [&](auto aosoa_width) {
+    addVariantTuningName(vid, getLayoutTuningName(aosoa_width));
+  });
+}
+
 } // end namespace lcals
 } // end namespace rajaperf
@@ -12,6 +12,8 @@
 
 #include "common/DataUtils.hpp"
 
+#include <vector>
+
 namespace rajaperf
 {
 namespace lcals
@@ -51,16 +53,45 @@ INT_PREDICT::INT_PREDICT(const RunParams& params)
   setVariantDefined( RAJA_HIP );
 
   setVariantDefined( Kokkos_Lambda );
+
+  setVariantDefined( Base_ThreadPool );
+  setVariantDefined( Lambda_ThreadPool );
+
+  setVariantDefined( Base_StdPar );
+  setVariantDefined( Lambda_StdPar );
+
+  setVariantDefined( Base_SIMD );
+  setVariantDefined( RAJA_SIMD );
 }
 
 INT_PREDICT::~INT_PREDICT()
 {
 }
 
-void INT_PREDICT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+Index_type INT_PREDICT::getLayoutWidth(VariantID vid, size_t tune_idx) const
 {
-  m_array_length = getActualProblemSize() * 13;
-  m_offset = getActualProblemSize();
+  const std::string& tuning_name = getVariantTuningName(vid, tune_idx);
+
+  // struct of arrays, one block of the whole problem size
+  Index_type width = getActualProblemSize();
+
+  seq_for(aosoa_widths_type{}, [&](auto aosoa_width) {
+    if ( tuning_name == getLayoutTuningName(aosoa_width) ) {
+      width = aosoa_width;
+    }
+  });
+
+  return width;
+}
+
+void INT_PREDICT::setUp(VariantID vid, size_t tune_idx)
+{
+  const Index_type len = getActualProblemSize();
+
+  m_offset = len;
+  m_layout_width = getLayoutWidth(vid, tune_idx);
+  m_array_length = 13 * m_layout_width *
+                   ( (len + m_layout_width - 1) / m_layout_width );
 
   m_px_initval = 1.0;
   allocAndInitDataConst(m_px, m_array_length, m_px_initval, vid);
@@ -77,11 +108,22 @@ void INT_PREDICT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 void INT_PREDICT::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  for (Index_type i = 0; i < getActualProblemSize(); ++i) {
-    m_px[i] -= m_px_initval;
-  }
+  const Index_type len = getActualProblemSize();
 
-  checksum[vid][tune_idx] += calcChecksum(m_px, getActualProblemSize());
+  if ( m_layout_width == len ) {
+    for (Index_type i = 0; i < len; ++i) {
+      m_px[i] -= m_px_initval;
+    }
+
+    checksum[vid][tune_idx] += calcChecksum(m_px, len);
+  } else {
+    std::vector<Real_type> px(len);
+    for (Index_type i = 0; i < len; ++i) {
+      px[i] = m_px[getLayoutIndex(i, 0)] - m_px_initval;
+    }
+
+    checksum[vid][tune_idx] += calcChecksum(px.data(), len);
+  }
 }
 
 void INT_PREDICT::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
@@ -20,6 +20,15 @@
 ///           px[i + offset *  2];
 /// }
 ///
+/// The 13 planes of px are offset apart, a struct of arrays layout that
+/// reads 10 streams at once. Seq and OpenMP variants have tunings that
+/// store them instead as an array of structs, px[i*13 + k] ('aos'), or as
+/// an array of structs of arrays holding blocks of a SIMD width of
+/// elements ('aosoa_<width>'). The checksum is of the first plane in
+/// element order, so the checksums of all tunings agree; arrays in the
+/// AoSoA layout are padded to whole blocks and the padding is computed on
+/// but left out of the checksum.
+///
 
 #ifndef RAJAPerf_Lcals_INT_PREDICT_HPP
 #define RAJAPerf_Lcals_INT_PREDICT_HPP
@@ -37,13 +46,36 @@
   Real_type c0 = m_c0; \
   const Index_type offset = m_offset;
 
+//
+// Index of plane k of element i in each layout. The AoSoA layout stores
+// blocks of width elements, each block holding its 13 planes one after
+// another; blk_offset is the start of the block and lane is the position
+// of the element in it. With width 1 it is the array of structs layout.
+//
+#define INT_PREDICT_SOA_IDX(k)  (i + offset * (k))
+#define INT_PREDICT_AOSOA_IDX(k)  (blk_offset + (k) * width + lane)
+
+#define INT_PREDICT_BODY_LAYOUT(idx)  \
+  px[idx(0)] = dm28*px[idx(12)] + dm27*px[idx(11)] + \
+               dm26*px[idx(10)] + dm25*px[idx(9)] + \
+               dm24*px[idx(8)] + dm23*px[idx(7)] + \
+               dm22*px[idx(6)] + \
+               c0*( px[idx(4)] + px[idx(5)] ) + \
+               px[idx(2)];
+
 #define INT_PREDICT_BODY  \
-  px[i] = dm28*px[i + offset * 12] + dm27*px[i + offset * 11] + \
-          dm26*px[i + offset * 10] + dm25*px[i + offset *  9] + \
-          dm24*px[i + offset *  8] + dm23*px[i + offset *  7] + \
-          dm22*px[i + offset *  6] + \
-          c0*( px[i + offset *  4] + px[i + offset *  5] ) + \
-          px[i + offset *  2];
+  INT_PREDICT_BODY_LAYOUT(INT_PREDICT_SOA_IDX)
+
+// nblocks blocks of width elements cover the offset elements of a plane
+#define INT_PREDICT_AOSOA_DATA_SETUP \
+  const Index_type width = aosoa_width; \
+  const Index_type nblocks = (offset + width - 1) / width;
+
+#define INT_PREDICT_AOSOA_BODY  \
+  const Index_type blk_offset = blk * 13 * width; \
+  for (Index_type lane = 0; lane < width; ++lane ) { \
+    INT_PREDICT_BODY_LAYOUT(INT_PREDICT_AOSOA_IDX); \
+  }
 
 
 #include "common/KernelBase.hpp"
@@ -73,6 +105,19 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
+  void runThreadPoolVariant(VariantID vid, size_t tune_idx);
+  void runStdParVariant(VariantID vid, size_t tune_idx);
+  void runSIMDVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  void runSeqVariantDefault(VariantID vid);
+  template < size_t aosoa_width >
+  void runSeqVariantAoSoA(VariantID vid);
+
+  void setOpenMPTuningDefinitions(VariantID vid);
+  void runOpenMPVariantDefault(VariantID vid);
+  template < size_t aosoa_width >
+  void runOpenMPVariantAoSoA(VariantID vid);
 
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
@@ -85,8 +130,29 @@ private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  //
+  // Block widths of the AoSoA layout tunings; a block width of 1 is the
+  // array of structs layout.
+  //
+  using aosoa_widths_type = camp::int_seq<size_t, 1, 4, 8>;
+
+  static std::string getLayoutTuningName(size_t aosoa_width)
+  {
+    return (aosoa_width == 1) ? std::string("aos")
+                              : "aosoa_" + std::to_string(aosoa_width);
+  }
+
+  Index_type getLayoutWidth(VariantID vid, size_t tune_idx) const;
+
+  Index_type getLayoutIndex(Index_type i, Index_type k) const
+  {
+    return (i / m_layout_width) * 13 * m_layout_width +
+           k * m_layout_width + i % m_layout_width;
+  }
+
   Index_type m_array_length;
   Index_type m_offset;
+  Index_type m_layout_width;
 
   Real_ptr m_px;
   Real_type m_px_initval;
@@ -12,6 +12,9 @@
 
 #include "common/DataUtils.hpp"
 
+#include <cmath>
+#include <vector>
+
 namespace rajaperf
 {
 namespace lcals
@@ -51,12 +54,43 @@ PLANCKIAN::PLANCKIAN(const RunParams& params)
   setVariantDefined( RAJA_HIP );
 
   setVariantDefined( Kokkos_Lambda );
+
+  setVariantDefined( Base_ThreadPool );
+  setVariantDefined( Lambda_ThreadPool );
+
+  setVariantDefined( Base_StdPar );
+  setVariantDefined( Lambda_StdPar );
+
+  setVariantDefined( Base_SIMD );
+  setVariantDefined( RAJA_SIMD );
 }
 
 PLANCKIAN::~PLANCKIAN()
 {
 }
 
+void PLANCKIAN::setSeqTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+#if defined(RAJAPERF_USE_LIBMVEC)
+  addVariantTuningName(vid, "simd_libm");
+#endif
+  seq_for(fastmath::ulps_type{}, [&](auto ulps) {
+    addVariantTuningName(vid, fastmath::getPolyTuningName(ulps));
+  });
+}
+
+void PLANCKIAN::setOpenMPTuningDefinitions(VariantID vid)
+{
+  addVariantTuningName(vid, getDefaultTuningName());
+#if defined(RAJAPERF_USE_LIBMVEC)
+  addVariantTuningName(vid, "simd_libm");
+#endif
+  seq_for(fastmath::ulps_type{}, [&](auto ulps) {
+    addVariantTuningName(vid, fastmath::getPolyTuningName(ulps));
+  });
+}
+
 void PLANCKIAN::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 {
   allocAndInitData(m_x, getActualProblemSize(), vid);
@@ -68,7 +102,16 @@ void PLANCKIAN::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 void PLANCKIAN::updateChecksum(VariantID vid, size_t tune_idx)
 {
-  checksum[vid][tune_idx] += calcChecksum(m_w, getActualProblemSize());
+  const Index_type len = getActualProblemSize();
+
+  checksum[vid][tune_idx] += calcChecksum(m_w, len);
+
+  std::vector<Real_type> w_ref(len);
+  for (Index_type i = 0; i < len; ++i) {
+    w_ref[i] = m_x[i] / ( std::exp( m_u[i] / m_v[i] ) - 1.0 );
+  }
+  recordULPError(vid, tune_idx,
+                 fastmath::calcMaxULPError(m_w, w_ref.data(), len));
 }
 
 void PLANCKIAN::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
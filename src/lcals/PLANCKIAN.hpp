@@ -14,6 +14,15 @@
 ///   w[i] = x[i] / ( exp( y[i] ) - 1.0 );
 /// }
 ///
+/// Seq and OpenMP tunings (see common/FastMath.hpp):
+///   default      -- the loop above, with std::exp
+///   simd_libm    -- the loop above in an omp simd loop, calling the
+///                   libmvec vector exp; only with RAJA_PERFSUITE_ENABLE_LIBMVEC
+///   poly_<U>ulp  -- fastmath::exp<U>, inlined and vectorized
+///
+/// The largest error of w against std::exp, in ULPs, is written to the
+/// ULP error report.
+///
 
 #ifndef RAJAPerf_Lcals_PLANCKIAN_HPP
 #define RAJAPerf_Lcals_PLANCKIAN_HPP
@@ -30,8 +39,17 @@
   y[i] = u[i] / v[i]; \
   w[i] = x[i] / ( exp( y[i] ) - 1.0 );
 
+#define PLANCKIAN_SIMD_LIBM_BODY  \
+  y[i] = u[i] / v[i]; \
+  w[i] = x[i] / ( rajaperf_libmvec_exp( y[i] ) - 1.0 );
+
+#define PLANCKIAN_POLY_BODY(ulps)  \
+  y[i] = u[i] / v[i]; \
+  w[i] = x[i] / ( fastmath::exp<ulps>( y[i] ) - 1.0 );
+
 
 #include "common/KernelBase.hpp"
+#include "common/FastMath.hpp"
 
 namespace rajaperf
 {
@@ -58,7 +76,12 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
+  void runThreadPoolVariant(VariantID vid, size_t tune_idx);
+  void runStdParVariant(VariantID vid, size_t tune_idx);
+  void runSIMDVariant(VariantID vid, size_t tune_idx);
 
+  void setSeqTuningDefinitions(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
@@ -66,10 +89,23 @@ public:
   template < size_t block_size >
   void runHipVariantImpl(VariantID vid);
 
+  void runSeqVariantDefault(VariantID vid);
+  void runSeqVariantSIMDLibm(VariantID vid);
+  template < size_t ulps >
+  void runSeqVariantPoly(VariantID vid);
+
+  void runOpenMPVariantDefault(VariantID vid);
+  void runOpenMPVariantSIMDLibm(VariantID vid);
+  template < size_t ulps >
+  void runOpenMPVariantPoly(VariantID vid);
+
 private:
   static const size_t default_gpu_block_size = 256;
   using gpu_block_sizes_type = gpu_block_size::make_list_type<default_gpu_block_size>;
 
+  // iterations per omp simd loop in the RAJA OpenMP simd_libm variant
+  static const Index_type simd_chunk_size = 1024;
+
   Real_ptr m_x;
   Real_ptr m_y;
   Real_ptr m_u;
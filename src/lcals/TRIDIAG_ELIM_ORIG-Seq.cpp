@@ -0,0 +1,222 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "TRIDIAG_ELIM_ORIG.hpp"
+
+#include "RAJA/RAJA.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace rajaperf
+{
+namespace lcals
+{
+
+
+void TRIDIAG_ELIM_ORIG::runSeqVariantSerial(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 1;
+  const Index_type iend = m_N;
+
+  TRIDIAG_ELIM_ORIG_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type i = ibegin; i < iend; ++i ) {
+          TRIDIAG_ELIM_ORIG_BODY;
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::seq_exec>(
+          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
+          TRIDIAG_ELIM_ORIG_BODY;
+        });
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  TRIDIAG_ELIM_ORIG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void TRIDIAG_ELIM_ORIG::runSeqVariantScan(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 1;
+  const Index_type iend = m_N;
+
+  TRIDIAG_ELIM_ORIG_DATA_SETUP;
+  AFFINE_SCAN_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type c = 0; c < nblocks; ++c ) {
+          AFFINE_SCAN_REDUCE_BODY(TRIDIAG_ELIM_ORIG_COEFS);
+        }
+        AFFINE_SCAN_BLOCKS(x[ibegin-1]);
+        for (Index_type c = 0; c < nblocks; ++c ) {
+          AFFINE_SCAN_RECOMPUTE_BODY(TRIDIAG_ELIM_ORIG_STEP, TRIDIAG_ELIM_ORIG_STORE);
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      auto tridiag_reduce_lam = [=](Index_type c) {
+        AFFINE_SCAN_REDUCE_BODY(TRIDIAG_ELIM_ORIG_COEFS);
+      };
+      auto tridiag_recompute_lam = [=](Index_type c) {
+        AFFINE_SCAN_RECOMPUTE_BODY(TRIDIAG_ELIM_ORIG_STEP, TRIDIAG_ELIM_ORIG_STORE);
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nblocks), tridiag_reduce_lam);
+        AFFINE_SCAN_BLOCKS(x[ibegin-1]);
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nblocks), tridiag_recompute_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  TRIDIAG_ELIM_ORIG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void TRIDIAG_ELIM_ORIG::runSeqVariantScanSimd(VariantID vid)
+{
+  const Index_type run_reps = getRunReps();
+  const Index_type ibegin = 1;
+  const Index_type iend = m_N;
+
+  TRIDIAG_ELIM_ORIG_DATA_SETUP;
+  AFFINE_SCAN_SIMD_DATA_SETUP;
+
+  switch ( vid ) {
+
+    case Base_Seq : {
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        for (Index_type c = 0; c < nblocks; ++c ) {
+          AFFINE_SCAN_PREFIX_BODY(TRIDIAG_ELIM_ORIG_COEFS);
+        }
+        AFFINE_SCAN_BLOCKS(x[ibegin-1]);
+        for (Index_type c = 0; c < nblocks; ++c ) {
+          AFFINE_SCAN_BLOCK_RANGE;
+          const Real_type xs = block_x[c];
+          for (Index_type i = bbegin; i < bend; ++i ) {
+            AFFINE_SCAN_APPLY_BODY(TRIDIAG_ELIM_ORIG_STORE);
+          }
+        }
+
+      }
+      stopTimer();
+
+      break;
+    }
+
+#if defined(RUN_RAJA_SEQ)
+    case RAJA_Seq : {
+
+      auto tridiag_prefix_lam = [=](Index_type c) {
+        AFFINE_SCAN_PREFIX_BODY(TRIDIAG_ELIM_ORIG_COEFS);
+      };
+      auto tridiag_apply_lam = [=](Index_type c) {
+        AFFINE_SCAN_BLOCK_RANGE;
+        const Real_type xs = block_x[c];
+        RAJA::forall<RAJA::simd_exec>(
+          RAJA::RangeSegment(bbegin, bend), [=](Index_type i) {
+          AFFINE_SCAN_APPLY_BODY(TRIDIAG_ELIM_ORIG_STORE);
+        });
+      };
+
+      startTimer();
+      for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
+
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nblocks), tridiag_prefix_lam);
+        AFFINE_SCAN_BLOCKS(x[ibegin-1]);
+        RAJA::forall<RAJA::loop_exec>(
+          RAJA::RangeSegment(0, nblocks), tridiag_apply_lam);
+
+      }
+      stopTimer();
+
+      break;
+    }
+#endif // RUN_RAJA_SEQ
+
+    default : {
+      getCout() << "\n  TRIDIAG_ELIM_ORIG : Unknown variant id = " << vid << std::endl;
+    }
+
+  }
+
+}
+
+void TRIDIAG_ELIM_ORIG::runSeqVariant(VariantID vid, size_t tune_idx)
+{
+  if ( tune_idx == 0 ) {
+    runSeqVariantSerial(vid);
+  } else if ( tune_idx == 1 ) {
+    runSeqVariantScan(vid);
+  } else {
+    runSeqVariantScanSimd(vid);
+  }
+}
+
+} // end namespace lcals
+} // end namespace rajaperf
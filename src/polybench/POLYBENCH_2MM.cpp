@@ -9,6 +9,8 @@
 #include "POLYBENCH_2MM.hpp"
 
 #include "RAJA/RAJA.hpp"
+
+#include "PolybenchData.hpp"
 #include "common/DataUtils.hpp"
 
 #include <algorithm>
@@ -31,10 +33,10 @@ POLYBENCH_2MM::POLYBENCH_2MM(const RunParams& params)
                                    ni_default*nl_default ) );
   setDefaultReps(2);
 
-  m_ni = std::sqrt( getTargetProblemSize() ) + 1;
-  m_nj = m_ni;
-  m_nk = nk_default;
-  m_nl = m_ni;
+  m_ni = getPolybenchDim(params, "2MM", "ni", std::sqrt( getTargetProblemSize() ) + 1);
+  m_nj = getPolybenchDim(params, "2MM", "nj", m_ni);
+  m_nk = getPolybenchDim(params, "2MM", "nk", nk_default);
+  m_nl = getPolybenchDim(params, "2MM", "nl", m_ni);
 
   m_alpha = 1.5;
   m_beta = 1.2;
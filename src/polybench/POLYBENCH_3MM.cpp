@@ -9,6 +9,8 @@
 #include "POLYBENCH_3MM.hpp"
 
 #include "RAJA/RAJA.hpp"
+
+#include "PolybenchData.hpp"
 #include "common/DataUtils.hpp"
 
 #include <algorithm>
@@ -35,11 +37,11 @@ POLYBENCH_3MM::POLYBENCH_3MM(const RunParams& params)
   setDefaultProblemSize( ni_default * nj_default );
   setDefaultReps(2);
 
-  m_ni = std::sqrt( getTargetProblemSize() ) + 1;
-  m_nj = m_ni;
-  m_nk = nk_default;
-  m_nl = m_ni;
-  m_nm = nm_default;
+  m_ni = getPolybenchDim(params, "3MM", "ni", std::sqrt( getTargetProblemSize() ) + 1);
+  m_nj = getPolybenchDim(params, "3MM", "nj", m_ni);
+  m_nk = getPolybenchDim(params, "3MM", "nk", nk_default);
+  m_nl = getPolybenchDim(params, "3MM", "nl", m_ni);
+  m_nm = getPolybenchDim(params, "3MM", "nm", nm_default);
 
 
   setActualProblemSize( std::max( std::max( m_ni*m_nj, m_nj*m_nl ),
@@ -9,6 +9,8 @@
 #include "POLYBENCH_ADI.hpp"
 
 #include "RAJA/RAJA.hpp"
+
+#include "PolybenchData.hpp"
 #include "common/DataUtils.hpp"
 
 namespace rajaperf
@@ -25,8 +27,8 @@ POLYBENCH_ADI::POLYBENCH_ADI(const RunParams& params)
   setDefaultProblemSize( (n_default-2) * (n_default-2) );
   setDefaultReps(4);
 
-  m_n = std::sqrt( getTargetProblemSize() ) + 1;
-  m_tsteps = 4;
+  m_n = getPolybenchDim(params, "ADI", "n", std::sqrt( getTargetProblemSize() ) + 1);
+  m_tsteps = getPolybenchDim(params, "ADI", "tsteps", 4);
 
   setItsPerRep( m_tsteps * ( (m_n-2) + (m_n-2) ) );
 
@@ -9,6 +9,8 @@
 #include "POLYBENCH_FDTD_2D.hpp"
 
 #include "RAJA/RAJA.hpp"
+
+#include "PolybenchData.hpp"
 #include "common/DataUtils.hpp"
 
 #include <algorithm>
@@ -31,9 +33,9 @@ POLYBENCH_FDTD_2D::POLYBENCH_FDTD_2D(const RunParams& params)
                                     nx_default * (ny_default-1) ) );
   setDefaultReps(8);
 
-  m_nx = std::sqrt( getTargetProblemSize() ) + 1;
-  m_ny = m_nx;
-  m_tsteps = 40;
+  m_nx = getPolybenchDim(params, "FDTD_2D", "nx", std::sqrt( getTargetProblemSize() ) + 1);
+  m_ny = getPolybenchDim(params, "FDTD_2D", "ny", m_nx);
+  m_tsteps = getPolybenchDim(params, "FDTD_2D", "tsteps", 40);
 
 
   setActualProblemSize( std::max( (m_nx-1)*m_ny, m_nx*(m_ny-1) ) );
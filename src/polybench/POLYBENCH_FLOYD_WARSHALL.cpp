@@ -9,6 +9,8 @@
 #include "POLYBENCH_FLOYD_WARSHALL.hpp"
 
 #include "RAJA/RAJA.hpp"
+
+#include "PolybenchData.hpp"
 #include "common/DataUtils.hpp"
 
 
@@ -26,7 +28,7 @@ POLYBENCH_FLOYD_WARSHALL::POLYBENCH_FLOYD_WARSHALL(const RunParams& params)
   setDefaultProblemSize( N_default * N_default );
   setDefaultReps(8);
 
-  m_N = std::sqrt( getTargetProblemSize() ) + 1;
+  m_N = getPolybenchDim(params, "FLOYD_WARSHALL", "n", std::sqrt( getTargetProblemSize() ) + 1);
 
 
   setActualProblemSize( m_N * m_N );
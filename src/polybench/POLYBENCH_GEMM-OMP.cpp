@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/OpenMPUtils.hpp"
+
 #include <iostream>
 
 
@@ -19,7 +21,54 @@ namespace polybench
 {
 
 
-void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+#if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
+
+//
+// RAJA kernel policy that parallelizes the outer collapse_depth loops.
+//
+template < size_t collapse_depth >
+struct PolybenchGemmOpenMPPolicy;
+
+template < >
+struct PolybenchGemmOpenMPPolicy<1>
+{
+  using type =
+    RAJA::KernelPolicy<
+      RAJA::statement::For<0, RAJA::omp_parallel_for_exec,
+        RAJA::statement::For<1, RAJA::loop_exec,
+          RAJA::statement::Lambda<0, RAJA::Params<0>>,
+          RAJA::statement::Lambda<1, RAJA::Segs<0,1>>,
+          RAJA::statement::For<2, RAJA::loop_exec,
+            RAJA::statement::Lambda<2, RAJA::Segs<0,1,2>, RAJA::Params<0>>
+          >,
+          RAJA::statement::Lambda<3, RAJA::Segs<0,1>, RAJA::Params<0>>
+        >
+      >
+    >;
+};
+
+template < >
+struct PolybenchGemmOpenMPPolicy<2>
+{
+  using type =
+    RAJA::KernelPolicy<
+      RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
+                                RAJA::ArgList<0, 1>,
+        RAJA::statement::Lambda<0, RAJA::Params<0>>,
+        RAJA::statement::Lambda<1, RAJA::Segs<0,1>>,
+        RAJA::statement::For<2, RAJA::loop_exec,
+          RAJA::statement::Lambda<2, RAJA::Segs<0,1,2>, RAJA::Params<0>>
+        >,
+        RAJA::statement::Lambda<3, RAJA::Segs<0,1>, RAJA::Params<0>>
+      >
+    >;
+};
+
+#endif
+
+
+template < size_t collapse_depth >
+void POLYBENCH_GEMM::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
@@ -34,16 +83,34 @@ void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for collapse(2)
-        for (Index_type i = 0; i < ni; ++i ) {
-          for (Index_type j = 0; j < nj; ++j ) {
-            POLYBENCH_GEMM_BODY1;
-            POLYBENCH_GEMM_BODY2;
-            for (Index_type k = 0; k < nk; ++k ) {
-              POLYBENCH_GEMM_BODY3;
+        if (collapse_depth == 2) {
+
+          #pragma omp parallel for collapse(2)
+          for (Index_type i = 0; i < ni; ++i ) {
+            for (Index_type j = 0; j < nj; ++j ) {
+              POLYBENCH_GEMM_BODY1;
+              POLYBENCH_GEMM_BODY2;
+              for (Index_type k = 0; k < nk; ++k ) {
+                POLYBENCH_GEMM_BODY3;
+              }
+              POLYBENCH_GEMM_BODY4;
             }
-            POLYBENCH_GEMM_BODY4;
           }
+
+        } else {
+
+          #pragma omp parallel for
+          for (Index_type i = 0; i < ni; ++i ) {
+            for (Index_type j = 0; j < nj; ++j ) {
+              POLYBENCH_GEMM_BODY1;
+              POLYBENCH_GEMM_BODY2;
+              for (Index_type k = 0; k < nk; ++k ) {
+                POLYBENCH_GEMM_BODY3;
+              }
+              POLYBENCH_GEMM_BODY4;
+            }
+          }
+
         }
 
       }
@@ -69,16 +136,34 @@ void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for collapse(2)
-        for (Index_type i = 0; i < ni; ++i ) {
-          for (Index_type j = 0; j < nj; ++j ) {
-            POLYBENCH_GEMM_BODY1;
-            poly_gemm_base_lam2(i, j);
-            for (Index_type k = 0; k < nk; ++k ) {
-              poly_gemm_base_lam3(i, j, k, dot);
+        if (collapse_depth == 2) {
+
+          #pragma omp parallel for collapse(2)
+          for (Index_type i = 0; i < ni; ++i ) {
+            for (Index_type j = 0; j < nj; ++j ) {
+              POLYBENCH_GEMM_BODY1;
+              poly_gemm_base_lam2(i, j);
+              for (Index_type k = 0; k < nk; ++k ) {
+                poly_gemm_base_lam3(i, j, k, dot);
+              }
+              poly_gemm_base_lam4(i, j, dot);
             }
-            poly_gemm_base_lam4(i, j, dot);
           }
+
+        } else {
+
+          #pragma omp parallel for
+          for (Index_type i = 0; i < ni; ++i ) {
+            for (Index_type j = 0; j < nj; ++j ) {
+              POLYBENCH_GEMM_BODY1;
+              poly_gemm_base_lam2(i, j);
+              for (Index_type k = 0; k < nk; ++k ) {
+                poly_gemm_base_lam3(i, j, k, dot);
+              }
+              poly_gemm_base_lam4(i, j, dot);
+            }
+          }
+
         }
 
       }
@@ -106,18 +191,7 @@ void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
                                 POLYBENCH_GEMM_BODY4_RAJA;
                                };
 
-      using EXEC_POL =
-        RAJA::KernelPolicy<
-          RAJA::statement::Collapse<RAJA::omp_parallel_collapse_exec,
-                                    RAJA::ArgList<0, 1>,
-            RAJA::statement::Lambda<0, RAJA::Params<0>>,
-            RAJA::statement::Lambda<1, RAJA::Segs<0,1>>,
-            RAJA::statement::For<2, RAJA::loop_exec,
-              RAJA::statement::Lambda<2, RAJA::Segs<0,1,2>, RAJA::Params<0>>
-            >,
-            RAJA::statement::Lambda<3, RAJA::Segs<0,1>, RAJA::Params<0>>
-          >
-        >;
+      using EXEC_POL = typename PolybenchGemmOpenMPPolicy<collapse_depth>::type;
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
@@ -153,5 +227,7 @@ void POLYBENCH_GEMM::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(
 #endif
 }
 
+RAJAPERF_OPENMP_COLLAPSE_TUNING_DEFINE_BOILERPLATE(POLYBENCH_GEMM)
+
 } // end namespace polybench
 } // end namespace rajaperf
@@ -9,6 +9,8 @@
 #include "POLYBENCH_GEMM.hpp"
 
 #include "RAJA/RAJA.hpp"
+
+#include "PolybenchData.hpp"
 #include "common/DataUtils.hpp"
 
 
@@ -28,9 +30,9 @@ POLYBENCH_GEMM::POLYBENCH_GEMM(const RunParams& params)
   setDefaultProblemSize( ni_default * nj_default );
   setDefaultReps(4);
 
-  m_ni = std::sqrt( getTargetProblemSize() ) + 1;
-  m_nj = m_ni;
-  m_nk = nk_default;
+  m_ni = getPolybenchDim(params, "GEMM", "ni", std::sqrt( getTargetProblemSize() ) + 1);
+  m_nj = getPolybenchDim(params, "GEMM", "nj", m_ni);
+  m_nk = getPolybenchDim(params, "GEMM", "nk", nk_default);
 
   m_alpha = 0.62;
   m_beta = 1.002;
@@ -9,6 +9,8 @@
 #include "POLYBENCH_GEMVER.hpp"
 
 #include "RAJA/RAJA.hpp"
+
+#include "PolybenchData.hpp"
 #include "common/DataUtils.hpp"
 
 
@@ -26,7 +28,7 @@ POLYBENCH_GEMVER::POLYBENCH_GEMVER(const RunParams& params)
   setDefaultProblemSize( n_default * n_default );
   setDefaultReps(20);
 
-  m_n =  std::sqrt( getTargetProblemSize() ) + 1;
+  m_n = getPolybenchDim(params, "GEMVER", "n", std::sqrt( getTargetProblemSize() ) + 1);
 
   m_alpha = 1.5;
   m_beta = 1.2;
@@ -9,6 +9,8 @@
 #include "POLYBENCH_GESUMMV.hpp"
 
 #include "RAJA/RAJA.hpp"
+
+#include "PolybenchData.hpp"
 #include "common/DataUtils.hpp"
 
 
@@ -26,7 +28,7 @@ POLYBENCH_GESUMMV::POLYBENCH_GESUMMV(const RunParams& params)
   setDefaultProblemSize( N_default * N_default );
   setDefaultReps(120);
 
-  m_N = std::sqrt( getTargetProblemSize() ) + 1;
+  m_N = getPolybenchDim(params, "GESUMMV", "n", std::sqrt( getTargetProblemSize() ) + 1);
 
   m_alpha = 0.62;
   m_beta = 1.002;
@@ -9,6 +9,8 @@
 #include "POLYBENCH_HEAT_3D.hpp"
 
 #include "RAJA/RAJA.hpp"
+
+#include "PolybenchData.hpp"
 #include "common/DataUtils.hpp"
 
 #include <cmath>
@@ -27,8 +29,8 @@ POLYBENCH_HEAT_3D::POLYBENCH_HEAT_3D(const RunParams& params)
   setDefaultProblemSize( (N_default-2)*(N_default-2)*(N_default-2) );
   setDefaultReps(20);
 
-  m_N = std::cbrt( getTargetProblemSize() ) + 1;
-  m_tsteps = 20;
+  m_N = getPolybenchDim(params, "HEAT_3D", "n", std::cbrt( getTargetProblemSize() ) + 1);
+  m_tsteps = getPolybenchDim(params, "HEAT_3D", "tsteps", 20);
 
 
   setActualProblemSize( (m_N-2) * (m_N-2) * (m_N-2) );
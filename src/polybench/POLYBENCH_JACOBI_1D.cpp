@@ -9,6 +9,8 @@
 #include "POLYBENCH_JACOBI_1D.hpp"
 
 #include "RAJA/RAJA.hpp"
+
+#include "PolybenchData.hpp"
 #include "common/DataUtils.hpp"
 
 
@@ -26,8 +28,8 @@ POLYBENCH_JACOBI_1D::POLYBENCH_JACOBI_1D(const RunParams& params)
   setDefaultProblemSize( N_default-2 );
   setDefaultReps(100);
 
-  m_N = getTargetProblemSize();
-  m_tsteps = 16;
+  m_N = getPolybenchDim(params, "JACOBI_1D", "n", getTargetProblemSize());
+  m_tsteps = getPolybenchDim(params, "JACOBI_1D", "tsteps", 16);
 
 
   setActualProblemSize( m_N-2 );
@@ -9,6 +9,8 @@
 #include "POLYBENCH_JACOBI_2D.hpp"
 
 #include "RAJA/RAJA.hpp"
+
+#include "PolybenchData.hpp"
 #include "common/DataUtils.hpp"
 
 
@@ -26,8 +28,8 @@ POLYBENCH_JACOBI_2D::POLYBENCH_JACOBI_2D(const RunParams& params)
   setDefaultProblemSize( N_default * N_default );
   setDefaultReps(50);
 
-  m_N = std::sqrt( getTargetProblemSize() ) + 1;
-  m_tsteps = 40;
+  m_N = getPolybenchDim(params, "JACOBI_2D", "n", std::sqrt( getTargetProblemSize() ) + 1);
+  m_tsteps = getPolybenchDim(params, "JACOBI_2D", "tsteps", 40);
 
 
   setActualProblemSize( (m_N-2) * (m_N-2) );
@@ -9,6 +9,8 @@
 #include "POLYBENCH_MVT.hpp"
 
 #include "RAJA/RAJA.hpp"
+
+#include "PolybenchData.hpp"
 #include "common/DataUtils.hpp"
 
 
@@ -26,7 +28,7 @@ POLYBENCH_MVT::POLYBENCH_MVT(const RunParams& params)
   setDefaultProblemSize( N_default * N_default );
   setDefaultReps(100);
 
-  m_N = std::sqrt( getTargetProblemSize() ) + 1;
+  m_N = getPolybenchDim(params, "MVT", "n", std::sqrt( getTargetProblemSize() ) + 1);
 
 
   setActualProblemSize( m_N * m_N );
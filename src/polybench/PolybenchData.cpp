@@ -0,0 +1,127 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#include "PolybenchData.hpp"
+
+#include "common/RunParams.hpp"
+
+#include <cstdlib>
+#include <vector>
+
+namespace rajaperf
+{
+namespace polybench
+{
+
+namespace
+{
+
+//
+// Dimensions of the kernels and their dataset presets of the original suite,
+// in the order MINI, SMALL, MEDIUM, LARGE, EXTRALARGE. ATAX is square here,
+// so it uses the preset's N. tsteps has no preset, its sizes are 0.
+//
+struct DatasetDim
+{
+  const char* kernel_name;
+  const char* dim;
+  Index_type sizes[5];
+};
+
+const DatasetDim s_dataset_dims[] = {
+  { "2MM",            "ni", {  16,  40, 180,  800, 1600 } },
+  { "2MM",            "nj", {  18,  50, 190,  900, 1800 } },
+  { "2MM",            "nk", {  22,  70, 210, 1100, 2200 } },
+  { "2MM",            "nl", {  24,  80, 220, 1200, 2400 } },
+  { "3MM",            "ni", {  16,  40, 180,  800, 1600 } },
+  { "3MM",            "nj", {  18,  50, 190,  900, 1800 } },
+  { "3MM",            "nk", {  20,  60, 200, 1000, 2000 } },
+  { "3MM",            "nl", {  22,  70, 210, 1100, 2200 } },
+  { "3MM",            "nm", {  24,  80, 220, 1200, 2400 } },
+  { "ADI",            "n",  {  20,  60, 200, 1000, 2000 } },
+  { "ADI",        "tsteps", {   0,   0,   0,    0,    0 } },
+  { "ATAX",           "n",  {  42, 124, 410, 2100, 2200 } },
+  { "FDTD_2D",        "nx", {  20,  60, 200, 1000, 2000 } },
+  { "FDTD_2D",        "ny", {  30,  80, 240, 1200, 2600 } },
+  { "FDTD_2D",    "tsteps", {   0,   0,   0,    0,    0 } },
+  { "FLOYD_WARSHALL", "n",  {  60, 180, 500, 2800, 5600 } },
+  { "GEMM",           "ni", {  20,  60, 200, 1000, 2000 } },
+  { "GEMM",           "nj", {  25,  70, 220, 1100, 2300 } },
+  { "GEMM",           "nk", {  30,  80, 240, 1200, 2600 } },
+  { "GEMVER",         "n",  {  40, 120, 400, 2000, 4000 } },
+  { "GESUMMV",        "n",  {  30,  90, 250, 1300, 2800 } },
+  { "HEAT_3D",        "n",  {  10,  20,  40,  120,  200 } },
+  { "HEAT_3D",    "tsteps", {   0,   0,   0,    0,    0 } },
+  { "JACOBI_1D",      "n",  {  30, 120, 400, 2000, 4000 } },
+  { "JACOBI_1D",  "tsteps", {   0,   0,   0,    0,    0 } },
+  { "JACOBI_2D",      "n",  {  30,  90, 250, 1300, 2800 } },
+  { "JACOBI_2D",  "tsteps", {   0,   0,   0,    0,    0 } },
+  { "MVT",            "n",  {  40, 120, 400, 2000, 4000 } }
+};
+
+int getDatasetIndex(const std::string& dataset)
+{
+  const char* datasets[] = { "MINI", "SMALL", "MEDIUM", "LARGE", "EXTRALARGE" };
+  for (int i = 0; i < 5; ++i) {
+    if ( dataset == datasets[i] ) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+} // end anonymous namespace
+
+
+Index_type getPolybenchDim(const RunParams& params,
+                           const std::string& kernel_name,
+                           const std::string& dim,
+                           Index_type size_dim)
+{
+  const std::string kernel_dim = kernel_name + ":" + dim + "=";
+  const std::string any_dim = dim + "=";
+
+  Index_type dim_value = 0;
+  for (const std::string& entry : params.getPolybenchDims()) {
+    if ( entry.compare(0, kernel_dim.size(), kernel_dim) == 0 ) {
+      return ::atoi( entry.substr(kernel_dim.size()).c_str() );
+    } else if ( entry.compare(0, any_dim.size(), any_dim) == 0 ) {
+      dim_value = ::atoi( entry.substr(any_dim.size()).c_str() );
+    }
+  }
+  if ( dim_value > 0 ) {
+    return dim_value;
+  }
+
+  const int dataset_idx = getDatasetIndex(params.getPolybenchDataset());
+  if ( dataset_idx >= 0 ) {
+    for (const DatasetDim& dataset_dim : s_dataset_dims) {
+      if ( kernel_name == dataset_dim.kernel_name &&
+           dim == dataset_dim.dim &&
+           dataset_dim.sizes[dataset_idx] > 0 ) {
+        return dataset_dim.sizes[dataset_idx];
+      }
+    }
+  }
+
+  return size_dim;
+}
+
+bool isPolybenchDim(const std::string& kernel_name, const std::string& dim)
+{
+  for (const DatasetDim& dataset_dim : s_dataset_dims) {
+    if ( ( kernel_name.empty() || kernel_name == dataset_dim.kernel_name ) &&
+         dim == dataset_dim.dim ) {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // end namespace polybench
+} // end namespace rajaperf
@@ -0,0 +1,48 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2017-22, Lawrence Livermore National Security, LLC
+// and RAJA Performance Suite project contributors.
+// See the RAJAPerf/LICENSE file for details.
+//
+// SPDX-License-Identifier: (BSD-3-Clause)
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+#ifndef RAJAPerf_PolybenchData_HPP
+#define RAJAPerf_PolybenchData_HPP
+
+#include "common/RPTypes.hpp"
+
+#include <string>
+
+namespace rajaperf
+{
+class RunParams;
+
+namespace polybench
+{
+
+/*!
+ * \brief Dimension dim of Polybench kernel kernel_name (e.g., "GEMM", "ni").
+ *
+ * This is the value given for it with --polybench_dims, as KERNEL:dim=value
+ * or else dim=value, otherwise its value in the --polybench_dataset preset
+ * (the sizes of the original Polybench/C 4.2 suite), otherwise size_dim,
+ * the value the kernel derives from the target problem size.
+ *
+ * Presets do not set tsteps, the suite's time steps are kept unless given
+ * with --polybench_dims.
+ */
+Index_type getPolybenchDim(const RunParams& params,
+                           const std::string& kernel_name,
+                           const std::string& dim,
+                           Index_type size_dim);
+
+/*!
+ * \brief Whether dim is a dimension of Polybench kernel kernel_name, or of
+ *        any Polybench kernel when kernel_name is empty.
+ */
+bool isPolybenchDim(const std::string& kernel_name, const std::string& dim);
+
+} // end namespace polybench
+} // end namespace rajaperf
+
+#endif  // closing endif for header file include guard
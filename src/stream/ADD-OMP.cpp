@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/OpenMPUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,18 +20,20 @@ namespace stream
 {
 
 
-void ADD::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type, typename Compute_type,
+           typename Loop_index_type, bool runtime_schedule >
+void ADD::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
   const Index_type run_reps = getRunReps();
-  const Index_type ibegin = 0;
-  const Index_type iend = getActualProblemSize();
+  const Loop_index_type ibegin = 0;
+  const Loop_index_type iend = static_cast<Loop_index_type>(getActualProblemSize());
 
-  ADD_DATA_SETUP;
+  ADD_PRECISION_DATA_SETUP(Data_type, Compute_type);
 
-  auto add_lam = [=](Index_type i) {
-                   ADD_BODY;
+  auto add_lam = [=](Loop_index_type i) {
+                   ADD_PRECISION_BODY(Data_type, Compute_type);
                  };
 
   switch ( vid ) {
@@ -39,9 +43,16 @@ void ADD::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          ADD_BODY;
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime)
+          for (Loop_index_type i = ibegin; i < iend; ++i ) {
+            ADD_PRECISION_BODY(Data_type, Compute_type);
+          }
+        } else {
+          #pragma omp parallel for
+          for (Loop_index_type i = ibegin; i < iend; ++i ) {
+            ADD_PRECISION_BODY(Data_type, Compute_type);
+          }
         }
 
       }
@@ -55,9 +66,16 @@ void ADD::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        #pragma omp parallel for
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          add_lam(i);
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime)
+          for (Loop_index_type i = ibegin; i < iend; ++i ) {
+            add_lam(i);
+          }
+        } else {
+          #pragma omp parallel for
+          for (Loop_index_type i = ibegin; i < iend; ++i ) {
+            add_lam(i);
+          }
         }
 
       }
@@ -71,8 +89,8 @@ void ADD::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::forall<RAJA::omp_parallel_for_exec>(
-          RAJA::RangeSegment(ibegin, iend), add_lam);
+        RAJA::forall<omp_schedule::parallel_for_exec<runtime_schedule>>(
+          RAJA::TypedRangeSegment<Loop_index_type>(ibegin, iend), add_lam);
 
       }
       stopTimer();
@@ -91,5 +109,7 @@ void ADD::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 #endif
 }
 
+RAJAPERF_OPENMP_SCHEDULE_PRECISION_INDEX_TYPE_TUNING_DEFINE_BOILERPLATE(ADD)
+
 } // end namespace stream
 } // end namespace rajaperf
@@ -18,16 +18,18 @@ namespace stream
 {
 
 
-void ADD::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type, typename Compute_type,
+           typename Loop_index_type >
+void ADD::runSeqVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
-  const Index_type ibegin = 0;
-  const Index_type iend = getActualProblemSize();
+  const Loop_index_type ibegin = 0;
+  const Loop_index_type iend = static_cast<Loop_index_type>(getActualProblemSize());
 
-  ADD_DATA_SETUP;
+  ADD_PRECISION_DATA_SETUP(Data_type, Compute_type);
 
-  auto add_lam = [=](Index_type i) {
-                   ADD_BODY;
+  auto add_lam = [=](Loop_index_type i) {
+                   ADD_PRECISION_BODY(Data_type, Compute_type);
                  };
 
   switch ( vid ) {
@@ -37,8 +39,8 @@ void ADD::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          ADD_BODY;
+        for (Loop_index_type i = ibegin; i < iend; ++i ) {
+          ADD_PRECISION_BODY(Data_type, Compute_type);
         }
 
       }
@@ -53,7 +55,7 @@ void ADD::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        for (Index_type i = ibegin; i < iend; ++i ) {
+        for (Loop_index_type i = ibegin; i < iend; ++i ) {
           add_lam(i);
         }
 
@@ -69,7 +71,7 @@ void ADD::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         RAJA::forall<RAJA::simd_exec>(
-          RAJA::RangeSegment(ibegin, iend), add_lam);
+          RAJA::TypedRangeSegment<Loop_index_type>(ibegin, iend), add_lam);
 
       }
       stopTimer();
@@ -86,5 +88,7 @@ void ADD::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+RAJAPERF_SEQ_PRECISION_INDEX_TYPE_TUNING_DEFINE_BOILERPLATE(ADD)
+
 } // end namespace stream
 } // end namespace rajaperf
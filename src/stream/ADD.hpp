@@ -22,11 +22,24 @@
   Real_ptr b = m_b; \
   Real_ptr c = m_c;
 
+// the data in the types of a precision tuning (see common/PrecisionUtils.hpp)
+#define ADD_PRECISION_DATA_SETUP(Data_type, Compute_type) \
+  Data_type* a = precision::getData<Data_type>(m_a, m_a_fp32); \
+  Data_type* b = precision::getData<Data_type>(m_b, m_b_fp32); \
+  Data_type* c = precision::getData<Data_type>(m_c, m_c_fp32);
+
 #define ADD_BODY  \
   c[i] = a[i] + b[i];
 
+// the precision tunings load and store Data_type and do the arithmetic in
+// Compute_type (see common/PrecisionUtils.hpp)
+#define ADD_PRECISION_BODY(Data_type, Compute_type)  \
+  c[i] = static_cast<Data_type>(Compute_type(a[i]) + Compute_type(b[i]));
+
 
 #include "common/KernelBase.hpp"
+#include "common/IndexTypeUtils.hpp"
+#include "common/PrecisionUtils.hpp"
 
 namespace rajaperf
 {
@@ -53,7 +66,18 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
-
+  void runThreadPoolVariant(VariantID vid, size_t tune_idx);
+  void runStdParVariant(VariantID vid, size_t tune_idx);
+  void runSIMDVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  template < typename Data_type, typename Compute_type,
+             typename Loop_index_type >
+  void runSeqVariantImpl(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  template < typename Data_type, typename Compute_type,
+             typename Loop_index_type, bool runtime_schedule >
+  void runOpenMPVariantImpl(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
@@ -68,6 +92,9 @@ private:
   Real_ptr m_a;
   Real_ptr m_b;
   Real_ptr m_c;
+  precision::Float_ptr m_a_fp32;
+  precision::Float_ptr m_b_fp32;
+  precision::Float_ptr m_c_fp32;
 
 };
 
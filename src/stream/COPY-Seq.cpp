@@ -18,15 +18,17 @@ namespace stream
 {
 
 
-void COPY::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type, typename Compute_type,
+           typename Loop_index_type >
+void COPY::runSeqVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
-  const Index_type ibegin = 0;
-  const Index_type iend = getActualProblemSize();
+  const Loop_index_type ibegin = 0;
+  const Loop_index_type iend = static_cast<Loop_index_type>(getActualProblemSize());
 
-  COPY_DATA_SETUP;
+  COPY_PRECISION_DATA_SETUP(Data_type, Compute_type);
 
-  auto copy_lam = [=](Index_type i) {
+  auto copy_lam = [=](Loop_index_type i) {
                     COPY_BODY;
                   };
 
@@ -37,7 +39,7 @@ void COPY::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        for (Index_type i = ibegin; i < iend; ++i ) {
+        for (Loop_index_type i = ibegin; i < iend; ++i ) {
           COPY_BODY;
         }
 
@@ -53,7 +55,7 @@ void COPY::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        for (Index_type i = ibegin; i < iend; ++i ) {
+        for (Loop_index_type i = ibegin; i < iend; ++i ) {
           copy_lam(i);
         }
 
@@ -69,7 +71,7 @@ void COPY::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
         RAJA::forall<RAJA::simd_exec>(
-          RAJA::RangeSegment(ibegin, iend), copy_lam);
+          RAJA::TypedRangeSegment<Loop_index_type>(ibegin, iend), copy_lam);
 
       }
       stopTimer();
@@ -86,5 +88,7 @@ void COPY::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+RAJAPERF_SEQ_PRECISION_INDEX_TYPE_TUNING_DEFINE_BOILERPLATE(COPY)
+
 } // end namespace stream
 } // end namespace rajaperf
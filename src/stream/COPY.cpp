@@ -54,28 +54,52 @@ COPY::COPY(const RunParams& params)
   setVariantDefined( RAJA_HIP );
 
   setVariantDefined( Kokkos_Lambda );
+
+  setVariantDefined( Base_ThreadPool );
+  setVariantDefined( Lambda_ThreadPool );
+
+  setVariantDefined( Base_StdPar );
+  setVariantDefined( Lambda_StdPar );
+
+  setVariantDefined( Base_SIMD );
+  setVariantDefined( RAJA_SIMD );
 }
 
 COPY::~COPY()
 {
 }
 
-void COPY::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void COPY::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitData(m_a, getActualProblemSize(), vid);
   allocAndInitDataConst(m_c, getActualProblemSize(), 0.0, vid);
+
+  if ( precision::isTuning(getVariantTuningName(vid, tune_idx)) ) {
+    precision::allocAndCopyData(m_a_fp32, m_a, getActualProblemSize());
+    precision::allocAndCopyData(m_c_fp32, m_c, getActualProblemSize());
+    recordBytesSaved(vid, tune_idx, precision::getBytesSaved(
+      2*sizeof(Real_type) * getActualProblemSize()));
+  }
 }
 
 void COPY::updateChecksum(VariantID vid, size_t tune_idx)
 {
+  if ( precision::isTuning(getVariantTuningName(vid, tune_idx)) ) {
+    precision::copyData(m_c, m_c_fp32, getActualProblemSize());
+  }
+
   checksum[vid][tune_idx] += calcChecksum(m_c, getActualProblemSize());
 }
 
-void COPY::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void COPY::tearDown(VariantID vid, size_t tune_idx)
 {
-  (void) vid;
   deallocData(m_a);
   deallocData(m_c);
+
+  if ( precision::isTuning(getVariantTuningName(vid, tune_idx)) ) {
+    precision::deallocData(m_a_fp32);
+    precision::deallocData(m_c_fp32);
+  }
 }
 
 } // end namespace stream
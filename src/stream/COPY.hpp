@@ -21,11 +21,18 @@
   Real_ptr a = m_a; \
   Real_ptr c = m_c;
 
+// the data in the types of a precision tuning (see common/PrecisionUtils.hpp)
+#define COPY_PRECISION_DATA_SETUP(Data_type, Compute_type) \
+  Data_type* a = precision::getData<Data_type>(m_a, m_a_fp32); \
+  Data_type* c = precision::getData<Data_type>(m_c, m_c_fp32);
+
 #define COPY_BODY  \
   c[i] = a[i] ;
 
 
 #include "common/KernelBase.hpp"
+#include "common/IndexTypeUtils.hpp"
+#include "common/PrecisionUtils.hpp"
 
 namespace rajaperf
 {
@@ -52,7 +59,18 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
-
+  void runThreadPoolVariant(VariantID vid, size_t tune_idx);
+  void runStdParVariant(VariantID vid, size_t tune_idx);
+  void runSIMDVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  template < typename Data_type, typename Compute_type,
+             typename Loop_index_type >
+  void runSeqVariantImpl(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  template < typename Data_type, typename Compute_type,
+             typename Loop_index_type, bool runtime_schedule >
+  void runOpenMPVariantImpl(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
@@ -66,6 +84,8 @@ private:
 
   Real_ptr m_a;
   Real_ptr m_c;
+  precision::Float_ptr m_a_fp32;
+  precision::Float_ptr m_c_fp32;
 };
 
 } // end namespace stream
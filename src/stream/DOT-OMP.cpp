@@ -10,6 +10,8 @@
 
 #include "RAJA/RAJA.hpp"
 
+#include "common/OpenMPUtils.hpp"
+
 #include <iostream>
 
 namespace rajaperf
@@ -18,15 +20,17 @@ namespace stream
 {
 
 
-void DOT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type, typename Compute_type,
+           typename Loop_index_type, bool runtime_schedule >
+void DOT::runOpenMPVariantImpl(VariantID vid)
 {
 #if defined(RAJA_ENABLE_OPENMP) && defined(RUN_OPENMP)
 
   const Index_type run_reps = getRunReps();
-  const Index_type ibegin = 0;
-  const Index_type iend = getActualProblemSize();
+  const Loop_index_type ibegin = 0;
+  const Loop_index_type iend = static_cast<Loop_index_type>(getActualProblemSize());
 
-  DOT_DATA_SETUP;
+  DOT_PRECISION_DATA_SETUP(Data_type, Compute_type);
 
   switch ( vid ) {
 
@@ -35,11 +39,18 @@ void DOT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type dot = m_dot_init;
-
-        #pragma omp parallel for reduction(+:dot)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          DOT_BODY;
+        Compute_type dot = m_dot_init;
+
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime) reduction(+:dot)
+          for (Loop_index_type i = ibegin; i < iend; ++i ) {
+            DOT_PRECISION_BODY(Compute_type);
+          }
+        } else {
+          #pragma omp parallel for reduction(+:dot)
+          for (Loop_index_type i = ibegin; i < iend; ++i ) {
+            DOT_PRECISION_BODY(Compute_type);
+          }
         }
 
         m_dot += dot;
@@ -52,18 +63,25 @@ void DOT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
     case Lambda_OpenMP : {
 
-      auto dot_base_lam = [=](Index_type i) -> Real_type {
-                            return a[i] * b[i];
+      auto dot_base_lam = [=](Loop_index_type i) -> Compute_type {
+                            return Compute_type(a[i]) * Compute_type(b[i]);
                           };
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type dot = m_dot_init;
-
-        #pragma omp parallel for reduction(+:dot)
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          dot += dot_base_lam(i);
+        Compute_type dot = m_dot_init;
+
+        if ( runtime_schedule ) {
+          #pragma omp parallel for schedule(runtime) reduction(+:dot)
+          for (Loop_index_type i = ibegin; i < iend; ++i ) {
+            dot += dot_base_lam(i);
+          }
+        } else {
+          #pragma omp parallel for reduction(+:dot)
+          for (Loop_index_type i = ibegin; i < iend; ++i ) {
+            dot += dot_base_lam(i);
+          }
         }
 
         m_dot += dot;
@@ -79,14 +97,15 @@ void DOT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::ReduceSum<RAJA::omp_reduce, Real_type> dot(m_dot_init);
+        RAJA::ReduceSum<RAJA::omp_reduce, Compute_type> dot(m_dot_init);
 
-        RAJA::forall<RAJA::omp_parallel_for_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
-          DOT_BODY;
+        RAJA::forall<omp_schedule::parallel_for_exec<runtime_schedule>>(
+          RAJA::TypedRangeSegment<Loop_index_type>(ibegin, iend),
+          [=](Loop_index_type i) {
+          DOT_PRECISION_BODY(Compute_type);
         });
 
-        m_dot += dot;
+        m_dot += static_cast<Real_type>(dot.get());
 
       }
       stopTimer();
@@ -105,5 +124,7 @@ void DOT::runOpenMPVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 #endif
 }
 
+RAJAPERF_OPENMP_SCHEDULE_PRECISION_INDEX_TYPE_TUNING_DEFINE_BOILERPLATE(DOT)
+
 } // end namespace stream
 } // end namespace rajaperf
@@ -18,13 +18,15 @@ namespace stream
 {
 
 
-void DOT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+template < typename Data_type, typename Compute_type,
+           typename Loop_index_type >
+void DOT::runSeqVariantImpl(VariantID vid)
 {
   const Index_type run_reps = getRunReps();
-  const Index_type ibegin = 0;
-  const Index_type iend = getActualProblemSize();
+  const Loop_index_type ibegin = 0;
+  const Loop_index_type iend = static_cast<Loop_index_type>(getActualProblemSize());
 
-  DOT_DATA_SETUP;
+  DOT_PRECISION_DATA_SETUP(Data_type, Compute_type);
 
   switch ( vid ) {
 
@@ -33,10 +35,10 @@ void DOT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type dot = m_dot_init;
+        Compute_type dot = m_dot_init;
 
-        for (Index_type i = ibegin; i < iend; ++i ) {
-          DOT_BODY;
+        for (Loop_index_type i = ibegin; i < iend; ++i ) {
+          DOT_PRECISION_BODY(Compute_type);
         }
 
          m_dot += dot;
@@ -50,16 +52,16 @@ void DOT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 #if defined(RUN_RAJA_SEQ)
     case Lambda_Seq : {
 
-      auto dot_base_lam = [=](Index_type i) -> Real_type {
-                            return a[i] * b[i];
+      auto dot_base_lam = [=](Loop_index_type i) -> Compute_type {
+                            return Compute_type(a[i]) * Compute_type(b[i]);
                           };
 
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        Real_type dot = m_dot_init;
+        Compute_type dot = m_dot_init;
 
-        for (Index_type i = ibegin; i < iend; ++i ) {
+        for (Loop_index_type i = ibegin; i < iend; ++i ) {
           dot += dot_base_lam(i);
         }
 
@@ -76,11 +78,12 @@ void DOT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
       startTimer();
       for (RepIndex_type irep = 0; irep < run_reps; ++irep) {
 
-        RAJA::ReduceSum<RAJA::seq_reduce, Real_type> dot(m_dot_init);
+        RAJA::ReduceSum<RAJA::seq_reduce, Compute_type> dot(m_dot_init);
 
         RAJA::forall<RAJA::loop_exec>(
-          RAJA::RangeSegment(ibegin, iend), [=](Index_type i) {
-          DOT_BODY;
+          RAJA::TypedRangeSegment<Loop_index_type>(ibegin, iend),
+          [=](Loop_index_type i) {
+          DOT_PRECISION_BODY(Compute_type);
         });
 
         m_dot += static_cast<Real_type>(dot.get());
@@ -100,5 +103,7 @@ void DOT::runSeqVariant(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
 
 }
 
+RAJAPERF_SEQ_PRECISION_INDEX_TYPE_TUNING_DEFINE_BOILERPLATE(DOT)
+
 } // end namespace stream
 } // end namespace rajaperf
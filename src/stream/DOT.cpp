@@ -54,19 +54,35 @@ DOT::DOT(const RunParams& params)
   setVariantDefined( RAJA_HIP );
 
   setVariantDefined( Kokkos_Lambda );
+
+  setVariantDefined( Base_ThreadPool );
+  setVariantDefined( Lambda_ThreadPool );
+
+  setVariantDefined( Base_StdPar );
+  setVariantDefined( Lambda_StdPar );
+
+  setVariantDefined( Base_SIMD );
+  setVariantDefined( RAJA_SIMD );
 }
 
 DOT::~DOT()
 {
 }
 
-void DOT::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DOT::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitData(m_a, getActualProblemSize(), vid);
   allocAndInitData(m_b, getActualProblemSize(), vid);
 
   m_dot = 0.0;
   m_dot_init = 0.0;
+
+  if ( precision::isTuning(getVariantTuningName(vid, tune_idx)) ) {
+    precision::allocAndCopyData(m_a_fp32, m_a, getActualProblemSize());
+    precision::allocAndCopyData(m_b_fp32, m_b, getActualProblemSize());
+    recordBytesSaved(vid, tune_idx, precision::getBytesSaved(
+      2*sizeof(Real_type) * getActualProblemSize()));
+  }
 }
 
 void DOT::updateChecksum(VariantID vid, size_t tune_idx)
@@ -74,11 +90,15 @@ void DOT::updateChecksum(VariantID vid, size_t tune_idx)
   checksum[vid][tune_idx] += m_dot;
 }
 
-void DOT::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void DOT::tearDown(VariantID vid, size_t tune_idx)
 {
-  (void) vid;
   deallocData(m_a);
   deallocData(m_b);
+
+  if ( precision::isTuning(getVariantTuningName(vid, tune_idx)) ) {
+    precision::deallocData(m_a_fp32);
+    precision::deallocData(m_b_fp32);
+  }
 }
 
 } // end namespace stream
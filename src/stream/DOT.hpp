@@ -21,11 +21,23 @@
   Real_ptr a = m_a; \
   Real_ptr b = m_b;
 
+// the data in the types of a precision tuning (see common/PrecisionUtils.hpp)
+#define DOT_PRECISION_DATA_SETUP(Data_type, Compute_type) \
+  Data_type* a = precision::getData<Data_type>(m_a, m_a_fp32); \
+  Data_type* b = precision::getData<Data_type>(m_b, m_b_fp32);
+
 #define DOT_BODY  \
   dot += a[i] * b[i] ;
 
+// the precision tunings load and store Data_type and do the arithmetic in
+// Compute_type (see common/PrecisionUtils.hpp)
+#define DOT_PRECISION_BODY(Compute_type)  \
+  dot += Compute_type(a[i]) * Compute_type(b[i]) ;
+
 
 #include "common/KernelBase.hpp"
+#include "common/IndexTypeUtils.hpp"
+#include "common/PrecisionUtils.hpp"
 
 namespace rajaperf
 {
@@ -52,7 +64,18 @@ public:
   void runHipVariant(VariantID vid, size_t tune_idx);
   void runOpenMPTargetVariant(VariantID vid, size_t tune_idx);
   void runKokkosVariant(VariantID vid, size_t tune_idx);
-
+  void runThreadPoolVariant(VariantID vid, size_t tune_idx);
+  void runStdParVariant(VariantID vid, size_t tune_idx);
+  void runSIMDVariant(VariantID vid, size_t tune_idx);
+
+  void setSeqTuningDefinitions(VariantID vid);
+  template < typename Data_type, typename Compute_type,
+             typename Loop_index_type >
+  void runSeqVariantImpl(VariantID vid);
+  void setOpenMPTuningDefinitions(VariantID vid);
+  template < typename Data_type, typename Compute_type,
+             typename Loop_index_type, bool runtime_schedule >
+  void runOpenMPVariantImpl(VariantID vid);
   void setCudaTuningDefinitions(VariantID vid);
   void setHipTuningDefinitions(VariantID vid);
   template < size_t block_size >
@@ -66,6 +89,8 @@ private:
 
   Real_ptr m_a;
   Real_ptr m_b;
+  precision::Float_ptr m_a_fp32;
+  precision::Float_ptr m_b_fp32;
   Real_type m_dot;
   Real_type m_dot_init;
 };
@@ -58,31 +58,57 @@ TRIAD::TRIAD(const RunParams& params)
   setVariantDefined( RAJA_HIP );
 
   setVariantDefined( Kokkos_Lambda );
+
+  setVariantDefined( Base_ThreadPool );
+  setVariantDefined( Lambda_ThreadPool );
+
+  setVariantDefined( Base_StdPar );
+  setVariantDefined( Lambda_StdPar );
+
+  setVariantDefined( Base_SIMD );
+  setVariantDefined( RAJA_SIMD );
 }
 
 TRIAD::~TRIAD()
 {
 }
 
-void TRIAD::setUp(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void TRIAD::setUp(VariantID vid, size_t tune_idx)
 {
   allocAndInitDataConst(m_a, getActualProblemSize(), 0.0, vid);
   allocAndInitData(m_b, getActualProblemSize(), vid);
   allocAndInitData(m_c, getActualProblemSize(), vid);
   initData(m_alpha, vid);
+
+  if ( precision::isTuning(getVariantTuningName(vid, tune_idx)) ) {
+    precision::allocAndCopyData(m_a_fp32, m_a, getActualProblemSize());
+    precision::allocAndCopyData(m_b_fp32, m_b, getActualProblemSize());
+    precision::allocAndCopyData(m_c_fp32, m_c, getActualProblemSize());
+    recordBytesSaved(vid, tune_idx, precision::getBytesSaved(
+      3*sizeof(Real_type) * getActualProblemSize()));
+  }
 }
 
 void TRIAD::updateChecksum(VariantID vid, size_t tune_idx)
 {
+  if ( precision::isTuning(getVariantTuningName(vid, tune_idx)) ) {
+    precision::copyData(m_a, m_a_fp32, getActualProblemSize());
+  }
+
   checksum[vid][tune_idx] += calcChecksum(m_a, getActualProblemSize(), checksum_scale_factor );
 }
 
-void TRIAD::tearDown(VariantID vid, size_t RAJAPERF_UNUSED_ARG(tune_idx))
+void TRIAD::tearDown(VariantID vid, size_t tune_idx)
 {
-  (void) vid;
   deallocData(m_a);
   deallocData(m_b);
   deallocData(m_c);
+
+  if ( precision::isTuning(getVariantTuningName(vid, tune_idx)) ) {
+    precision::deallocData(m_a_fp32);
+    precision::deallocData(m_b_fp32);
+    precision::deallocData(m_c_fp32);
+  }
 }
 
 } // end namespace stream